@@ -41,6 +41,7 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <type_traits>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/ContainerTraits.h"
 //////////////////////////////////////////////////////////////////////////////
@@ -48,6 +49,20 @@
 namespace DGtal
 {
 
+  /**
+   * Description of template class 'HasNativeSetOperations' <p>
+   * \brief Aim: tells if a set type provides its own set operations,
+   * as the methods assignUnion, assignIntersection, assignDifference,
+   * assignSymmetricDifference, includes and equals, which are then
+   * used by the functions of SetFunctions.h instead of the generic
+   * ones. It is false by default and is specialized by such sets
+   * (e.g. DigitalSetByIntervals or DigitalSetByBitset).
+   *
+   * @tparam T any type.
+   */
+  template <typename T>
+  struct HasNativeSetOperations : public std::false_type {};
+
   namespace detail {
     template <typename LessThan, typename T> 
     struct EqualPredicateFromLessThanComparator {
@@ -812,7 +827,8 @@ namespace DGtal
      * set, an unordered_set, a map, etc).
      */
     template <typename Container>
-    bool isEqual( const Container& S1, const Container& S2 )
+    typename std::enable_if< ! HasNativeSetOperations< Container >::value, bool >::type
+    isEqual( const Container& S1, const Container& S2 )
       {
         BOOST_STATIC_ASSERT( IsContainer< Container >::value );
         BOOST_STATIC_CONSTANT
@@ -866,7 +882,8 @@ namespace DGtal
      * set, an unordered_set, a map, etc).
      */
     template <typename Container>
-    bool isSubset( const Container& S1, const Container& S2 )
+    typename std::enable_if< ! HasNativeSetOperations< Container >::value, bool >::type
+    isSubset( const Container& S1, const Container& S2 )
       {
         BOOST_STATIC_ASSERT( IsContainer< Container >::value );
         BOOST_STATIC_CONSTANT
@@ -915,7 +932,8 @@ namespace DGtal
      * set, an unordered_set, a map, etc).
      */
     template <typename Container>
-    Container& assignDifference( Container& S1, const Container& S2 )
+    typename std::enable_if< ! HasNativeSetOperations< Container >::value, Container& >::type
+    assignDifference( Container& S1, const Container& S2 )
     {
       BOOST_STATIC_ASSERT( IsContainer< Container >::value );
       BOOST_STATIC_CONSTANT
@@ -962,7 +980,8 @@ namespace DGtal
      * set, an unordered_set, a map, etc).
      */
     template <typename Container>
-    Container makeDifference( const Container& S1, const Container& S2 )
+    typename std::enable_if< ! HasNativeSetOperations< Container >::value, Container >::type
+    makeDifference( const Container& S1, const Container& S2 )
     {
       BOOST_STATIC_ASSERT( IsContainer< Container >::value );
       Container S( S1 );
@@ -1009,7 +1028,8 @@ namespace DGtal
      * set, an unordered_set, a map, etc).
      */
     template <typename Container>
-    Container& assignUnion( Container& S1, const Container& S2 )
+    typename std::enable_if< ! HasNativeSetOperations< Container >::value, Container& >::type
+    assignUnion( Container& S1, const Container& S2 )
     {
       BOOST_STATIC_ASSERT( IsContainer< Container >::value );
       BOOST_STATIC_CONSTANT
@@ -1054,7 +1074,8 @@ namespace DGtal
      * set, an unordered_set, a map, etc).
      */
     template <typename Container>
-    Container makeUnion( const Container& S1, const Container& S2 )
+    typename std::enable_if< ! HasNativeSetOperations< Container >::value, Container >::type
+    makeUnion( const Container& S1, const Container& S2 )
     {
       BOOST_STATIC_ASSERT( IsContainer< Container >::value );
       Container S( S1 );
@@ -1101,7 +1122,8 @@ namespace DGtal
      * set, an unordered_set, a map, etc).
      */
     template <typename Container>
-    Container& assignIntersection( Container& S1, const Container& S2 )
+    typename std::enable_if< ! HasNativeSetOperations< Container >::value, Container& >::type
+    assignIntersection( Container& S1, const Container& S2 )
     {
       BOOST_STATIC_ASSERT( IsContainer< Container >::value );
       BOOST_STATIC_CONSTANT
@@ -1146,7 +1168,8 @@ namespace DGtal
      * set, an unordered_set, a map, etc).
      */
     template <typename Container>
-    Container makeIntersection( const Container& S1, const Container& S2 )
+    typename std::enable_if< ! HasNativeSetOperations< Container >::value, Container >::type
+    makeIntersection( const Container& S1, const Container& S2 )
     {
       BOOST_STATIC_ASSERT( IsContainer< Container >::value );
       Container S( S1 );
@@ -1195,7 +1218,8 @@ namespace DGtal
      * set, an unordered_set, a map, etc).
      */
     template <typename Container>
-    Container& assignSymmetricDifference( Container& S1, const Container& S2 )
+    typename std::enable_if< ! HasNativeSetOperations< Container >::value, Container& >::type
+    assignSymmetricDifference( Container& S1, const Container& S2 )
     {
       BOOST_STATIC_ASSERT( IsContainer< Container >::value );
       BOOST_STATIC_CONSTANT
@@ -1240,7 +1264,8 @@ namespace DGtal
      * set, an unordered_set, a map, etc).
      */
     template <typename Container>
-    Container makeSymmetricDifference( const Container& S1, const Container& S2 )
+    typename std::enable_if< ! HasNativeSetOperations< Container >::value, Container >::type
+    makeSymmetricDifference( const Container& S1, const Container& S2 )
     {
       BOOST_STATIC_ASSERT( IsContainer< Container >::value );
       Container S( S1 );
@@ -1250,6 +1275,158 @@ namespace DGtal
 
 
 
+    ///////////////////////////////////////////////////////////////////////////
+    // SET OPERATIONS ON SETS WITH NATIVE SET OPERATIONS
+    ///////////////////////////////////////////////////////////////////////////
+
+    /**
+     * Equality test for sets with their own set operations (see
+     * HasNativeSetOperations).
+     * @param[in] S1 an input set.
+     * @param[in] S2 another input set.
+     * @return true iff \a S1 is equal to \a S2.
+     */
+    template <typename Container>
+    typename std::enable_if< HasNativeSetOperations< Container >::value, bool >::type
+    isEqual( const Container& S1, const Container& S2 )
+    {
+      return S1.equals( S2 );
+    }
+
+    /**
+     * Inclusion test for sets with their own set operations (see
+     * HasNativeSetOperations).
+     * @param[in] S1 an input set.
+     * @param[in] S2 another input set.
+     * @return true iff \a S1 is a subset of \a S2.
+     */
+    template <typename Container>
+    typename std::enable_if< HasNativeSetOperations< Container >::value, bool >::type
+    isSubset( const Container& S1, const Container& S2 )
+    {
+      return S2.includes( S1 );
+    }
+
+    /**
+     * Set difference operation for sets with their own set operations (see
+     * HasNativeSetOperations). Updates the set \a S1 as \a S1 - \a S2.
+     * @param[in,out] S1 an input set, \a S1 - \a S2 as output.
+     * @param[in] S2 another input set.
+     * @return a reference to \a S1.
+     */
+    template <typename Container>
+    typename std::enable_if< HasNativeSetOperations< Container >::value, Container& >::type
+    assignDifference( Container& S1, const Container& S2 )
+    {
+      return S1.assignDifference( S2 );
+    }
+
+    /**
+     * Set difference operation for sets with their own set operations (see
+     * HasNativeSetOperations).
+     * @param[in] S1 an input set.
+     * @param[in] S2 another input set.
+     * @return the set \a S1 - \a S2.
+     */
+    template <typename Container>
+    typename std::enable_if< HasNativeSetOperations< Container >::value, Container >::type
+    makeDifference( const Container& S1, const Container& S2 )
+    {
+      Container S( S1 );
+      S.assignDifference( S2 );
+      return S;
+    }
+
+    /**
+     * Set union operation for sets with their own set operations (see
+     * HasNativeSetOperations). Updates the set \a S1 as \f$ S1 \cup S2 \f$.
+     * @param[in,out] S1 an input set, \f$ S1 \cup S2 \f$ as output.
+     * @param[in] S2 another input set.
+     * @return a reference to \a S1.
+     */
+    template <typename Container>
+    typename std::enable_if< HasNativeSetOperations< Container >::value, Container& >::type
+    assignUnion( Container& S1, const Container& S2 )
+    {
+      return S1.assignUnion( S2 );
+    }
+
+    /**
+     * Set union operation for sets with their own set operations (see
+     * HasNativeSetOperations).
+     * @param[in] S1 an input set.
+     * @param[in] S2 another input set.
+     * @return the set \f$ S1 \cup S2 \f$.
+     */
+    template <typename Container>
+    typename std::enable_if< HasNativeSetOperations< Container >::value, Container >::type
+    makeUnion( const Container& S1, const Container& S2 )
+    {
+      Container S( S1 );
+      S.assignUnion( S2 );
+      return S;
+    }
+
+    /**
+     * Set intersection operation for sets with their own set operations (see
+     * HasNativeSetOperations). Updates the set \a S1 as \f$ S1 \cap S2 \f$.
+     * @param[in,out] S1 an input set, \f$ S1 \cap S2 \f$ as output.
+     * @param[in] S2 another input set.
+     * @return a reference to \a S1.
+     */
+    template <typename Container>
+    typename std::enable_if< HasNativeSetOperations< Container >::value, Container& >::type
+    assignIntersection( Container& S1, const Container& S2 )
+    {
+      return S1.assignIntersection( S2 );
+    }
+
+    /**
+     * Set intersection operation for sets with their own set operations (see
+     * HasNativeSetOperations).
+     * @param[in] S1 an input set.
+     * @param[in] S2 another input set.
+     * @return the set \f$ S1 \cap S2 \f$.
+     */
+    template <typename Container>
+    typename std::enable_if< HasNativeSetOperations< Container >::value, Container >::type
+    makeIntersection( const Container& S1, const Container& S2 )
+    {
+      Container S( S1 );
+      S.assignIntersection( S2 );
+      return S;
+    }
+
+    /**
+     * Set symmetric difference operation for sets with their own set operations (see
+     * HasNativeSetOperations). Updates the set \a S1 as \f$ S1 \Delta S2 \f$.
+     * @param[in,out] S1 an input set, \f$ S1 \Delta S2 \f$ as output.
+     * @param[in] S2 another input set.
+     * @return a reference to \a S1.
+     */
+    template <typename Container>
+    typename std::enable_if< HasNativeSetOperations< Container >::value, Container& >::type
+    assignSymmetricDifference( Container& S1, const Container& S2 )
+    {
+      return S1.assignSymmetricDifference( S2 );
+    }
+
+    /**
+     * Set symmetric difference operation for sets with their own set operations (see
+     * HasNativeSetOperations).
+     * @param[in] S1 an input set.
+     * @param[in] S2 another input set.
+     * @return the set \f$ S1 \Delta S2 \f$.
+     */
+    template <typename Container>
+    typename std::enable_if< HasNativeSetOperations< Container >::value, Container >::type
+    makeSymmetricDifference( const Container& S1, const Container& S2 )
+    {
+      Container S( S1 );
+      S.assignSymmetricDifference( S2 );
+      return S;
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     // OVERLOADING SET OPERATIONS
     ///////////////////////////////////////////////////////////////////////////
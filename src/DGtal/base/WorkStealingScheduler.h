@@ -0,0 +1,208 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file WorkStealingScheduler.h
+ * @brief Built-in multithreaded scheduler for loops over integer ranges.
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module WorkStealingScheduler.ih
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see testWorkStealingScheduler.cpp
+ */
+
+#if defined(WorkStealingScheduler_RECURSES)
+#error Recursive header files inclusion detected in WorkStealingScheduler.h
+#else // defined(WorkStealingScheduler_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define WorkStealingScheduler_RECURSES
+
+#if !defined WorkStealingScheduler_h
+/** Prevents repeated inclusion of headers. */
+#define WorkStealingScheduler_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class WorkStealingScheduler
+  /**
+   * Description of class 'WorkStealingScheduler' <p>
+   * \brief Aim: Runs a loop over the integer range [0, n) on several
+   * threads, without OpenMP.
+   *
+   * The range is first split evenly between the threads. Each thread
+   * then processes its own part by chunks taken at the front. When a
+   * thread runs out of work, it steals the back half of the
+   * remaining part of another thread. Hence, the loads are balanced
+   * even when the cost of the items is irregular (e.g. lines of a
+   * Voronoi map with few sites), and the items processed by a thread
+   * are mostly consecutive.
+   *
+   * The loop body is a functor called on chunks: @a f(first, last,
+   * thread) must process the items [first, last) and @a thread is
+   * the index, in [0, nbThreads), of the calling thread, which can be
+   * used to address per-thread data (e.g. scratch buffers). The
+   * calling thread takes part in the computation as thread 0. If the
+   * body throws, the first exception is rethrown by forEach once all
+   * the threads are done.
+   *
+   * By default, forEach runs sequentially on the calling thread:
+   * parallelism is enabled explicitly and globally with
+   * setNumberOfThreads (e.g. setNumberOfThreads(
+   * hardwareConcurrency() ) to use all the hardware threads). When
+   * DGtal is built with WITH_OPENMP, the default is instead
+   * hardwareConcurrency() threads, so that the algorithms that used
+   * OpenMP loops before relying on this scheduler (VoronoiMap,
+   * VoronoiMapComplete, PowerMap) stay parallel in such builds. The
+   * algorithms relying on this scheduler then call their functors
+   * (predicates, metrics, images, ...) concurrently, which must thus
+   * support concurrent const calls.
+   *
+   * @code
+   * std::vector<double> v( 1000000 );
+   * WorkStealingScheduler::forEach( v.size(),
+   *   [&v] ( std::size_t first, std::size_t last, unsigned int )
+   *   {
+   *     for ( std::size_t i = first; i < last; ++i )
+   *       v[ i ] = std::sqrt( (double) i );
+   *   } );
+   * @endcode
+   */
+  class WorkStealingScheduler
+  {
+  public:
+    /**
+     * @return the number of threads used by forEach (at least one,
+     * defaultNumberOfThreads() unless set with setNumberOfThreads).
+     */
+    static unsigned int numberOfThreads();
+
+    /**
+     * @return the default number of threads used by forEach:
+     * hardwareConcurrency() when DGtal is built with WITH_OPENMP, one
+     * (i.e. a sequential computation) otherwise.
+     */
+    static unsigned int defaultNumberOfThreads();
+
+    /**
+     * @return the number of concurrent threads supported by the
+     * hardware (at least one).
+     */
+    static unsigned int hardwareConcurrency();
+
+    /**
+     * Sets the number of threads used by forEach.
+     *
+     * @param nbThreads the number of threads, 0 to restore the
+     * default value (see defaultNumberOfThreads).
+     */
+    static void setNumberOfThreads( unsigned int nbThreads );
+
+    /**
+     * Runs @a f on the items [0, @a nbItems) with numberOfThreads()
+     * threads.
+     *
+     * @tparam TFunctor type of functor with signature
+     * void(std::size_t, std::size_t, unsigned int).
+     *
+     * @param nbItems number of items.
+     * @param f the loop body called on chunks of items.
+     */
+    template <typename TFunctor>
+    static void forEach( const std::size_t nbItems, TFunctor && f );
+
+    /**
+     * Runs @a f on the items [0, @a nbItems) with at most @a
+     * nbThreads threads.
+     *
+     * @tparam TFunctor type of functor with signature
+     * void(std::size_t, std::size_t, unsigned int).
+     *
+     * @param nbItems number of items.
+     * @param nbThreads maximal number of threads (the thread indices
+     * given to @a f are lower than this number).
+     * @param f the loop body called on chunks of items.
+     */
+    template <typename TFunctor>
+    static void forEach( const std::size_t nbItems,
+                         const unsigned int nbThreads,
+                         TFunctor && f );
+
+  private:
+    /// Part of the range owned by a thread.
+    struct Range
+    {
+      /// Protects the bounds.
+      std::mutex mutex;
+      /// First item.
+      std::size_t begin = 0;
+      /// Past-the-end item.
+      std::size_t end = 0;
+    };
+
+    /**
+     * @return the global setting of the number of threads (0 for
+     * the default value).
+     */
+    static std::atomic<unsigned int> & threadSetting();
+
+    /**
+     * Gets the next chunk of a thread, stealing work from the other
+     * threads if its own part of the range is empty.
+     *
+     * @param ranges the parts of all the threads.
+     * @param thread index of the thread.
+     * @param grain maximal number of items of a chunk.
+     * @param[out] first first item of the chunk.
+     * @param[out] last past-the-end item of the chunk.
+     * @return false if no work is left.
+     */
+    static bool nextChunk( std::vector<Range> & ranges,
+                           const unsigned int thread,
+                           const std::size_t grain,
+                           std::size_t & first,
+                           std::size_t & last );
+  }; // end of class WorkStealingScheduler
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/base/WorkStealingScheduler.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined WorkStealingScheduler_h
+
+#undef WorkStealingScheduler_RECURSES
+#endif // else defined(WorkStealingScheduler_RECURSES)
@@ -0,0 +1,304 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file FFTDigitalSurfaceConvolver.h
+ * @brief Computes the volumes and the covariance matrices of the
+ * intersection of a shape with several kernels at once, by blocked
+ * Fast Fourier Transforms of the shape.
+ *
+ * @date 2026/10/16
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see DigitalSurfaceConvolver.h PrefixSumConvolver.h RealFFT.h
+ */
+
+#if defined(FFTDigitalSurfaceConvolver_RECURSES)
+#error Recursive header files inclusion detected in FFTDigitalSurfaceConvolver.h
+#else // defined(FFTDigitalSurfaceConvolver_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define FFTDigitalSurfaceConvolver_RECURSES
+
+#if !defined FFTDigitalSurfaceConvolver_h
+/** Prevents repeated inclusion of headers. */
+#define FFTDigitalSurfaceConvolver_h
+
+#ifndef WITH_FFTW3
+  #error You need to have activated FFTW3 (WITH_FFTW3) to include this file.
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <complex>
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/base/CountedConstPtrOrConstPtr.h"
+#include "DGtal/kernel/CPointPredicate.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/math/RealFFT.h"
+#include "DGtal/math/linalg/SimpleMatrix.h"
+#include "DGtal/topology/CCellularGridSpaceND.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+/////////////////////////////////////////////////////////////////////////////
+// template class FFTDigitalSurfaceConvolver
+/**
+   * Description of class 'FFTDigitalSurfaceConvolver' <p>
+   *
+   * Aim: Computes the same volumes and covariance matrices as
+   * DigitalSurfaceConvolver, i.e. the convolution of the
+   * characteristic function of a shape with a digital kernel around
+   * the inner and outer spels of surfels, for several kernels at once
+   * (typically balls of several radii), by Fast Fourier Transforms of
+   * the whole shape.
+   *
+   * The volume at a point p is the correlation of the shape with the
+   * kernel. The covariance matrix is deduced from the correlations of
+   * the shape with the moment kernels k_i and k_i k_j, where k is
+   * the position of a kernel point relative to its center. These
+   * kernels have integer values, so the results are rounded to the
+   * nearest integers and are then exactly those of
+   * PrefixSumConvolver.
+   *
+   * The domain of the space is split into blocks, which are
+   * transformed independently (overlap-save method): each block is
+   * enlarged by the extent of the kernels, its RealFFT is computed
+   * once and multiplied by the spectrum of each kernel, and only the
+   * correlations at the requested points of the block are kept. The
+   * blocks are processed in parallel with WorkStealingScheduler, and
+   * the blocks without requested points are skipped, so that the
+   * cost is proportional to the number of blocks crossed by the
+   * surface, whatever the number of kernels.
+   *
+   * @code
+   * FFTDigitalSurfaceConvolver< KSpace, Shape > convolver( K, shape, false );
+   * for ( auto r : radii ) convolver.addKernel( ball( r ) );
+   * std::vector< std::vector< double > > volumes; // volumes[ kernel ][ surfel ]
+   * convolver.volumes( surfels.begin(), surfels.end(), volumes );
+   * @endcode
+   *
+   * @tparam TKSpace a model of CCellularGridSpaceND, the space in which
+   * the shape is defined.
+   * @tparam TPointPredicate a model of concepts::CPointPredicate, the
+   * characteristic function of the shape, which may be called
+   * concurrently by several threads.
+   *
+   * @note Requires FFTW3 (WITH_FFTW3).
+   */
+template< typename TKSpace, typename TPointPredicate >
+class FFTDigitalSurfaceConvolver
+{
+public:
+  typedef FFTDigitalSurfaceConvolver< TKSpace, TPointPredicate > Self;
+  typedef TKSpace KSpace;
+  typedef TPointPredicate PointPredicate;
+  BOOST_CONCEPT_ASSERT (( concepts::CCellularGridSpaceND< KSpace > ));
+  BOOST_CONCEPT_ASSERT (( concepts::CPointPredicate< PointPredicate > ));
+
+  typedef typename KSpace::Space Space;
+  typedef typename KSpace::Integer Integer;
+  typedef typename Space::Point Point;
+  typedef HyperRectDomain< Space > Domain;
+  typedef typename KSpace::Surfel Surfel;
+
+  typedef double Quantity;
+  typedef SimpleMatrix< double, Space::dimension, Space::dimension > CovarianceMatrix;
+
+  typedef RealFFT< Domain, double > FFT;
+  typedef typename FFT::Complex Complex;
+
+  // ----------------------- Standard services ------------------------------
+public:
+
+  /**
+   * Constructor.
+   *
+   * @param[in] K the cellular grid space in which the shape is defined.
+   * @param[in] aPointPredicate the characteristic function of the shape.
+   * @param[in] withMoments when 'true', the moment kernels are also
+   * transformed, which is needed by the covariance matrices.
+   * @param[in] blockSize the size of the transformed blocks along each
+   * axis, which is enlarged when it is less than twice the extent of
+   * the kernels.
+   */
+  FFTDigitalSurfaceConvolver( ConstAlias< KSpace > K,
+                              ConstAlias< PointPredicate > aPointPredicate,
+                              bool withMoments,
+                              Integer blockSize = 64 );
+
+  /**
+   * Adds a kernel defined by a digital shape, e.g. a GaussDigitizer
+   * of a ball, centered on the origin.
+   *
+   * @tparam DigitalKernel a type with methods getDomain() and
+   * operator()( Point ), e.g. GaussDigitizer.
+   * @param[in] aKernel the digital kernel.
+   * @return the index of the kernel.
+   */
+  template < typename DigitalKernel >
+  std::size_t addKernel( const DigitalKernel & aKernel );
+
+  /// Removes all the kernels.
+  void clearKernels();
+
+  /// @return the number of kernels.
+  std::size_t nbKernels() const;
+
+  /// @return 'true' if the covariance matrices can be computed.
+  bool hasMoments() const;
+
+  // ----------------------- Interface --------------------------------------
+public:
+
+  /**
+   * Computes, for each kernel, the mean of the volumes at the inner
+   * and at the outer spel of each surfel, like
+   * DigitalSurfaceConvolver::eval.
+   *
+   * @tparam SurfelIterator type of iterator on surfels.
+   * @param[in] itbegin an iterator on the first surfel.
+   * @param[in] itend an iterator after the last surfel.
+   * @param[out] result the volumes, indexed by kernel then by surfel
+   * in the order of the range.
+   */
+  template< typename SurfelIterator >
+  void volumes( const SurfelIterator & itbegin,
+                const SurfelIterator & itend,
+                std::vector< std::vector< Quantity > > & result ) const;
+
+  /**
+   * Computes, for each kernel, the mean of the covariance matrices at
+   * the inner and at the outer spel of each surfel, like
+   * DigitalSurfaceConvolver::evalCovarianceMatrix.
+   *
+   * @pre 'hasMoments()'
+   * @tparam SurfelIterator type of iterator on surfels.
+   * @param[in] itbegin an iterator on the first surfel.
+   * @param[in] itend an iterator after the last surfel.
+   * @param[out] result the covariance matrices, indexed by kernel then
+   * by surfel in the order of the range.
+   */
+  template< typename SurfelIterator >
+  void covarianceMatrices( const SurfelIterator & itbegin,
+                           const SurfelIterator & itend,
+                           std::vector< std::vector< CovarianceMatrix > > & result ) const;
+
+  /**
+   * Writes/Displays the object on an output stream.
+   * @param out the output stream where the object is written.
+   */
+  void selfDisplay ( std::ostream & out ) const;
+
+  /**
+   * Checks the validity/consistency of the object.
+   * @return 'true' if the object is valid, 'false' otherwise.
+   */
+  bool isValid() const;
+
+  // ------------------------- Private Datas --------------------------------
+private:
+
+  const KSpace & myKSpace;        ///< the space in which the shape is defined.
+  CountedConstPtrOrConstPtr< PointPredicate > myPointPredicate; ///< the shape.
+  bool myWithMoments;             ///< when 'true', the moment kernels are used.
+  Integer myBlockSize;            ///< the minimal size of the transformed blocks.
+  /// The points of each kernel, relative to its center.
+  std::vector< std::vector< Point > > myKernels;
+
+  // ------------------------- Internals ------------------------------------
+private:
+
+  /**
+   * Computes the rounded correlations of the shape with each kernel
+   * (and its moment kernels) at the given points, and gives them to
+   * a functor.
+   *
+   * @tparam PointFunctor a functor with signature void( std::size_t
+   * kernel, std::size_t point, const DGtal::int64_t * moments ),
+   * called concurrently, where @a moments are the volume, then the
+   * first moments, then the second moments (k_i k_j, i <= j) when
+   * hasMoments().
+   * @param[in] points the points.
+   * @param[in] f the functor.
+   */
+  template < typename PointFunctor >
+  void correlate( const std::vector< Point > & points, PointFunctor && f ) const;
+
+  /**
+   * @tparam SurfelIterator type of iterator on surfels.
+   * @param[in] itbegin an iterator on the first surfel.
+   * @param[in] itend an iterator after the last surfel.
+   * @return the inner and the outer spel of each surfel, in sequence.
+   */
+  template < typename SurfelIterator >
+  std::vector< Point > spels( SurfelIterator itbegin, const SurfelIterator & itend ) const;
+
+  /**
+   * @param[in] moments the volume, then the first and second moments.
+   * @return the covariance matrix, as PrefixSumConvolver::covarianceMatrix.
+   */
+  static CovarianceMatrix covarianceMatrix( const DGtal::int64_t * moments );
+
+  /**
+   * Copy constructor.
+   * @param other the object to clone.
+   * Forbidden by default.
+   */
+  FFTDigitalSurfaceConvolver ( const FFTDigitalSurfaceConvolver & other );
+
+  /**
+   * Assignment.
+   * @param other the object to copy.
+   * @return a reference on 'this'.
+   * Forbidden by default.
+   */
+  FFTDigitalSurfaceConvolver & operator= ( const FFTDigitalSurfaceConvolver & other );
+
+}; // end of class FFTDigitalSurfaceConvolver
+
+/**
+ * Overloads 'operator<<' for displaying objects of class 'FFTDigitalSurfaceConvolver'.
+ * @param out the output stream where the object is written.
+ * @param object the object of class 'FFTDigitalSurfaceConvolver' to write.
+ * @return the output stream after the writing.
+ */
+template< typename TKSpace, typename TPointPredicate >
+std::ostream&
+operator<< ( std::ostream & out,
+             const FFTDigitalSurfaceConvolver< TKSpace, TPointPredicate > & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/surfaces/FFTDigitalSurfaceConvolver.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined FFTDigitalSurfaceConvolver_h
+
+#undef FFTDigitalSurfaceConvolver_RECURSES
+#endif // else defined(FFTDigitalSurfaceConvolver_RECURSES)
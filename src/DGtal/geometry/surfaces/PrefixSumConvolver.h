@@ -0,0 +1,332 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file PrefixSumConvolver.h
+ * @brief Computes the volume and the covariance matrix of the
+ * intersection of a shape with a kernel from prefix sums of the shape
+ * along the lines of its domain.
+ *
+ * @date 2026/10/16
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see DigitalSurfaceConvolver.h IntegralInvariantVolumeEstimator.h
+ * IntegralInvariantCovarianceEstimator.h
+ */
+
+#if defined(PrefixSumConvolver_RECURSES)
+#error Recursive header files inclusion detected in PrefixSumConvolver.h
+#else // defined(PrefixSumConvolver_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define PrefixSumConvolver_RECURSES
+
+#if !defined PrefixSumConvolver_h
+/** Prevents repeated inclusion of headers. */
+#define PrefixSumConvolver_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/base/CountedConstPtrOrConstPtr.h"
+#include "DGtal/kernel/CPointPredicate.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/math/linalg/SimpleMatrix.h"
+#include "DGtal/topology/CCellularGridSpaceND.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+/////////////////////////////////////////////////////////////////////////////
+// template class PrefixSumConvolver
+/**
+   * Description of class 'PrefixSumConvolver' <p>
+   *
+   * Aim: Computes the same volumes and covariance matrices as
+   * DigitalSurfaceConvolver, i.e. the convolution of the
+   * characteristic function of a shape with a digital kernel around
+   * the inner and outer spels of surfels, from tables of prefix sums
+   * instead of a walk on the kernel points.
+   *
+   * At construction, the shape is scanned once (in parallel with
+   * WorkStealingScheduler) along the lines parallel to the first axis
+   * of the domain of the space. For each line, the number of points
+   * of the shape before each point is stored, and also the sums of
+   * their first coordinate and of its square when moments are
+   * required. At initialization, the kernel is decomposed into runs
+   * of consecutive points along the first axis, e.g. the rows of the
+   * disks that are the slices of a 3D ball.
+   *
+   * The volume or the moments of the shape in a run are then given by
+   * two lookups, and the other coordinates are constant along the
+   * run. Evaluating a kernel of radius r is thus O(r^{n-1}) instead of
+   * O(r^n), the cost of the walk of DigitalSurfaceConvolver on the
+   * full kernel. The moments are centered on the kernel center, which
+   * leaves the covariance matrix unchanged.
+   *
+   * The tables use 4 bytes per point of the domain, and 16 bytes with
+   * moments.
+   *
+   * @tparam TKSpace a model of CCellularGridSpaceND, the space in which
+   * the shape is defined.
+   * @tparam TPointPredicate a model of concepts::CPointPredicate, the
+   * characteristic function of the shape, which may be called
+   * concurrently by several threads.
+   */
+template< typename TKSpace, typename TPointPredicate >
+class PrefixSumConvolver
+{
+public:
+  typedef PrefixSumConvolver< TKSpace, TPointPredicate > Self;
+  typedef TKSpace KSpace;
+  typedef TPointPredicate PointPredicate;
+  BOOST_CONCEPT_ASSERT (( concepts::CCellularGridSpaceND< KSpace > ));
+  BOOST_CONCEPT_ASSERT (( concepts::CPointPredicate< PointPredicate > ));
+
+  typedef typename KSpace::Space Space;
+  typedef typename KSpace::Integer Integer;
+  typedef typename Space::Point Point;
+  typedef HyperRectDomain< Space > Domain;
+  typedef typename KSpace::SCell Spel;
+  typedef typename KSpace::Surfel Surfel;
+
+  typedef double Quantity;
+  typedef SimpleMatrix< double, Space::dimension, Space::dimension > CovarianceMatrix;
+
+  /// Type for the number of points of the shape before a point of a line.
+  typedef DGtal::uint32_t Count;
+  /// Type for the sums of the first coordinate (relative to the line start).
+  typedef DGtal::uint32_t FirstMoment;
+  /// Type for the sums of the squared first coordinate.
+  typedef DGtal::uint64_t SecondMoment;
+
+  // ----------------------- Standard services ------------------------------
+public:
+
+  /**
+   * Constructor. Computes the prefix sums of the shape in the domain
+   * of the space.
+   *
+   * @param[in] K the cellular grid space in which the shape is defined.
+   * @param[in] aPointPredicate the characteristic function of the shape.
+   * @param[in] withMoments when 'true', the prefix sums of the first
+   * coordinate and of its square are also computed, which is needed
+   * by the covariance matrix.
+   */
+  PrefixSumConvolver( ConstAlias< KSpace > K,
+                      ConstAlias< PointPredicate > aPointPredicate,
+                      bool withMoments );
+
+  /**
+   * Initializes the kernel from a digital shape, e.g. a GaussDigitizer
+   * of a ball, centered on the origin.
+   *
+   * @tparam DigitalKernel a type with methods getDomain() and
+   * operator()( Point ), e.g. GaussDigitizer.
+   * @param[in] aKernel the digital kernel.
+   */
+  template < typename DigitalKernel >
+  void init( const DigitalKernel & aKernel );
+
+  /// @return 'true' if the moments are computed.
+  bool hasMoments() const;
+
+  // ----------------------- Interface --------------------------------------
+public:
+
+  /**
+   * @param[in] p any point.
+   * @return the number of points of the shape in the kernel
+   * translated at @a p and in the domain of the space.
+   */
+  Quantity volume( const Point & p ) const;
+
+  /**
+   * @pre 'hasMoments()'
+   * @param[in] p any point.
+   * @return the covariance matrix of the points of the shape in the
+   * kernel translated at @a p and in the domain of the space.
+   */
+  CovarianceMatrix covarianceMatrix( const Point & p ) const;
+
+  /**
+   * @tparam SurfelIterator type of iterator on surfels.
+   * @param[in] it an iterator on a surfel.
+   * @return the mean of the volumes at the inner and at the outer spel
+   * of the surfel, like DigitalSurfaceConvolver::eval.
+   */
+  template< typename SurfelIterator >
+  Quantity eval( const SurfelIterator & it ) const;
+
+  /**
+   * Computes in parallel the volumes of a range of surfels, transformed
+   * by a functor.
+   *
+   * @tparam SurfelIterator type of iterator on surfels.
+   * @tparam OutputIterator type of output iterator on the results.
+   * @tparam EvalFunctor a functor Quantity -> EvalFunctor::Value.
+   *
+   * @param[in] itbegin an iterator on the first surfel.
+   * @param[in] itend an iterator after the last surfel.
+   * @param[in,out] result the output iterator, in the order of the surfels.
+   * @param[in] functor the functor, copied once per thread.
+   */
+  template< typename SurfelIterator, typename OutputIterator, typename EvalFunctor >
+  void eval( const SurfelIterator & itbegin,
+             const SurfelIterator & itend,
+             OutputIterator & result,
+             EvalFunctor functor ) const;
+
+  /**
+   * @pre 'hasMoments()'
+   * @tparam SurfelIterator type of iterator on surfels.
+   * @param[in] it an iterator on a surfel.
+   * @return the mean of the covariance matrices at the inner and at the
+   * outer spel of the surfel, like
+   * DigitalSurfaceConvolver::evalCovarianceMatrix.
+   */
+  template< typename SurfelIterator >
+  CovarianceMatrix evalCovarianceMatrix( const SurfelIterator & it ) const;
+
+  /**
+   * Computes in parallel the covariance matrices of a range of
+   * surfels, transformed by a functor.
+   *
+   * @pre 'hasMoments()'
+   * @tparam SurfelIterator type of iterator on surfels.
+   * @tparam OutputIterator type of output iterator on the results.
+   * @tparam EvalFunctor a functor CovarianceMatrix -> EvalFunctor::Value.
+   *
+   * @param[in] itbegin an iterator on the first surfel.
+   * @param[in] itend an iterator after the last surfel.
+   * @param[in,out] result the output iterator, in the order of the surfels.
+   * @param[in] functor the functor, copied once per thread.
+   */
+  template< typename SurfelIterator, typename OutputIterator, typename EvalFunctor >
+  void evalCovarianceMatrix( const SurfelIterator & itbegin,
+                             const SurfelIterator & itend,
+                             OutputIterator & result,
+                             EvalFunctor functor ) const;
+
+  /**
+   * Writes/Displays the object on an output stream.
+   * @param out the output stream where the object is written.
+   */
+  void selfDisplay ( std::ostream & out ) const;
+
+  /**
+   * Checks the validity/consistency of the object.
+   * @return 'true' if the object is valid, 'false' otherwise.
+   */
+  bool isValid() const;
+
+  // ------------------------- Private Datas --------------------------------
+private:
+
+  /// A run of consecutive kernel points along the first axis.
+  struct Run
+  {
+    Point start;      ///< the first point of the run, relative to the kernel center.
+    Integer length;   ///< the number of points of the run.
+  };
+
+  const KSpace & myKSpace;        ///< the space in which the shape is defined.
+  CountedConstPtrOrConstPtr< PointPredicate > myPointPredicate; ///< the shape.
+  Point myLowerBound;             ///< the lower bound of the domain.
+  Point myUpperBound;             ///< the upper bound of the domain.
+  std::size_t myLineSize;         ///< the number of prefix sums per line (width + 1).
+  std::vector< std::size_t > myLineStrides; ///< the strides of the lines along each axis > 0.
+  std::vector< Count > myCounts;                ///< the prefix sums of the shape.
+  std::vector< FirstMoment > myFirstMoments;    ///< the prefix sums of the first coordinate.
+  std::vector< SecondMoment > mySecondMoments;  ///< the prefix sums of its square.
+  std::vector< Run > myRuns;      ///< the runs of the kernel.
+
+  // ------------------------- Internals ------------------------------------
+private:
+
+  /**
+   * Computes the prefix sums of all the lines.
+   * @param withMoments when 'true', computes also the moments.
+   */
+  void computePrefixSums( bool withMoments );
+
+  /**
+   * Clips a run translated at some point to the domain.
+   *
+   * @param[in] p the kernel center.
+   * @param[in] run a run of the kernel.
+   * @param[out] first the index of the prefix sum before the first point.
+   * @param[out] last the index of the prefix sum of the last point.
+   * @return 'false' if the run is outside the domain.
+   */
+  bool clip( const Point & p, const Run & run,
+             std::size_t & first, std::size_t & last ) const;
+
+  /**
+   * @param[in] s a surfel.
+   * @param[out] inner the point of its inner spel.
+   * @param[out] outer the point of its outer spel.
+   */
+  void spels( const Surfel & s, Point & inner, Point & outer ) const;
+
+  /**
+   * Copy constructor.
+   * @param other the object to clone.
+   * Forbidden by default.
+   */
+  PrefixSumConvolver ( const PrefixSumConvolver & other );
+
+  /**
+   * Assignment.
+   * @param other the object to copy.
+   * @return a reference on 'this'.
+   * Forbidden by default.
+   */
+  PrefixSumConvolver & operator= ( const PrefixSumConvolver & other );
+
+}; // end of class PrefixSumConvolver
+
+/**
+ * Overloads 'operator<<' for displaying objects of class 'PrefixSumConvolver'.
+ * @param out the output stream where the object is written.
+ * @param object the object of class 'PrefixSumConvolver' to write.
+ * @return the output stream after the writing.
+ */
+template< typename TKSpace, typename TPointPredicate >
+std::ostream&
+operator<< ( std::ostream & out,
+             const PrefixSumConvolver< TKSpace, TPointPredicate > & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/surfaces/PrefixSumConvolver.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined PrefixSumConvolver_h
+
+#undef PrefixSumConvolver_RECURSES
+#endif // else defined(PrefixSumConvolver_RECURSES)
@@ -56,6 +56,8 @@
 #include "DGtal/shapes/Shapes.h"
 
 #include "DGtal/geometry/surfaces/DigitalSurfaceConvolver.h"
+#include "DGtal/geometry/surfaces/PrefixSumConvolver.h"
+#include "DGtal/geometry/surfaces/estimation/ParallelSurfelRange.h"
 #include "DGtal/geometry/surfaces/estimation/IIGeometricFunctors.h"
 #include "DGtal/shapes/EuclideanShapesDecorator.h"
 
@@ -89,6 +91,19 @@ namespace DGtal
 * the normal or principal curvature directions, the Gaussian curvature
 * or individual principal curvature values.
 *
+* The volume can also be computed by a PrefixSumConvolver (see
+* setParams), from prefix sums of the shape along the lines of the
+* space computed once at initialization. Each evaluation is then in
+* O(r^{n-1}) instead of O(r^n) for a kernel of radius r. This is faster for
+* large radii and large surfaces, at the cost of 4 bytes per point of
+* the domain of the space.
+*
+* A range of surfels is evaluated in parallel (see
+* WorkStealingScheduler): the surfels are split into chunks of nearby
+* surfels by ParallelSurfelRange, and each chunk uses its own
+* displacement masks state. The point predicate should thus be
+* callable concurrently.
+*
 * @tparam TKSpace a model of CCellularGridSpaceND, the cellular space
 * in which the shape is defined.
 *
@@ -153,6 +168,7 @@ public:
 
   typedef DigitalSurfaceConvolver<ShapeSpelFunctor, KernelSpelFunctor, 
                                   KSpace, DigitalShapeKernel> Convolver;
+  typedef PrefixSumConvolver<KSpace, PointPredicate> TableConvolver;
   typedef typename Convolver::PairIterators PairIterators;
   typedef typename Convolver::CovarianceMatrix Matrix;
   typedef typename Matrix::Component Component;
@@ -228,11 +244,14 @@ public:
                ConstAlias<PointPredicate> aPointPredicate );
 
   /**
-  * Set specific parameters: the radius of the ball.
+  * Set specific parameters: the radius of the ball, and the
+  * computation backend.
   *
   * @param[in] dRadius the "digital" radius of the kernel (buy may be non integer).
+  * @param[in] usePrefixSums when 'true', the volumes are computed by
+  * a PrefixSumConvolver instead of the DigitalSurfaceConvolver.
   */
-  void setParams( const double dRadius );
+  void setParams( const double dRadius, const bool usePrefixSums = false );
   
   /**
   * Model of CDigitalSurfaceLocalEstimator. Initialisation.
@@ -282,6 +301,9 @@ public:
   *
   * @param[in] result output iterator of results of the computation.
   * @return the updated output iterator after all outputs.
+  *
+  * @note The surfels are evaluated in parallel, and the results are
+  * written in the order of the range.
   */
   template <typename OutputIterator, typename SurfelConstIterator>
   OutputIterator eval( SurfelConstIterator itb,
@@ -314,6 +336,9 @@ private:
   CountedPtr<ShapePointFunctor>  myShapePointFunctor; ///< Smart pointer on functor point -> {0,1}
   CountedPtr<ShapeSpelFunctor>   myShapeSpelFunctor;  ///< Smart pointer on functor spel ->  {0,1}
   CountedPtr<Convolver>          myConvolver;   ///< Convolver
+  CountedConstPtrOrConstPtr<KSpace> myKSpace; ///< Smart pointer (if required) on the space.
+  CountedPtr<TableConvolver>     myTableConvolver; ///< Prefix sums convolver, computed at init
+  bool myUsePrefixSums;                     ///< when 'true', uses myTableConvolver instead of myConvolver.
   Scalar myH;                               ///< precision of the grid
   Scalar myRadius;                          ///< "digital" radius of the kernel (buy may be non integer).
 
@@ -52,6 +52,7 @@
 #include "DGtal/topology/DigitalSurface.h"
 #include "DGtal/graph/DistanceBreadthFirstVisitor.h"
 #include "DGtal/geometry/volumes/distance/CMetricSpace.h"
+#include "DGtal/geometry/surfaces/estimation/ParallelSurfelRange.h"
 #include "DGtal/base/BasicFunctors.h"
 #include "DGtal/geometry/surfaces/estimation/estimationFunctors/CLocalEstimatorFromSurfelFunctor.h"
 //////////////////////////////////////////////////////////////////////////////
@@ -273,6 +274,10 @@ namespace DGtal
      * @param [in] ite end surfel iterator.
      * @param [in,out] result resulting output iterator
      *
+     * @note The surfels are evaluated in parallel (see
+     * ParallelSurfelRange), each thread with its own copy of the
+     * functor on surfels and of the surface tracker. The results are
+     * written in the order of the range.
      */
     template< typename SurfelConstIterator, typename OutputIterator>
     OutputIterator eval(const SurfelConstIterator& itb,
@@ -296,6 +301,14 @@ namespace DGtal
 
   private:
 
+    /**
+     * @return the estimated quantity at @a s.
+     * @param [in] s the surfel at which we evaluate the quantity.
+     * @param [in] surface the surface on which the neighborhood is visited.
+     * @param [in,out] functor the functor on surfels, reset after evaluation.
+     */
+    Quantity evalAt( const Surfel & s, const Surface & surface,
+                     FunctorOnSurfel & functor ) const;
 
     // ------------------------- Internals ------------------------------------
   private:
@@ -0,0 +1,200 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ParallelSurfelRange.h
+ * @brief Evaluates a quantity on a range of surfels with several
+ * threads, by chunks of surfels that are close in space.
+ *
+ * @date 2026/10/16
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see IntegralInvariantVolumeEstimator.h VCMDigitalSurfaceLocalEstimator.h
+ * LocalEstimatorFromSurfelFunctorAdapter.h
+ */
+
+#if defined(ParallelSurfelRange_RECURSES)
+#error Recursive header files inclusion detected in ParallelSurfelRange.h
+#else // defined(ParallelSurfelRange_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ParallelSurfelRange_RECURSES
+
+#if !defined ParallelSurfelRange_h
+/** Prevents repeated inclusion of headers. */
+#define ParallelSurfelRange_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/WorkStealingScheduler.h"
+#include "DGtal/images/Morton.h"
+#include "DGtal/topology/CCellularGridSpaceND.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+/////////////////////////////////////////////////////////////////////////////
+// template class ParallelSurfelRange
+/**
+   * Description of class 'ParallelSurfelRange' <p>
+   *
+   * Aim: Copies a range of surfels in the Morton order of their
+   * Khalimsky coordinates, so that consecutive surfels are close in
+   * space, and evaluates a quantity on them with
+   * WorkStealingScheduler, in the order of the initial range.
+   *
+   * The evaluation is given by a functor called on chunks of
+   * consecutive surfels (in Morton order), with the index of the
+   * calling thread. Each chunk is thus a compact piece of the
+   * surface, on which an estimator can keep its own state from a
+   * surfel to the next one (e.g. the displacement masks of
+   * DigitalSurfaceConvolver), and the thread index addresses its
+   * per-thread data (e.g. a copy of a stateful functor). This is how
+   * the estimators IntegralInvariantVolumeEstimator,
+   * IntegralInvariantCovarianceEstimator,
+   * VCMDigitalSurfaceLocalEstimator and
+   * LocalEstimatorFromSurfelFunctorAdapter evaluate ranges of
+   * surfels.
+   *
+   * @code
+   * ParallelSurfelRange< KSpace > range( K, surfels.begin(), surfels.end() );
+   * std::vector< double > areas;
+   * range.eval< double >
+   *   ( [&] ( ParallelSurfelRange< KSpace >::ConstIterator itb,
+   *           ParallelSurfelRange< KSpace >::ConstIterator ite,
+   *           std::vector< double >::iterator out, unsigned int )
+   *     { for ( ; itb != ite; ++itb ) *out++ = area( *itb ); },
+   *     std::back_inserter( areas ) );
+   * @endcode
+   *
+   * @tparam TKSpace a model of CCellularGridSpaceND.
+   */
+template< typename TKSpace >
+class ParallelSurfelRange
+{
+public:
+  typedef ParallelSurfelRange< TKSpace > Self;
+  typedef TKSpace KSpace;
+  BOOST_CONCEPT_ASSERT (( concepts::CCellularGridSpaceND< KSpace > ));
+
+  typedef typename KSpace::Point Point;
+  typedef typename KSpace::Surfel Surfel;
+  typedef std::vector< Surfel > Surfels;
+  typedef typename Surfels::const_iterator ConstIterator;
+  typedef DGtal::uint64_t Code;
+
+  // ----------------------- Standard services ------------------------------
+public:
+
+  /**
+   * Constructor. Copies the surfels and sorts them by Morton order.
+   *
+   * @tparam SurfelConstIterator a model of input iterator on surfels.
+   * @param[in] K the cellular grid space of the surfels.
+   * @param[in] itb an iterator on the first surfel.
+   * @param[in] ite an iterator after the last surfel.
+   */
+  template < typename SurfelConstIterator >
+  ParallelSurfelRange( const KSpace & K,
+                       SurfelConstIterator itb, SurfelConstIterator ite );
+
+  /// @return the number of surfels.
+  std::size_t size() const;
+
+  /// @return the surfels, in Morton order.
+  const Surfels & surfels() const;
+
+  /**
+   * @return the index, in the initial range, of each surfel of
+   * surfels().
+   */
+  const std::vector< std::size_t > & indices() const;
+
+  // ----------------------- Interface --------------------------------------
+public:
+
+  /**
+   * Evaluates a quantity on all the surfels, with
+   * WorkStealingScheduler::numberOfThreads() threads, and writes the
+   * values in the order of the initial range.
+   *
+   * @tparam TValue the type of the values, default constructible.
+   * @tparam ChunkEvaluator a functor with signature
+   * void( ConstIterator, ConstIterator,
+   * typename std::vector< TValue >::iterator, unsigned int ).
+   * @tparam OutputIterator a model of output iterator on values.
+   *
+   * @param[in] f the functor, which writes the values of the surfels
+   * [itb,ite) from the given iterator. It is called concurrently, with
+   * the index of the calling thread as last argument.
+   * @param[in] result the output iterator on values.
+   * @return the output iterator after the last value.
+   */
+  template < typename TValue, typename ChunkEvaluator, typename OutputIterator >
+  OutputIterator eval( ChunkEvaluator && f, OutputIterator result ) const;
+
+  /**
+   * Writes/Displays the object on an output stream.
+   * @param out the output stream where the object is written.
+   */
+  void selfDisplay ( std::ostream & out ) const;
+
+  /**
+   * Checks the validity/consistency of the object.
+   * @return 'true' if the object is valid, 'false' otherwise.
+   */
+  bool isValid() const;
+
+  // ------------------------- Private Datas --------------------------------
+private:
+
+  /// The surfels, in Morton order.
+  Surfels mySurfels;
+  /// The index in the initial range of each surfel of mySurfels.
+  std::vector< std::size_t > myIndices;
+
+}; // end of class ParallelSurfelRange
+
+/**
+ * Overloads 'operator<<' for displaying objects of class 'ParallelSurfelRange'.
+ * @param out the output stream where the object is written.
+ * @param object the object of class 'ParallelSurfelRange' to write.
+ * @return the output stream after the writing.
+ */
+template< typename TKSpace >
+std::ostream&
+operator<< ( std::ostream & out, const ParallelSurfelRange< TKSpace > & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/surfaces/estimation/ParallelSurfelRange.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ParallelSurfelRange_h
+
+#undef ParallelSurfelRange_RECURSES
+#endif // else defined(ParallelSurfelRange_RECURSES)
@@ -44,6 +44,7 @@
 #include "DGtal/base/Common.h"
 #include "DGtal/geometry/surfaces/estimation/VoronoiCovarianceMeasureOnDigitalSurface.h"
 #include "DGtal/geometry/surfaces/estimation/VCMGeometricFunctors.h"
+#include "DGtal/geometry/surfaces/estimation/ParallelSurfelRange.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -217,6 +218,9 @@ namespace DGtal
      * @param [in] ite end surfel iterator (within the range given at \ref init).
      * @param [in,out] result resulting output iterator
      *
+     * @note The surfels are evaluated in parallel (see
+     * ParallelSurfelRange), and the results are written in the order
+     * of the range.
      */
     template <typename SurfelConstIterator,typename OutputIterator>
     OutputIterator eval( SurfelConstIterator itb,
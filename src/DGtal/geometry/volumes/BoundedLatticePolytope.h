@@ -47,6 +47,7 @@
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/CSpace.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/LatticeSetByIntervals.h"
 #include "DGtal/arithmetic/IntegerComputer.h"
 #include "DGtal/arithmetic/ClosedIntegerHalfPlane.h"
 //////////////////////////////////////////////////////////////////////////////
@@ -84,6 +85,7 @@ namespace DGtal
     typedef std::vector<Integer>            InequalityVector;
     typedef HyperRectDomain< Space >        Domain; 
     typedef ClosedIntegerHalfPlane< Space > HalfSpace;
+    typedef LatticeSetByIntervals< Space >  LatticeSet;
 #ifdef WITH_BIGINTEGER
     typedef DGtal::BigInteger               BigInteger;
 #else
@@ -668,6 +670,32 @@ namespace DGtal
     template <typename PointSet>
     void insertPoints( PointSet& pts_set ) const;
 
+    /**
+     * Computes the integer points within the polytope, stored as one
+     * interval per row along the longest axis of its bounding box,
+     * without listing them.
+     *
+     * @return the set of integer points within the polytope.
+     *
+     * @note Quite fast: obtained by line intersection, see
+     * BoundedLatticePolytopeCounter
+     * @note At output, the returned set has size this->count()
+     */
+    LatticeSet getLatticeSet() const;
+
+    /**
+     * Computes the integer points interior to the polytope, stored
+     * as one interval per row along the longest axis of its bounding
+     * box, without listing them.
+     *
+     * @return the set of integer points interior to the polytope.
+     *
+     * @note Quite fast: obtained by line intersection, see
+     * BoundedLatticePolytopeCounter
+     * @note At output, the returned set has size this->countInterior()
+     */
+    LatticeSet getInteriorLatticeSet() const;
+
     /**
      * Computes the integer points within the polytope and converts
      * them to cells represented with their Khalimsky coordinates.
@@ -43,7 +43,10 @@
 // Inclusions
 #include <iostream>
 #include <map>
+#include <vector>
+#include "DGtal/base/WorkStealingScheduler.h"
 #include "DGtal/kernel/IntegralIntervals.h"
+#include "DGtal/kernel/LatticeSetByIntervals.h"
 #include "DGtal/geometry/volumes/BoundedLatticePolytope.h"
 //////////////////////////////////////////////////////////////////////////////
 
@@ -57,6 +60,15 @@ namespace DGtal
      \brief Aim: Useful to compute quickly the lattice points within a
      polytope, i.e. a convex polyhedron.
 
+     The lattice points are computed row by row along an axis: the
+     intersection of a row with the polytope is an interval, obtained
+     from the constraints of the polytope in a few divisions. The
+     constraints are grouped by sign of their coefficient along the
+     axis, so that each group is processed in a loop without
+     branches, and their affine forms are updated incrementally from a
+     row to the next. When there are at least #parallelThreshold
+     rows, they are split between the threads of WorkStealingScheduler.
+
      It is a model of boost::CopyConstructible,
      boost::DefaultConstructible, boost::Assignable. 
 
@@ -88,6 +100,12 @@ namespace DGtal
 
     /// Internal type used to represent any lattice point set.
     using LatticeSetByIntervals = std::map< Point, Intervals >;
+
+    /// The lattice point sets returned by getLatticeSetByIntervals.
+    using LatticeSet = DGtal::LatticeSetByIntervals< Space >;
+
+    /// The minimal number of rows for computing them on several threads.
+    static const std::size_t parallelThreshold = 4096;
     
     /// Default constructor
     BoundedLatticePolytopeCounter() = default;
@@ -170,11 +188,50 @@ namespace DGtal
     /// @see longestAxis
     void getInteriorPointsAlongAxis( PointRange& pts, Dimension a ) const;
 
+    /// Calls \a f( row, p, I, thread ) for each row of the bounding
+    /// box along axis \a a, where \a row is the index of the row in
+    /// the order of the domain of the rows, \a p its point with
+    /// coordinate \a a equal to the lowest one of the bounding box,
+    /// \a I its intersection `[b,e)` with the polytope (or its
+    /// interior) as in intersectionIntervalAlongAxis, and \a thread
+    /// the index of the calling thread in [0,
+    /// WorkStealingScheduler::numberOfThreads()). The rows are
+    /// processed on several threads when there are at least
+    /// #parallelThreshold of them.
+    ///
+    /// @tparam TFunctor a functor ( std::size_t, const Point &, const Interval &, unsigned int ),
+    /// that may be called concurrently on different rows.
+    ///
+    /// @param a any axis with 0 <= a < d, where d is the dimension of the space.
+    /// @param interior when 'true', intersects the rows with the
+    /// interior of the polytope.
+    /// @param f the functor.
+    template <typename TFunctor>
+    void forEachIntervalAlongAxis( Dimension a, bool interior, TFunctor f ) const;
+
+    /// @param[out] rows the intersection `[b,e)` of each row along
+    /// axis \a a with the polytope (or its interior), in the order of
+    /// the domain of the rows (see forEachIntervalAlongAxis).
+    /// @param a any axis with 0 <= a < d, where d is the dimension of the space.
+    /// @param interior when 'true', intersects the rows with the
+    /// interior of the polytope.
+    void getIntervalsAlongAxis( std::vector< Interval >& rows,
+                                Dimension a, bool interior = false ) const;
+
+    /// @param a any axis with 0 <= a < d, where d is the dimension of the space.
+    /// @param interior when 'true', only the lattice points interior
+    /// to the polytope are returned.
+    ///
+    /// @return the set of lattice points within the current polytope
+    /// (or its interior), stored by rows along axis \a a, without
+    /// listing its points.
+    LatticeSet getLatticeSetByIntervals( Dimension a, bool interior = false ) const;
+
     /// @param a any axis with 0 <= a < d, where d is the dimension of the space.
     ///
     /// @return the set of lattice points within the current polytope,
     /// represented as intervals along the given rows specified by the
-    /// axis.
+    /// axis. Each interval is closed and empty rows are omitted.
     LatticeSetByInterval getLatticeSet( Dimension a ) const;
 
     /// @param a any axis with 0 <= a < d, where d is the dimension of the space.
@@ -206,6 +263,49 @@ namespace DGtal
     Point myLower;
     /// The upper point of the tight bounding box to the associated polytope. 
     Point myUpper;
+
+    // --------------------------- internals -----------------------------------
+  protected:
+    /// The constraints of the polytope that are not the ones of its
+    /// bounding box, prepared for computing the intervals along some
+    /// axis \a a. They are sorted in three groups, according to
+    /// the sign of their coefficient along \a a, and each group is
+    /// stored as contiguous arrays.
+    struct RowConstraints
+    {
+      /// Number of constraints parallel to the axis, with a positive
+      /// coefficient, with a negative coefficient (in this order).
+      std::size_t nbParallel, nbPositive, nbNegative;
+      /// The constant part of the bound of each constraint.
+      std::vector< Integer > num;
+      /// The divisor of each constraint (1 if parallel).
+      std::vector< Integer > den;
+      /// The affine form of each constraint at the first point of the first row.
+      std::vector< Integer > start;
+      /// `cols[ j ][ k ]` is the coefficient along axis j of constraint k.
+      std::vector< std::vector< Integer > > cols;
+    };
+
+    /// @param a any axis with 0 <= a < d, where d is the dimension of the space.
+    /// @param interior when 'true', the constraints are made strict.
+    /// @return the constraints of the polytope prepared for rows along axis \a a.
+    RowConstraints rowConstraints( Dimension a, bool interior ) const;
+
+    /// Appends the lattice points within the polytope (or its
+    /// interior) to \a pts, row by row along axis \a a.
+    /// @param[in,out] pts the range where points are appended.
+    /// @param a any axis with 0 <= a < d, where d is the dimension of the space.
+    /// @param interior when 'true', only the interior points are appended.
+    void appendPointsAlongAxis( PointRange& pts, Dimension a, bool interior ) const;
+
+    /// @param a any axis with 0 <= a < d, where d is the dimension of the space.
+    /// @return the number of rows of the bounding box along axis \a a.
+    std::size_t nbRowsAlongAxis( Dimension a ) const;
+
+    /// @param row the index of a row along axis \a a.
+    /// @param a any axis with 0 <= a < d, where d is the dimension of the space.
+    /// @return the first point of the row.
+    Point rowPoint( std::size_t row, Dimension a ) const;
   };
 
 } // namespace DGtal
@@ -0,0 +1,461 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file BucketFMM.h
+ * @brief Fast marching method with a bucketed priority queue.
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module BucketFMM.ih
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see FMM.h
+ * @see testFMM.cpp
+ */
+
+#if defined(BucketFMM_RECURSES)
+#error Recursive header files inclusion detected in BucketFMM.h
+#else // defined(BucketFMM_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define BucketFMM_RECURSES
+
+#if !defined BucketFMM_h
+/** Prevents repeated inclusion of headers. */
+#define BucketFMM_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <limits>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/kernel/domains/Linearizer.h"
+#include "DGtal/geometry/volumes/distance/FMM.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class BucketFMM
+  /**
+   * Description of template class 'BucketFMM' <p>
+   * \brief Aim: Fast Marching Method (FMM) for nd distance transforms,
+   * with a bucketed priority queue and flat storage.
+   *
+   * This class has the same interface and the same parameters as
+   * FMM (the point functors and the static init functions of FMM
+   * are used in the same way), but the candidate points are stored
+   * in an untidy priority queue: a ring of buckets of width @a w,
+   * indexed by the bucket number modulo the size of the ring, the
+   * candidates of a bucket being processed in any order. The ring
+   * only grows when a candidate falls beyond its last bucket, so that
+   * its size depends on the range of the tentative values and not on
+   * the distances reached so far. The status (far, candidate or
+   * accepted) and the tentative value of the points are stored in
+   * flat pages indexed by the linearized points of the image domain
+   * (see Linearizer). A page is only allocated when the propagation
+   * reaches one of its points, so that each step is in constant time,
+   * without any tree operation or hashing, and the memory is
+   * proportional to the region swept by the propagation.
+   *
+   * If the value computed by the point functor at a point is
+   * greater than the values of the accepted neighbors used for its
+   * computation by at least @a w, the accepted values are the ones
+   * of FMM. This is the case for L1LocalDistance and
+   * LInfLocalDistance with the default width, @f$ 1/(2d) @f$. This
+   * is not guaranteed for L2FirstOrderLocalDistance: the points are
+   * accepted in an order that differs from the one of FMM within a
+   * bucket, which may result in slight differences in the values,
+   * the smaller the width, the closer to FMM.
+   *
+   * @tparam TImage any model of CImage, whose domain is a HyperRectDomain
+   * @tparam TSet any model of CDigitalSet
+   * @tparam TPointPredicate any model of concepts::CPointPredicate,
+   * used to bound the computation within a domain
+   * @tparam TPointFunctor any model of CPointFunctor,
+   * used to compute the new distance value
+   *
+   * @see FMM
+   * @see FastIterativeMethod
+   */
+  template <typename TImage, typename TSet, typename TPointPredicate,
+            typename TPointFunctor = L2FirstOrderLocalDistance<TImage,TSet> >
+  class BucketFMM
+  {
+
+    // ----------------------- Types ------------------------------
+  public:
+
+    typedef FMM<TImage, TSet, TPointPredicate, TPointFunctor> Reference;
+
+    typedef typename Reference::Image Image;
+    typedef typename Reference::AcceptedPointSet AcceptedPointSet;
+    typedef typename Reference::PointPredicate PointPredicate;
+    typedef typename Reference::Point Point;
+    typedef typename Reference::Dimension Dimension;
+    typedef typename Reference::PointFunctor PointFunctor;
+    typedef typename Reference::Value Value;
+    typedef typename Image::Domain Domain;
+    typedef DGtal::uint64_t Area;
+
+    BOOST_STATIC_ASSERT(( boost::is_same< Domain,
+                          HyperRectDomain<typename Domain::Space> >::value ));
+
+  private:
+
+    typedef typename Linearizer<Domain>::Size Index;
+
+    /// Status of the points
+    enum State : unsigned char { Far = 0, Candidate = 1, Accepted = 2 };
+
+    /// Status and tentative value of a point
+    struct PointData
+    {
+      unsigned char state;
+      Value value;
+    };
+
+    /// Binary logarithm of the number of points of a page
+    static const unsigned int PageShift = 12;
+
+    /// Candidate (index and tentative value)
+    typedef std::pair<Index, Value> IndexValue;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// Reference on the image
+    Image& myImage;
+
+    /// Reference on the set of accepted points
+    AcceptedPointSet& myAcceptedPoints;
+
+    /// Pointer on the point functor
+    PointFunctor* myPointFunctorPtr;
+
+    /// 'true' if @a myPointFunctorPtr is an owning pointer
+    const bool myFlagIsOwning;
+
+    /// Constant reference on the point predicate bounding the computation
+    const PointPredicate& myPointPredicate;
+
+    /// Area threshold (in number of accepted points)
+    Area myAreaThreshold;
+
+    /// Value threshold above which the propagation stops
+    Value myValueThreshold;
+
+    /// Min value
+    Value myMinValue;
+
+    /// Max value
+    Value myMaxValue;
+
+    /// Copy of the image domain
+    Domain myDomain;
+
+    /// Extent of the image domain
+    Point myExtent;
+
+    /// Pages of point data, empty until a point of the page is reached
+    std::vector< std::vector<PointData> > myPages;
+
+    /// Width of the buckets
+    double myBucketWidth;
+
+    /// Ring of buckets of candidates (its size is a power of two)
+    std::vector< std::vector<IndexValue> > myBuckets;
+
+    /// Number of the current bucket
+    std::size_t myCurrentBucket;
+
+    /// Number of candidates (including stale entries)
+    std::size_t myNbCandidates;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     *
+     * @param aImg the distance image
+     * @param aSet the set of accepted points
+     * @param aPointPredicate the point predicate bounding the computation
+     * @param aBucketWidth the width of the buckets
+     */
+    BucketFMM(Image& aImg, AcceptedPointSet& aSet,
+              ConstAlias<PointPredicate> aPointPredicate,
+              double aBucketWidth = defaultBucketWidth());
+
+    /**
+     * Constructor.
+     *
+     * @param aImg the distance image
+     * @param aSet the set of accepted points
+     * @param aPointPredicate the point predicate bounding the computation
+     * @param aAreaThreshold the area threshold
+     * @param aValueThreshold the value threshold
+     * @param aBucketWidth the width of the buckets
+     */
+    BucketFMM(Image& aImg, AcceptedPointSet& aSet,
+              ConstAlias<PointPredicate> aPointPredicate,
+              const Area& aAreaThreshold, const Value& aValueThreshold,
+              double aBucketWidth = defaultBucketWidth());
+
+    /**
+     * Constructor.
+     *
+     * @param aImg the distance image
+     * @param aSet the set of accepted points
+     * @param aPointPredicate the point predicate bounding the computation
+     * @param aPointFunctor the point functor
+     * @param aBucketWidth the width of the buckets
+     */
+    BucketFMM(Image& aImg, AcceptedPointSet& aSet,
+              ConstAlias<PointPredicate> aPointPredicate,
+              PointFunctor& aPointFunctor,
+              double aBucketWidth = defaultBucketWidth());
+
+    /**
+     * Constructor.
+     *
+     * @param aImg the distance image
+     * @param aSet the set of accepted points
+     * @param aPointPredicate the point predicate bounding the computation
+     * @param aAreaThreshold the area threshold
+     * @param aValueThreshold the value threshold
+     * @param aPointFunctor the point functor
+     * @param aBucketWidth the width of the buckets
+     */
+    BucketFMM(Image& aImg, AcceptedPointSet& aSet,
+              ConstAlias<PointPredicate> aPointPredicate,
+              const Area& aAreaThreshold, const Value& aValueThreshold,
+              PointFunctor& aPointFunctor,
+              double aBucketWidth = defaultBucketWidth());
+
+    /**
+     * Destructor.
+     */
+    ~BucketFMM();
+
+    /**
+     * Copy constructor.
+     * Forbidden.
+     */
+    BucketFMM ( const BucketFMM & other ) = delete;
+
+    /**
+     * Assignment.
+     * Forbidden.
+     */
+    BucketFMM & operator= ( const BucketFMM & other ) = delete;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * @return the default width of the buckets, @f$ 1/(2d) @f$.
+     */
+    static double defaultBucketWidth();
+
+    /**
+     * @return the width of the buckets.
+     */
+    double bucketWidth() const;
+
+    /**
+     * Computation of the signed distance function by marching out
+     * from the initial set of accepted points.
+     *
+     * @see computeOneStep
+     */
+    void compute();
+
+    /**
+     * Inserts a candidate of the first non-empty bucket into the set
+     * of accepted points if it is possible and then updates the
+     * tentative values of its neighbors.
+     *
+     * @param aPoint inserted point (if inserted)
+     * @param aValue its distance value (if inserted)
+     *
+     * @return 'true' if a point is accepted, 'false' otherwise.
+     */
+    bool computeOneStep(Point& aPoint, Value& aValue);
+
+    /**
+     * @return minimal distance value in the set of accepted points.
+     */
+    Value min() const;
+
+    /**
+     * @return maximal distance value in the set of accepted points.
+     */
+    Value max() const;
+
+    /**
+     * Computes the minimal distance value in the set of accepted points.
+     * @return minimal distance value.
+     */
+    Value getMin() const;
+
+    /**
+     * Computes the maximal distance value in the set of accepted points.
+     * @return maximal distance value.
+     */
+    Value getMax() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- static functions for init --------------------
+
+    /**
+     * See FMM::initFromPointsRange.
+     */
+    template <typename TIteratorOnPoints>
+    static void initFromPointsRange(const TIteratorOnPoints& itb, const TIteratorOnPoints& ite,
+                                    Image& aImg, AcceptedPointSet& aSet,
+                                    const Value& aValue)
+    {
+      Reference::initFromPointsRange( itb, ite, aImg, aSet, aValue );
+    }
+
+    /**
+     * See FMM::initFromBelsRange.
+     */
+    template <typename KSpace, typename TIteratorOnBels>
+    static void initFromBelsRange(const KSpace& aK,
+                                  const TIteratorOnBels& itb, const TIteratorOnBels& ite,
+                                  Image& aImg, AcceptedPointSet& aSet,
+                                  const Value& aValue,
+                                  bool aFlagIsPositive = true)
+    {
+      Reference::initFromBelsRange( aK, itb, ite, aImg, aSet, aValue, aFlagIsPositive );
+    }
+
+    /**
+     * See FMM::initFromBelsRange.
+     */
+    template <typename KSpace, typename TIteratorOnBels, typename TImplicitFunction>
+    static void initFromBelsRange(const KSpace& aK,
+                                  const TIteratorOnBels& itb, const TIteratorOnBels& ite,
+                                  const TImplicitFunction& aF,
+                                  Image& aImg, AcceptedPointSet& aSet,
+                                  bool aFlagIsPositive = true)
+    {
+      Reference::initFromBelsRange( aK, itb, ite, aF, aImg, aSet, aFlagIsPositive );
+    }
+
+    /**
+     * See FMM::initFromIncidentPointsRange.
+     */
+    template <typename TIteratorOnPairs>
+    static void initFromIncidentPointsRange(const TIteratorOnPairs& itb, const TIteratorOnPairs& ite,
+                                            Image& aImg, AcceptedPointSet& aSet,
+                                            const Value& aValue,
+                                            bool aFlagIsPositive = true)
+    {
+      Reference::initFromIncidentPointsRange( itb, ite, aImg, aSet, aValue, aFlagIsPositive );
+    }
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Initializes the pages, the ring of buckets and the candidates.
+     */
+    void init();
+
+    /**
+     * @param anIndex the linearized index of a point of the domain.
+     * @return a reference on the data of the point, whose page is
+     * allocated if needed.
+     */
+    PointData& pointData(Index anIndex);
+
+    /**
+     * Grows the ring of buckets so that it holds at least @a aNbBuckets
+     * buckets from the current one, keeping the queued candidates.
+     *
+     * @param aNbBuckets the required number of buckets.
+     */
+    void growBuckets(std::size_t aNbBuckets);
+
+    /**
+     * @param aValue any value.
+     * @return the bucket of @a aValue.
+     */
+    std::size_t bucket(const Value& aValue) const;
+
+    /**
+     * Computes the tentative values of the neighbors of @a aPoint.
+     *
+     * @param aPoint an accepted point.
+     */
+    void update(const Point& aPoint);
+
+    /**
+     * Computes the tentative value of a point and pushes it into
+     * the queue if it is within the computation domain, not yet
+     * accepted and if its value decreased.
+     *
+     * @param aPoint any point
+     */
+    void addNewCandidate(const Point& aPoint);
+
+  }; // end of class BucketFMM
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'BucketFMM'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'BucketFMM' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TImage, typename TSet, typename TPointPredicate, typename TPointFunctor >
+  std::ostream&
+  operator<< ( std::ostream & out, const BucketFMM<TImage, TSet, TPointPredicate, TPointFunctor> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/volumes/distance/BucketFMM.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined BucketFMM_h
+
+#undef BucketFMM_RECURSES
+#endif // else defined(BucketFMM_RECURSES)
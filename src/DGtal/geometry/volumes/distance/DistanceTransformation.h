@@ -44,6 +44,7 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <limits>
 #include <vector>
 #include "DGtal/kernel/NumberTraits.h"
 #include "DGtal/kernel/CPointPredicate.h"
@@ -71,7 +72,24 @@ namespace DGtal
    * for the considered metric.
    *
    * Please refer to VoronoiMap documentation for details on the
-   * computational cost and parameter description.
+   * computational cost and parameter description. In particular,
+   * the Voronoi map may be stored with linearized site indices
+   * (see VoronoiMap) to reduce the memory footprint, and it can be
+   * repaired after local edits of the sites with VoronoiMap::update.
+   *
+   * When only the distances are needed, computeRawDistances runs
+   * the construction and writes the raw distances (see
+   * concepts::CSeparableMetric, e.g. squared distances for @f$ l_2
+   * @f$) into an image during the last step, instead of storing the
+   * Voronoi map. For the exact @f$ l_2 @f$ metric (and a
+   * non-periodic last dimension), only the sites of one slab are
+   * stored at a time, the first steps leaving one raw value per
+   * point:
+   * @code
+   * ImageContainerBySTLVector<Z3i::Domain, DGtal::uint32_t> squaredDistances( domain );
+   * DistanceTransformation<Z3i::Space, Predicate, L2Metric>::computeRawDistances
+   *   ( domain, predicate, l2, squaredDistances );
+   * @endcode
    *
    * This class is a model of concepts::CConstImage.
    *
@@ -82,7 +100,8 @@ namespace DGtal
    * @tparam TImageContainer any model of concepts::CImage to store the
    * VoronoiMap (default: ImageContainerBySTLVector). The space of the
    * image container and the TSpace should match. Furthermore the
-   * container value type must be TSpace::Vector.
+   * container value type must be TSpace::Vector (or an unsigned
+   * integer type, see VoronoiMap).
     *
    * @see distancetransform2D.cpp
    * @see distancetransform3D.cpp
@@ -124,9 +143,9 @@ namespace DGtal
                          typename SeparableMetric::Point>::value));
 
     ///Definition of the image.
-    typedef  DistanceTransformation<TSpace,TPointPredicate,TSeparableMetric> Self;
+    typedef  DistanceTransformation<TSpace,TPointPredicate,TSeparableMetric,TImageContainer> Self;
 
-    typedef VoronoiMap<TSpace,TPointPredicate,TSeparableMetric> Parent;
+    typedef VoronoiMap<TSpace,TPointPredicate,TSeparableMetric,TImageContainer> Parent;
 
     ///Definition of the image constRange
     typedef  DefaultConstImageRange<Self> ConstRange;
@@ -169,6 +188,81 @@ namespace DGtal
      */
     ~DistanceTransformation() {};
 
+    /**
+     * Computes the raw distances (see
+     * concepts::CSeparableMetric::rawDistance) to the closest sites
+     * and writes them into an image, in the last step of the
+     * construction. The full Voronoi map is only kept during the
+     * construction, but for the exact @f$ l_2 @f$ metric with a
+     * non-periodic last dimension (see computeRawDistancesBySlabs).
+     * Points without site (empty predicate) get the maximal value of
+     * the image value type.
+     *
+     * @tparam TRawImage a model of concepts::CImage whose value type
+     * can be converted from SeparableMetric::RawValue (e.g. float or
+     * DGtal::uint32_t for the exact @f$ l_2 @f$ metric, as long as
+     * the squared distances fit).
+     * @param aDomain the (hyper-rectangular) domain on which the
+     * computation is performed.
+     * @param predicate the point predicate to define the Voronoi
+     * sites (false points).
+     * @param aMetric the separable metric instance.
+     * @param aRawImage the output image, defined on (at least) @a aDomain.
+     */
+    template <typename TRawImage>
+    static void computeRawDistances(ConstAlias<Domain> aDomain,
+                                    ConstAlias<PointPredicate> predicate,
+                                    ConstAlias<SeparableMetric> aMetric,
+                                    TRawImage & aRawImage)
+    {
+      typename Parent::PeriodicitySpec periodicity;
+      periodicity.fill( false );
+      computeRawDistances( aDomain, predicate, aMetric, periodicity, aRawImage );
+    }
+
+    /**
+     * Computes the raw distances to the closest sites with
+     * periodicity specification and writes them into an image (see
+     * computeRawDistances above).
+     *
+     * @tparam TRawImage a model of concepts::CImage.
+     * @param aDomain the (hyper-rectangular) domain on which the
+     * computation is performed.
+     * @param predicate the point predicate to define the Voronoi
+     * sites (false points).
+     * @param aMetric the separable metric instance.
+     * @param aPeriodicitySpec the periodicity specification.
+     * @param aRawImage the output image, defined on (at least) @a aDomain.
+     */
+    template <typename TRawImage>
+    static void computeRawDistances(ConstAlias<Domain> aDomain,
+                                    ConstAlias<PointPredicate> predicate,
+                                    ConstAlias<SeparableMetric> aMetric,
+                                    typename Parent::PeriodicitySpec const & aPeriodicitySpec,
+                                    TRawImage & aRawImage)
+    {
+      BOOST_CONCEPT_ASSERT(( concepts::CImage< TRawImage > ));
+      typedef typename TRawImage::Value RawImageValue;
+
+      const typename Space::Dimension last = Space::dimension - 1;
+      if constexpr ( detail::IsExactL2SeparableMetric<SeparableMetric>::value )
+        if ( ! aPeriodicitySpec[ last ] )
+          {
+            computeRawDistancesBySlabs( aDomain, predicate, aMetric, aPeriodicitySpec, aRawImage );
+            return;
+          }
+
+      const Self partial( aDomain, predicate, aMetric, aPeriodicitySpec, last );
+      const SeparableMetric & metric = *partial.myMetricPtr;
+      const Point & infinity = partial.myInfinity;
+      partial.computeOtherSteps( last, [&] ( const Point & aPoint, const Point & aSite )
+        {
+          aRawImage.setValue( aPoint, aSite == infinity
+                              ? std::numeric_limits<RawImageValue>::max()
+                              : static_cast<RawImageValue>( metric.rawDistance( aPoint, aSite ) ) );
+        } );
+    }
+
     // ------------------- Private functions ------------------------
   public:
 
@@ -198,8 +292,7 @@ namespace DGtal
      */
     Value operator()(const Point &aPoint) const
     {
-      return this->myMetricPtr->operator()(aPoint,
-                                           this->myImagePtr->operator()(aPoint));
+      return this->myMetricPtr->operator()(aPoint, Parent::operator()(aPoint));
     }
 
     /**
@@ -210,7 +303,7 @@ namespace DGtal
      */
     Vector getVoronoiSite(const Point &aPoint) const
     {
-      return this->myImagePtr->operator()(aPoint);
+      return Parent::operator()(aPoint);
     }
 
     /**
@@ -236,12 +329,144 @@ namespace DGtal
     // ------------------- protected methods ------------------------
   protected:
 
+    /// Voronoi map of a slab, with the default (vector) storage.
+    typedef DistanceTransformation<TSpace,TPointPredicate,TSeparableMetric> SlabMap;
+
+    template <typename, typename, typename, typename>
+    friend class DistanceTransformation;
+
+    /**
+     * Computes the raw distances for the exact @f$ l_2 @f$ metric
+     * when the last dimension is not periodic (see
+     * computeRawDistances).
+     *
+     * The first steps are run slab by slab (a slab being the points
+     * with the same last coordinate), so that only the sites of one
+     * slab are stored. The squared distance of each point to its
+     * closest site in its slab is kept in a buffer of
+     * SeparableMetric::RawValue, and the last step is run on this
+     * buffer by the line-batched engine detail::VoronoiMapLineBatch.
+     *
+     * @tparam TRawImage a model of concepts::CImage.
+     * @param aDomain the (hyper-rectangular) domain.
+     * @param predicate the point predicate.
+     * @param aMetric the separable metric instance.
+     * @param aPeriodicitySpec the periodicity specification.
+     * @param aRawImage the output image, defined on (at least) @a aDomain.
+     */
+    template <typename TRawImage>
+    static void computeRawDistancesBySlabs(const Domain & aDomain,
+                                           const PointPredicate & predicate,
+                                           const SeparableMetric & aMetric,
+                                           typename Parent::PeriodicitySpec const & aPeriodicitySpec,
+                                           TRawImage & aRawImage)
+    {
+      typedef typename TRawImage::Value RawImageValue;
+      typedef typename SeparableMetric::RawValue RawValue;
+      typedef detail::VoronoiMapLineBatch<Point, RawValue> Engine;
+
+      const typename Space::Dimension last = Space::dimension - 1;
+      const RawValue noSite = NumberTraits<RawValue>::max();
+      const Point lower  = aDomain.lowerBound();
+      const Point upper  = aDomain.upperBound();
+      const Point extent = upper - lower + Point::diagonal( 1 );
+
+      Point slabExtent = extent;
+      slabExtent[ last ] = 1;
+      std::size_t slabSize = 1;
+      for ( typename Space::Dimension i = 0; i < last; ++i )
+        slabSize *= static_cast<std::size_t>( extent[ i ] );
+      const std::size_t nbSlabs = static_cast<std::size_t>( extent[ last ] );
+
+      // Squared distance to the closest site in the slab.
+      std::vector<RawValue> heights( slabSize * nbSlabs );
+      for ( std::size_t z = 0; z < nbSlabs; ++z )
+        {
+          Point slabLower = lower;
+          Point slabUpper = upper;
+          slabLower[ last ] = slabUpper[ last ] = lower[ last ] + static_cast<typename Point::Coordinate>( z );
+          RawValue * slabHeights = heights.data() + z * slabSize;
+
+          if ( last == 0 )
+            {
+              slabHeights[ 0 ] = predicate( slabLower ) ? noSite : NumberTraits<RawValue>::ZERO;
+              continue;
+            }
+
+          const Domain slabDomain( slabLower, slabUpper );
+          const SlabMap slab( slabDomain, predicate, aMetric, aPeriodicitySpec, last );
+          const Point * sites = slab.myImagePtr->data();
+          WorkStealingScheduler::forEach( slabSize,
+            [&] ( std::size_t first, std::size_t end, unsigned int )
+            {
+              for ( std::size_t i = first; i < end; ++i )
+                slabHeights[ i ] = sites[ i ] == slab.myInfinity
+                  ? noSite
+                  : aMetric.rawDistance( Linearizer<Domain>::getPoint( i, slabLower, slabExtent ), sites[ i ] );
+            } );
+        }
+
+      // Last step: lines along the last dimension, by tiles along
+      // the first one.
+      Point startExtent = slabExtent;
+      startExtent[ 0 ] = 1;
+      std::size_t nbRows = 1;
+      for ( typename Space::Dimension i = 0; i < Space::dimension; ++i )
+        nbRows *= static_cast<std::size_t>( startExtent[ i ] );
+      const std::size_t rowLength = last == 0 ? 1 : static_cast<std::size_t>( extent[ 0 ] );
+
+      const auto writer = [&aRawImage] ( const Point & aPoint, const RawValue & aRawDistance )
+        {
+          aRawImage.setValue( aPoint, aRawDistance == NumberTraits<RawValue>::max()
+                              ? std::numeric_limits<RawImageValue>::max()
+                              : static_cast<RawImageValue>( aRawDistance ) );
+        };
+
+      const unsigned int nbThreads = WorkStealingScheduler::numberOfThreads();
+      std::vector<Engine> engines( nbThreads, Engine( Point::diagonal( 0 ) ) );
+      WorkStealingScheduler::forEach( nbRows, nbThreads,
+        [&] ( std::size_t first, std::size_t end, unsigned int thread )
+        {
+          for ( std::size_t r = first; r < end; ++r )
+            {
+              Point rowStart = Linearizer<Domain>::getPoint( r, lower, startExtent );
+              const std::size_t offset = Linearizer<Domain>::getIndex( rowStart, lower, extent );
+              for ( std::size_t x = 0; x < rowLength; x += Engine::batchSize )
+                {
+                  Point tileStart = rowStart;
+                  tileStart[ 0 ] += static_cast<typename Point::Coordinate>( x );
+                  engines[ thread ].processHeights( heights.data() + offset + x,
+                                                    std::min( Engine::batchSize, rowLength - x ),
+                                                    slabSize, nbSlabs, tileStart, last, writer );
+                }
+            }
+        } );
+    }
+
     /**
      * Default Constructor.
      *
      */
     DistanceTransformation();
 
+    /**
+     * Constructor running only the first steps of the construction
+     * (see computeRawDistances).
+     *
+     * @param aDomain the (hyper-rectangular) domain.
+     * @param predicate the point predicate.
+     * @param aMetric the separable metric instance.
+     * @param aPeriodicitySpec the periodicity specification.
+     * @param nbSteps the number of steps to process.
+     */
+    DistanceTransformation(ConstAlias<Domain> aDomain,
+                           ConstAlias<PointPredicate> predicate,
+                           ConstAlias<SeparableMetric> aMetric,
+                           typename Parent::PeriodicitySpec const & aPeriodicitySpec,
+                           const typename Space::Dimension nbSteps)
+      : Parent(aDomain, predicate, aMetric, aPeriodicitySpec, nbSteps)
+    {}
+
 
     // ------------------- Private members ------------------------
   private:
@@ -252,11 +477,11 @@ namespace DGtal
 // //                                                                           //
 // ///////////////////////////////////////////////////////////////////////////////
 
-  template <typename S,typename P,typename TSep>
+  template <typename S,typename P,typename TSep,typename TI>
   inline
   std::ostream&
   operator<< ( std::ostream & out,
-               const DistanceTransformation<S,P,TSep> & object )
+               const DistanceTransformation<S,P,TSep,TI> & object )
   {
     object.selfDisplay( out );
     return out;
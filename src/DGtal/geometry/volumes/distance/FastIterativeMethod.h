@@ -0,0 +1,423 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file FastIterativeMethod.h
+ * @brief Multi-threaded iterative solver computing the same distance
+ * maps as FMM.
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module FastIterativeMethod.ih
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see FMM.h
+ * @see testFMM.cpp
+ */
+
+#if defined(FastIterativeMethod_RECURSES)
+#error Recursive header files inclusion detected in FastIterativeMethod.h
+#else // defined(FastIterativeMethod_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define FastIterativeMethod_RECURSES
+
+#if !defined FastIterativeMethod_h
+/** Prevents repeated inclusion of headers. */
+#define FastIterativeMethod_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <limits>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/base/WorkStealingScheduler.h"
+#include "DGtal/kernel/domains/Linearizer.h"
+#include "DGtal/geometry/volumes/distance/FMM.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class FastIterativeMethod
+  /**
+   * Description of template class 'FastIterativeMethod' <p>
+   * \brief Aim: Fast Iterative Method (FIM) for nd distance
+   * transforms, which is a multi-threaded alternative to FMM.
+   *
+   * Like FMM, this class extends a signed distance map, stored in an
+   * image and whose known points are stored in a set, by means of a
+   * point functor (e.g. L2FirstOrderLocalDistance) computing the
+   * value of a point from the values of its 1-neighbors. The points
+   * of the initial set are never modified.
+   *
+   * Instead of accepting the points one by one in increasing order
+   * of their values, the values of a list of active points are
+   * updated in rounds until convergence. Each round has two phases:
+   * - the new values of all the active points are computed in
+   * parallel (see WorkStealingScheduler), each thread using its own
+   * copy of the point functor. The image and the set are only read
+   * during this phase, so that no lock is needed.
+   * - the values that decreased (in absolute value) by more than a
+   * given tolerance are then written into the image (the points are
+   * inserted into the set if required) and the neighbors of these
+   * points become the active points of the next round.
+   *
+   * The flags of the points (seed, known, active) are stored in flat
+   * pages indexed by the linearized points of the image domain (see
+   * Linearizer). A page is only allocated when the propagation reaches
+   * one of its points, so that the memory is proportional to the
+   * region swept by the propagation rather than to the domain.
+   *
+   * The result converges towards the one of FMM, up to the
+   * tolerance. Only the points whose (absolute) value is below
+   * the value threshold are inserted into the set. Since the points
+   * are not accepted in increasing order, there is no area threshold.
+   *
+   * @tparam TImage any model of CImage, whose domain is a HyperRectDomain
+   * @tparam TSet any model of CDigitalSet
+   * @tparam TPointPredicate any model of concepts::CPointPredicate,
+   * used to bound the computation within a domain
+   * @tparam TPointFunctor any model of CPointFunctor (copy
+   * constructible), used to compute the new distance value
+   *
+   * @see FMM
+   * @see BucketFMM
+   */
+  template <typename TImage, typename TSet, typename TPointPredicate,
+            typename TPointFunctor = L2FirstOrderLocalDistance<TImage,TSet> >
+  class FastIterativeMethod
+  {
+
+    // ----------------------- Types ------------------------------
+  public:
+
+    typedef FMM<TImage, TSet, TPointPredicate, TPointFunctor> Reference;
+
+    typedef typename Reference::Image Image;
+    typedef typename Reference::AcceptedPointSet AcceptedPointSet;
+    typedef typename Reference::PointPredicate PointPredicate;
+    typedef typename Reference::Point Point;
+    typedef typename Reference::Dimension Dimension;
+    typedef typename Reference::PointFunctor PointFunctor;
+    typedef typename Reference::Value Value;
+    typedef typename Image::Domain Domain;
+
+    BOOST_STATIC_ASSERT(( boost::is_same< Domain,
+                          HyperRectDomain<typename Domain::Space> >::value ));
+
+  private:
+
+    typedef typename Linearizer<Domain>::Size Index;
+
+    /// Flags of the points
+    enum Flag : unsigned char { Seed = 1, Known = 2, Active = 4 };
+
+    /// Binary logarithm of the number of points of a page
+    static const unsigned int PageShift = 12;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// Reference on the image
+    Image& myImage;
+
+    /// Reference on the set of accepted points
+    AcceptedPointSet& myAcceptedPoints;
+
+    /// Pointer on the point functor
+    PointFunctor* myPointFunctorPtr;
+
+    /// 'true' if @a myPointFunctorPtr is an owning pointer
+    const bool myFlagIsOwning;
+
+    /// Constant reference on the point predicate bounding the computation
+    const PointPredicate& myPointPredicate;
+
+    /// Value threshold above which the propagation stops
+    Value myValueThreshold;
+
+    /// Tolerance below which a decrease of value is ignored
+    Value myTolerance;
+
+    /// Min value
+    Value myMinValue;
+
+    /// Max value
+    Value myMaxValue;
+
+    /// Copy of the image domain
+    Domain myDomain;
+
+    /// Extent of the image domain
+    Point myExtent;
+
+    /// Pages of flags, empty until a point of the page is reached
+    std::vector< std::vector<unsigned char> > myFlagPages;
+
+    /// Active points
+    std::vector<Index> myActivePoints;
+
+    /// Number of rounds done so far
+    std::size_t myNbRounds;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     *
+     * @param aImg the distance image
+     * @param aSet the set of accepted points
+     * @param aPointPredicate the point predicate bounding the computation
+     */
+    FastIterativeMethod(Image& aImg, AcceptedPointSet& aSet,
+                        ConstAlias<PointPredicate> aPointPredicate);
+
+    /**
+     * Constructor.
+     *
+     * @param aImg the distance image
+     * @param aSet the set of accepted points
+     * @param aPointPredicate the point predicate bounding the computation
+     * @param aValueThreshold the value threshold
+     */
+    FastIterativeMethod(Image& aImg, AcceptedPointSet& aSet,
+                        ConstAlias<PointPredicate> aPointPredicate,
+                        const Value& aValueThreshold);
+
+    /**
+     * Constructor.
+     *
+     * @param aImg the distance image
+     * @param aSet the set of accepted points
+     * @param aPointPredicate the point predicate bounding the computation
+     * @param aPointFunctor the point functor (copied by each thread)
+     */
+    FastIterativeMethod(Image& aImg, AcceptedPointSet& aSet,
+                        ConstAlias<PointPredicate> aPointPredicate,
+                        PointFunctor& aPointFunctor);
+
+    /**
+     * Constructor.
+     *
+     * @param aImg the distance image
+     * @param aSet the set of accepted points
+     * @param aPointPredicate the point predicate bounding the computation
+     * @param aValueThreshold the value threshold
+     * @param aPointFunctor the point functor (copied by each thread)
+     */
+    FastIterativeMethod(Image& aImg, AcceptedPointSet& aSet,
+                        ConstAlias<PointPredicate> aPointPredicate,
+                        const Value& aValueThreshold,
+                        PointFunctor& aPointFunctor);
+
+    /**
+     * Destructor.
+     */
+    ~FastIterativeMethod();
+
+    /**
+     * Copy constructor.
+     * Forbidden.
+     */
+    FastIterativeMethod ( const FastIterativeMethod & other ) = delete;
+
+    /**
+     * Assignment.
+     * Forbidden.
+     */
+    FastIterativeMethod & operator= ( const FastIterativeMethod & other ) = delete;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * @return the tolerance below which a decrease of value is
+     * ignored (1e-6 for floating-point values, 0 otherwise).
+     */
+    Value tolerance() const;
+
+    /**
+     * Sets the tolerance below which a decrease of value is ignored.
+     *
+     * @param aTolerance a non-negative value.
+     */
+    void setTolerance(const Value& aTolerance);
+
+    /**
+     * Computation of the signed distance function by iterating
+     * rounds until convergence.
+     *
+     * @see computeOneRound
+     */
+    void compute();
+
+    /**
+     * Updates the values of the active points.
+     *
+     * @return 'true' if there are still active points, 'false' otherwise.
+     */
+    bool computeOneRound();
+
+    /**
+     * @return the number of rounds done so far.
+     */
+    std::size_t nbRounds() const;
+
+    /**
+     * @return minimal distance value in the set of accepted points
+     * (up to date after compute()).
+     */
+    Value min() const;
+
+    /**
+     * @return maximal distance value in the set of accepted points
+     * (up to date after compute()).
+     */
+    Value max() const;
+
+    /**
+     * Computes the minimal distance value in the set of accepted points.
+     * @return minimal distance value.
+     */
+    Value getMin() const;
+
+    /**
+     * Computes the maximal distance value in the set of accepted points.
+     * @return maximal distance value.
+     */
+    Value getMax() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- static functions for init --------------------
+
+    /**
+     * See FMM::initFromPointsRange.
+     */
+    template <typename TIteratorOnPoints>
+    static void initFromPointsRange(const TIteratorOnPoints& itb, const TIteratorOnPoints& ite,
+                                    Image& aImg, AcceptedPointSet& aSet,
+                                    const Value& aValue)
+    {
+      Reference::initFromPointsRange( itb, ite, aImg, aSet, aValue );
+    }
+
+    /**
+     * See FMM::initFromBelsRange.
+     */
+    template <typename KSpace, typename TIteratorOnBels>
+    static void initFromBelsRange(const KSpace& aK,
+                                  const TIteratorOnBels& itb, const TIteratorOnBels& ite,
+                                  Image& aImg, AcceptedPointSet& aSet,
+                                  const Value& aValue,
+                                  bool aFlagIsPositive = true)
+    {
+      Reference::initFromBelsRange( aK, itb, ite, aImg, aSet, aValue, aFlagIsPositive );
+    }
+
+    /**
+     * See FMM::initFromBelsRange.
+     */
+    template <typename KSpace, typename TIteratorOnBels, typename TImplicitFunction>
+    static void initFromBelsRange(const KSpace& aK,
+                                  const TIteratorOnBels& itb, const TIteratorOnBels& ite,
+                                  const TImplicitFunction& aF,
+                                  Image& aImg, AcceptedPointSet& aSet,
+                                  bool aFlagIsPositive = true)
+    {
+      Reference::initFromBelsRange( aK, itb, ite, aF, aImg, aSet, aFlagIsPositive );
+    }
+
+    /**
+     * See FMM::initFromIncidentPointsRange.
+     */
+    template <typename TIteratorOnPairs>
+    static void initFromIncidentPointsRange(const TIteratorOnPairs& itb, const TIteratorOnPairs& ite,
+                                            Image& aImg, AcceptedPointSet& aSet,
+                                            const Value& aValue,
+                                            bool aFlagIsPositive = true)
+    {
+      Reference::initFromIncidentPointsRange( itb, ite, aImg, aSet, aValue, aFlagIsPositive );
+    }
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Initializes the flags and the active points.
+     */
+    void init();
+
+    /**
+     * @param anIndex the linearized index of a point of the domain.
+     * @return a reference on the flags of the point, whose page is
+     * allocated if needed.
+     */
+    unsigned char& flags(Index anIndex);
+
+    /**
+     * Activates the neighbors of @a aPoint that are within the
+     * computation domain and that are not seeds.
+     *
+     * @param aPoint any point
+     * @param aList the list where the activated points are pushed
+     */
+    void activateNeighbors(const Point& aPoint, std::vector<Index>& aList);
+
+  }; // end of class FastIterativeMethod
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'FastIterativeMethod'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'FastIterativeMethod' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TImage, typename TSet, typename TPointPredicate, typename TPointFunctor >
+  std::ostream&
+  operator<< ( std::ostream & out, const FastIterativeMethod<TImage, TSet, TPointPredicate, TPointFunctor> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/volumes/distance/FastIterativeMethod.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined FastIterativeMethod_h
+
+#undef FastIterativeMethod_RECURSES
+#endif // else defined(FastIterativeMethod_RECURSES)
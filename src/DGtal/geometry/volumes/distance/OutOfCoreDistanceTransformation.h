@@ -0,0 +1,382 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file OutOfCoreDistanceTransformation.h
+ * @brief Distance transformation and Voronoi map computed slab by
+ * slab with bounded memory.
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module OutOfCoreDistanceTransformation.ih
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see testOutOfCoreDistanceTransformation.cpp
+ */
+
+#if defined(OutOfCoreDistanceTransformation_RECURSES)
+#error Recursive header files inclusion detected in OutOfCoreDistanceTransformation.h
+#else // defined(OutOfCoreDistanceTransformation_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define OutOfCoreDistanceTransformation_RECURSES
+
+#if !defined OutOfCoreDistanceTransformation_h
+/** Prevents repeated inclusion of headers. */
+#define OutOfCoreDistanceTransformation_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/base/Exceptions.h"
+#include "DGtal/base/WorkStealingScheduler.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/kernel/CPointPredicate.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/geometry/volumes/distance/CSeparableMetric.h"
+#include "DGtal/geometry/volumes/distance/VoronoiMapLineBatch.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class OutOfCoreDistanceTransformation
+  /**
+   * Description of template class 'OutOfCoreDistanceTransformation' <p>
+   * \brief Aim: Computes the distance transformation (or the Voronoi
+   * map) of a large volume with a bounded amount of memory.
+   *
+   * The result is exactly the one of DistanceTransformation (resp.
+   * VoronoiMap) for a non-periodic domain, but the full site image
+   * is never kept in memory. The separable steps are run slab by
+   * slab: for the step along dimension @a k, the domain is cut into
+   * slabs orthogonal to the last dimension (or to the one before the
+   * last for the last step), which contain complete lines along @a
+   * k. The thickness of the slabs is deduced from the memory budget.
+   *
+   * Between two steps, the intermediate site image is spilled into
+   * a temporary file. After the step along dimension @a k, the
+   * coordinates of a site along the dimensions greater than @a k are
+   * the ones of the point itself, hence only @a k+1 coordinates per
+   * point are stored (e.g. 4 and 8 bytes per voxel after the first
+   * and second steps of a 3D transform with 32-bit coordinates). The
+   * last step directly writes the result into the output image.
+   *
+   * The input (point predicate) and output images are read and
+   * written slab by slab in domain order, so that they can be any
+   * model of CConstImage / CImage, and in particular TiledImage
+   * instances backed by an ImageFactoryFromHDF5 with
+   * ImageCacheReadPolicyFIFO and ImageCacheWritePolicyWT: only a few
+   * tiles are then in memory at once. The input and output images
+   * are only accessed by the calling thread, whereas the lines of a
+   * slab are processed in parallel with the WorkStealingScheduler.
+   *
+   * The memory budget bounds the size of the slab buffer and of the
+   * file buffers. A slab is at least one hyperplane thick, so that
+   * the budget is exceeded if it does not allow a hyperplane of
+   * sites to be stored.
+   *
+   * @code
+   * typedef ExactPredicateLpSeparableMetric<Z3i::Space, 2> L2Metric;
+   * L2Metric l2;
+   * OutOfCoreDistanceTransformation<Z3i::Space, Predicate, L2Metric>
+   *   dt( domain, predicate, l2, 512 * 1024 * 1024 ); // 512MB
+   * dt.compute( tiledOutputImage );
+   * @endcode
+   *
+   * @tparam TSpace type of Digital Space (model of concepts::CSpace),
+   * of dimension at least 2.
+   * @tparam TPointPredicate point predicate returning true for points
+   * from which we compute the distance (model of concepts::CPointPredicate).
+   * @tparam TSeparableMetric a model of concepts::CSeparableMetric.
+   */
+  template < typename TSpace,
+             typename TPointPredicate,
+             typename TSeparableMetric >
+  class OutOfCoreDistanceTransformation
+  {
+
+  public:
+    BOOST_CONCEPT_ASSERT(( concepts::CSpace< TSpace > ));
+    BOOST_CONCEPT_ASSERT(( concepts::CPointPredicate<TPointPredicate> ));
+    BOOST_CONCEPT_ASSERT(( concepts::CSeparableMetric<TSeparableMetric> ));
+    BOOST_STATIC_ASSERT(( TSpace::dimension >= 2 ));
+
+    ///Copy of the space type.
+    typedef TSpace Space;
+
+    ///Copy of the point predicate type.
+    typedef TPointPredicate PointPredicate;
+
+    ///Definition of the separable metric type
+    typedef TSeparableMetric SeparableMetric;
+
+    ///Definition of the underlying domain type.
+    typedef HyperRectDomain<Space> Domain;
+
+    typedef typename Space::Vector Vector;
+    typedef typename Space::Point Point;
+    typedef typename Space::Dimension Dimension;
+    typedef typename Space::Size Size;
+    typedef typename Point::Coordinate Abscissa;
+
+    ///Self type
+    typedef OutOfCoreDistanceTransformation<TSpace, TPointPredicate, TSeparableMetric> Self;
+
+    /**
+     * Constructor.
+     *
+     * @param aDomain the (hyper-rectangular) domain on which the
+     * computation is performed.
+     * @param aPredicate the point predicate to define the Voronoi
+     * sites (false points).
+     * @param aMetric the separable metric instance.
+     * @param aMaxMemory the memory budget in bytes.
+     * @param aSpillDirectory the directory for the temporary files
+     * (the system temporary directory if empty).
+     */
+    OutOfCoreDistanceTransformation( ConstAlias<Domain> aDomain,
+                                     ConstAlias<PointPredicate> aPredicate,
+                                     ConstAlias<SeparableMetric> aMetric,
+                                     const std::size_t aMaxMemory = std::size_t( 1 ) << 30,
+                                     const std::string & aSpillDirectory = "" );
+
+    /**
+     * Default destructor
+     */
+    ~OutOfCoreDistanceTransformation() = default;
+
+    /**
+     * Disabling default constructor.
+     */
+    OutOfCoreDistanceTransformation() = delete;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Computes the transform and writes it into @a anOutputImage.
+     *
+     * If the value type of the output image is Space::Vector, the
+     * Voronoi map is written (i.e. the closest site of each point,
+     * see VoronoiMap), otherwise the distance to the closest site is
+     * written (see DistanceTransformation).
+     *
+     * @tparam TImage a model of concepts::CImage defined on (at
+     * least) the computation domain.
+     * @param anOutputImage the output image.
+     * @throw IOException if the temporary files cannot be created,
+     * read or written.
+     */
+    template <typename TImage>
+    void compute( TImage & anOutputImage ) const;
+
+    /**
+     * @return the computation domain.
+     */
+    const Domain & domain() const
+    {
+      return *myDomainPtr;
+    }
+
+    /**
+     * @return the memory budget in bytes.
+     */
+    std::size_t maxMemory() const
+    {
+      return myMaxMemory;
+    }
+
+    /**
+     * Sets the memory budget.
+     * @param aMaxMemory the memory budget in bytes.
+     */
+    void setMaxMemory( const std::size_t aMaxMemory )
+    {
+      myMaxMemory = aMaxMemory;
+    }
+
+    /**
+     * @param dim a dimension.
+     * @return the dimension orthogonal to the slabs for the step
+     * along dimension @a dim.
+     */
+    static Dimension slabDimension( const Dimension dim )
+    {
+      return dim == Space::dimension - 1 ? Space::dimension - 2 : Space::dimension - 1;
+    }
+
+    /**
+     * @param dim a dimension.
+     * @return the thickness of the slabs for the step along dimension
+     * @a dim, according to the memory budget.
+     */
+    Size slabThickness( const Dimension dim ) const;
+
+    /**
+     * @return the underlying metric.
+     */
+    const SeparableMetric* metric() const
+    {
+      return myMetricPtr;
+    }
+
+    /**
+     * Self Display method.
+     *
+     * @param out output stream
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------- Private functions ------------------------
+  private:
+
+    /**
+     * Temporary file storing an intermediate site image.
+     */
+    class SpillFile
+    {
+    public:
+      /// Creates the file in a directory.
+      explicit SpillFile( const std::string & aDirectory );
+      /// Closes and removes the file.
+      ~SpillFile();
+      SpillFile( const SpillFile & ) = delete;
+      SpillFile & operator=( const SpillFile & ) = delete;
+      /// Reads @a n coordinates at position @a offset (in coordinates).
+      void read( std::size_t offset, Abscissa * data, std::size_t n );
+      /// Writes @a n coordinates at position @a offset (in coordinates).
+      void write( std::size_t offset, const Abscissa * data, std::size_t n );
+    private:
+      /// Path of the file.
+      std::string myPath;
+      /// File stream.
+      std::fstream myStream;
+    };
+
+    /**
+     * Loads the sites of a slab from a spill file.
+     *
+     * @param file the spill file.
+     * @param nbCoords number of stored coordinates per point.
+     * @param slabDomain the slab.
+     * @param p the dimension orthogonal to the slab.
+     * @param[out] slab the sites of the slab (row-major order).
+     */
+    void readSlab( SpillFile & file, const Dimension nbCoords,
+                   const Domain & slabDomain, const Dimension p,
+                   std::vector<Point> & slab ) const;
+
+    /**
+     * Saves the sites of a slab into a spill file.
+     *
+     * @param file the spill file.
+     * @param nbCoords number of stored coordinates per point.
+     * @param slabDomain the slab.
+     * @param p the dimension orthogonal to the slab.
+     * @param slab the sites of the slab (row-major order).
+     */
+    void writeSlab( SpillFile & file, const Dimension nbCoords,
+                    const Domain & slabDomain, const Dimension p,
+                    const std::vector<Point> & slab ) const;
+
+    /**
+     * Runs the separable step along dimension @a dim on all the
+     * lines of a slab.
+     *
+     * @param slabDomain the slab.
+     * @param dim the dimension of the step.
+     * @param[in,out] slab the sites of the slab (row-major order).
+     */
+    void processSlab( const Domain & slabDomain, const Dimension dim,
+                      std::vector<Point> & slab ) const;
+
+    /**
+     * Runs the separable step (generic metric) on a line of a slab.
+     *
+     * @param slabDomain the slab.
+     * @param lineStart first point of the line.
+     * @param dim the dimension of the step.
+     * @param[in,out] data pointer to the first site of the line.
+     * @param lineStride storage stride along @a dim.
+     * @param sites scratch storage for the sites.
+     */
+    void processLine( const Domain & slabDomain, const Point & lineStart,
+                      const Dimension dim, Point * data,
+                      const std::size_t lineStride,
+                      std::vector<Point> & sites ) const;
+
+    // ------------------- Private members ------------------------
+  private:
+
+    ///Pointer to the computation domain
+    const Domain * myDomainPtr;
+
+    ///Pointer to the point predicate
+    const PointPredicate * myPointPredicatePtr;
+
+    ///Pointer to the separable metric instance
+    const SeparableMetric * myMetricPtr;
+
+    ///Memory budget in bytes
+    std::size_t myMaxMemory;
+
+    ///Directory of the temporary files
+    std::string mySpillDirectory;
+
+    ///Value to act as a +infinity value
+    Point myInfinity;
+
+  }; // end of class OutOfCoreDistanceTransformation
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'OutOfCoreDistanceTransformation'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'OutOfCoreDistanceTransformation' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename S, typename P, typename Sep>
+  std::ostream&
+  operator<< ( std::ostream & out, const OutOfCoreDistanceTransformation<S,P,Sep> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/volumes/distance/OutOfCoreDistanceTransformation.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined OutOfCoreDistanceTransformation_h
+
+#undef OutOfCoreDistanceTransformation_RECURSES
+#endif // else defined(OutOfCoreDistanceTransformation_RECURSES)
@@ -47,9 +47,11 @@
 #include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CountedPtr.h"
+#include "DGtal/base/WorkStealingScheduler.h"
 #include "DGtal/base/ConstAlias.h"
 #include "DGtal/images/ImageContainerBySTLVector.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/domains/Linearizer.h"
 #include "DGtal/images/CConstImage.h"
 #include "DGtal/images/CImage.h"
 #include "DGtal/geometry/volumes/distance/CPowerSeparableMetric.h"
@@ -90,6 +92,15 @@ namespace DGtal
    * class constructor). For Euclidean the @f$ l_2@f$ metric, the
    * overall computation is in @f$ O(d.n^d)@f$, which is optimal.
    *
+   * The computation may be done in parallel (multithreaded) using
+   * the WorkStealingScheduler. It is sequential unless the number of
+   * threads is set with WorkStealingScheduler::setNumberOfThreads, or
+   * DGtal is built with WITH_OPENMP (see
+   * WorkStealingScheduler::defaultNumberOfThreads). In that case, the
+   * weight image and the power metric are called
+   * concurrently from several threads and must be thread-safe for
+   * const calls.
+   *
    * This class is a model of concepts::CConstImage.
    *
    * @see &nbsp; \ref toricVol
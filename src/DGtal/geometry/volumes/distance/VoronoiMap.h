@@ -46,13 +46,20 @@
 #include <iostream>
 #include <vector>
 #include <array>
+#include <set>
+#include <type_traits>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CountedPtr.h"
+#include "DGtal/base/WorkStealingScheduler.h"
 #include "DGtal/images/ImageContainerBySTLVector.h"
 #include "DGtal/images/CImage.h"
+#include "DGtal/images/DefaultConstImageRange.h"
 #include "DGtal/kernel/CPointPredicate.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/domains/Linearizer.h"
 #include "DGtal/geometry/volumes/distance/CSeparableMetric.h"
+#include "DGtal/geometry/volumes/distance/VoronoiMapLineBatch.h"
+#include "DGtal/geometry/volumes/distance/VoronoiMapSiteCodec.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
 #include "DGtal/base/ConstAlias.h"
 //////////////////////////////////////////////////////////////////////////////
@@ -97,10 +104,42 @@ namespace DGtal
    * l_2@f$ metric, the overall computation is in @f$ O(d.n^d)@f$,
    * which is optimal.
    *
-   * If DGtal has been built with OpenMP support (WITH_OPENMP flag set
-   * to "true"), the computation is done in parallel (multithreaded)
-   * in an optimal way: on @a p processors, expected runtime is in
-   * @f$ O(h.d.n^d / p)@f$.
+   * The computation may be done in parallel (multithreaded) using
+   * the WorkStealingScheduler, in an optimal way: on @a p processors,
+   * expected runtime is in @f$ O(h.d.n^d / p)@f$. It is sequential
+   * unless the number of threads is set with
+   * WorkStealingScheduler::setNumberOfThreads, or DGtal is built with
+   * WITH_OPENMP (see WorkStealingScheduler::defaultNumberOfThreads).
+   * In that case, the
+   * point predicate and the metric are called concurrently from
+   * several threads and must be thread-safe for const calls.
+   *
+   * For the exact Euclidean metric (ExactPredicateLpSeparableMetric
+   * with p=2) and the default ImageContainerBySTLVector output image,
+   * non-periodic dimensions are processed by tiles of lines (see
+   * detail::VoronoiMapLineBatch) to make the passes along strided
+   * dimensions cache friendly. The resulting map is the same as the
+   * one of the generic line by line process.
+   *
+   * The output image may also store each site as its linearized
+   * index in the domain (see Linearizer and
+   * detail::VoronoiMapSiteCodec) instead of a full vector, which
+   * divides the memory footprint of the map by 3 (resp. 6) in 3D
+   * with 32-bit (resp. 64-bit) coordinates and 32-bit indices. This
+   * mode is selected by an output image with an unsigned integer
+   * value type, large enough to index the domain (extended by one
+   * period on both sides along periodic dimensions):
+   * @code
+   * typedef ImageContainerBySTLVector<Z3i::Domain, DGtal::uint32_t> IndexImage;
+   * VoronoiMap<Z3i::Space, Predicate, L2Metric, IndexImage> voronoi( domain, predicate, l2 );
+   * Z3i::Point site = voronoi( p ); // decoded site
+   * @endcode
+   * Sites are then decoded and encoded on the fly, and the generic
+   * line by line process is used.
+   *
+   * After local edits of the sites, the map can be repaired in place
+   * with update(), which only recomputes the region whose closest
+   * sites may have changed.
    *
    * This class is a model of concepts::CConstImage.
    *
@@ -113,8 +152,9 @@ namespace DGtal
    * @tparam TImageContainer any model of concepts::CImage to store the
    * VoronoiMap (default: ImageContainerBySTLVector). The space of the
    * image container and the TSpace should match. Furthermore the
-   * container value type must be TSpace::Vector. Lastly, the domain
-   * of the container must be HyperRectDomain.
+   * container value type must be TSpace::Vector, or an unsigned
+   * integer type to store linearized site indices. Lastly, the
+   * domain of the container must be HyperRectDomain.
    */
   template < typename TSpace,
              typename TPointPredicate,
@@ -140,9 +180,10 @@ namespace DGtal
     BOOST_STATIC_ASSERT ((boost::is_same< TSpace,
                           typename TImageContainer::Domain::Space >::value ));
 
-    //ImageContainer value type must be  TSpace::Vector
-    BOOST_STATIC_ASSERT ((boost::is_same< typename TSpace::Vector,
-                          typename TImageContainer::Value >::value ));
+    //ImageContainer value type must be  TSpace::Vector or an unsigned integer
+    BOOST_STATIC_ASSERT (( boost::is_same< typename TSpace::Vector,
+                           typename TImageContainer::Value >::value
+                           || std::is_unsigned< typename TImageContainer::Value >::value ));
 
     //ImageContainer domain type must be  HyperRectangular
     BOOST_STATIC_ASSERT ((boost::is_same< HyperRectDomain<TSpace>,
@@ -175,17 +216,31 @@ namespace DGtal
     ///Definition of the image value type.
     typedef Vector Value;
 
-    ///Definition of the image value type.
-    typedef typename OutputImage::ConstRange  ConstRange;
-
     ///Self type
     typedef VoronoiMap< TSpace, TPointPredicate,
                         TSeparableMetric,TImageContainer > Self;
 
+    ///Conversion of the sites to and from the output image values.
+    typedef detail::VoronoiMapSiteCodec< Domain, typename OutputImage::Value > SiteCodec;
+
+    /// True if the output image stores linearized site indices.
+    static constexpr bool isCompact = SiteCodec::isCompact;
+
+    ///Definition of the image const range.
+    typedef typename std::conditional< isCompact,
+                                       DefaultConstImageRange<Self>,
+                                       typename OutputImage::ConstRange >::type ConstRange;
+
 
     /// Periodicity specification type.
     typedef std::array< bool, Space::dimension > PeriodicitySpec;
 
+    /// True if the line-batched engine can be used on non-periodic dimensions.
+    static constexpr bool isLineBatchable =
+      detail::IsExactL2SeparableMetric<SeparableMetric>::value
+      && boost::is_same< OutputImage,
+                         ImageContainerBySTLVector<Domain, Vector> >::value;
+
     /**
      * Constructor in the non-periodic case.
      *
@@ -204,6 +259,9 @@ namespace DGtal
      * Voronoi sites (false points).
      *
      * @param aMetric a pointer to the separable metric instance.
+     *
+     * @throw InputException if the sites are stored as indices (see
+     * isCompact) whose type cannot index the domain.
      */
     VoronoiMap(ConstAlias<Domain> aDomain,
                ConstAlias<PointPredicate> predicate,
@@ -232,6 +290,10 @@ namespace DGtal
      * @param aPeriodicitySpec an array of size equal to the space dimension
      *        where the i-th value is \c true if the i-th dimension of the
      *        space is periodic, \c false otherwise.
+     *
+     * @throw InputException if the sites are stored as indices (see
+     * isCompact) whose type cannot index the domain, extended three
+     * times along periodic dimensions.
      */
     VoronoiMap(ConstAlias<Domain> aDomain,
                ConstAlias<PointPredicate> predicate,
@@ -273,7 +335,10 @@ namespace DGtal
      */
     ConstRange constRange() const
     {
-      return myImagePtr->constRange();
+      if constexpr ( isCompact )
+        return ConstRange( *this );
+      else
+        return myImagePtr->constRange();
     }
 
     /**
@@ -284,7 +349,7 @@ namespace DGtal
      */
     Value operator()(const Point &aPoint) const
     {
-      return myImagePtr->operator()(aPoint);
+      return mySiteCodec.decode( myImagePtr->operator()(aPoint) );
     }
 
     /**
@@ -326,6 +391,37 @@ namespace DGtal
      */
     Point projectPoint( Point aPoint ) const;
 
+    /**
+     * Updates the map after the insertion and the removal of sites
+     * (i.e. points whose predicate value changed from true to false,
+     * and from false to true). The resulting map is the same as the
+     * one computed from scratch with the new set of sites.
+     *
+     * The edits are grouped into clusters. Around each cluster, the
+     * region where the closest site may change is bounded by growing
+     * a box until the inserted or removed sites are farther, on its
+     * whole boundary, than the current closest sites (by a margin
+     * ensuring that the regions, which are star-shaped, lie inside
+     * the box). Each region is then recomputed with a Voronoi map on
+     * a neighborhood large enough to contain all the candidate
+     * sites. The cost is then related to the size of the Voronoi
+     * cells of the edited sites instead of the size of the domain.
+     *
+     * The sites are read from the map itself (a site is its own
+     * closest site), so that the point predicate is not used. It is
+     * however expected to be updated accordingly by the caller. On
+     * domains with periodic dimensions, the whole map is recomputed
+     * from the point predicate.
+     *
+     * @note The metric should be a norm (as any @f$ l_p @f$ metric
+     * with @f$ p \geq 1 @f$).
+     *
+     * @param insertedSites the new sites (points already being sites are ignored).
+     * @param removedSites the removed sites (points not being sites are ignored).
+     */
+    void update( const std::vector<Point> & insertedSites,
+                 const std::vector<Point> & removedSites );
+
     /**
      * Self Display method.
      *
@@ -333,6 +429,43 @@ namespace DGtal
      */
     void selfDisplay ( std::ostream & out ) const;
 
+    // ------------------- Protected functions ------------------------
+  protected:
+
+    /**
+     * Constructor running only the first steps of the construction
+     * (used by derived classes which fuse the last step with their
+     * own processing, see computeOtherSteps(const Dimension, const TWriter &) const).
+     *
+     * @param aDomain a pointer to the (hyper-rectangular) domain on
+     * which the computation is performed.
+     * @param predicate a pointer to the point predicate to define the
+     * Voronoi sites (false points).
+     * @param aMetric a pointer to the separable metric instance.
+     * @param aPeriodicitySpec the periodicity specification.
+     * @param nbSteps the number of steps (i.e. of dimensions) to process.
+     */
+    VoronoiMap(ConstAlias<Domain> aDomain,
+               ConstAlias<PointPredicate> predicate,
+               ConstAlias<SeparableMetric> aMetric,
+               PeriodicitySpec const & aPeriodicitySpec,
+               const Dimension nbSteps);
+
+    /**
+     *  Compute the other steps of the separable Voronoi map, the
+     *  resulting sites being given to a functor instead of being
+     *  stored in the output image.
+     *
+     * @tparam TWriter type of functor called as writer(point, site)
+     * for each point of the lines along @a dim. The site is the
+     * infinity point on lines without site. It may be called
+     * concurrently for distinct points.
+     * @param [in] dim the dimension to process
+     * @param [in] writer the functor.
+     */
+    template <typename TWriter>
+    void computeOtherSteps(const Dimension dim, const TWriter & writer) const;
+
     // ------------------- Private functions ------------------------
   private:
 
@@ -341,8 +474,10 @@ namespace DGtal
      * SeparableMetric metric.  The method associates to each point
      * satisfying the foreground predicate, the closest site for which
      * the predicate is false. This algorithm is O(h.d.|domain size|).
+     *
+     * @param nbSteps the number of steps (i.e. of dimensions) to process.
      */
-    void compute ( ) ;
+    void compute ( const Dimension nbSteps = Space::dimension ) ;
 
 
     /**
@@ -359,9 +494,36 @@ namespace DGtal
      *
      * @param [in] row starting point of the 1D process.
      * @param [in] dim dimension of the update.
+     * @param [in] writer functor called as writer(point, site) to
+     * store the result.
      */
+    template <typename TWriter>
     void computeOtherStep1D (const Point &row,
-                             const Dimension dim) const;
+                             const Dimension dim,
+                             const TWriter & writer) const;
+
+    /**
+     *  Compute the other steps of the separable Voronoi map along a
+     *  non-periodic dimension using the line-batched engine
+     *  detail::VoronoiMapLineBatch.
+     *
+     * @pre isLineBatchable is true and the dimension @a dim is not periodic.
+     * @param [in] dim the dimension to process
+     */
+    void computeOtherStepsByBatch(const Dimension dim) const;
+
+    /**
+     * Process, with the line-batched engine, all the lines along
+     * dimension @a dim starting on the row along the first
+     * dimension that contains @a rowStart.
+     *
+     * @param [in] engine the (per thread) line-batched engine.
+     * @param [in] rowStart first point of the row.
+     * @param [in] dim dimension of the update.
+     */
+    void computeOtherStepsByBatchRow(detail::VoronoiMapLineBatch<Point, typename SeparableMetric::RawValue> & engine,
+                                     const Point &rowStart,
+                                     const Dimension dim) const;
 
     /**
      * Project a coordinate into the domain, taking into account
@@ -376,6 +538,51 @@ namespace DGtal
      */
     typename Point::Coordinate projectCoordinate( typename Point::Coordinate aCoordinate, const Dimension aDim ) const;
 
+    /**
+     * Point predicate used by update(): the sites are read from the
+     * current map, with the edited points.
+     */
+    struct EditedSitesPredicate
+    {
+      typedef typename Space::Point Point;
+
+      /// Pointer to the Voronoi map.
+      const VoronoiMap * myMap;
+      /// Pointer to the inserted sites.
+      const std::set<Point> * myInserted;
+      /// Pointer to the removed sites.
+      const std::set<Point> * myRemoved;
+
+      /**
+       * @param aPoint any point of the domain.
+       * @return false if @a aPoint is a site once the map is edited.
+       */
+      bool operator()( const Point & aPoint ) const
+      {
+        if ( myInserted->count( aPoint ) != 0 )
+          return false;
+        return (*myMap)( aPoint ) != aPoint || myRemoved->count( aPoint ) != 0;
+      }
+    };
+
+    /**
+     * Computes the region of the domain where the closest sites may
+     * change after edits located in a box (see update()).
+     *
+     * @param [in] aBox a box containing the edited sites.
+     * @return the box containing the region.
+     */
+    Domain influenceRegion( const Domain & aBox ) const;
+
+    /**
+     * Recomputes the map on a box after edits (see update()).
+     *
+     * @param [in] aBox the box to recompute.
+     * @param [in] aPredicate the predicate defining the edited sites.
+     */
+    void recomputeRegion( const Domain & aBox,
+                          const EditedSitesPredicate & aPredicate );
+
     // ------------------- Private members ------------------------
   private:
 
@@ -391,9 +598,6 @@ namespace DGtal
     ///Copy of the image lower bound
     Point myUpperBoundCopy;
 
-    ///Value to act as a +infinity value
-    Point myInfinity;
-
     /// Index of the periodic dimensions
     std::vector< Dimension > myPeriodicityIndex; // Could be boost::static_vector but it needs Boost >= 1.54.
 
@@ -411,6 +615,12 @@ namespace DGtal
     /// Periodicity along each dimension.
     PeriodicitySpec myPeriodicitySpec;
 
+    ///Value to act as a +infinity value
+    Point myInfinity;
+
+    ///Conversion of the sites to and from the image values
+    SiteCodec mySiteCodec;
+
   }; // end of class VoronoiMap
 
   /**
@@ -49,10 +49,12 @@
 #include <set>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CountedPtr.h"
+#include "DGtal/base/WorkStealingScheduler.h"
 #include "DGtal/images/ImageContainerBySTLVector.h"
 #include "DGtal/images/CImage.h"
 #include "DGtal/kernel/CPointPredicate.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/domains/Linearizer.h"
 #include "DGtal/geometry/volumes/distance/CSeparableMetric.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
 #include "DGtal/base/ConstAlias.h"
@@ -108,10 +110,15 @@ namespace DGtal
    * l_2@f$ metric, the overall computation is in @f$ O(f.d.n^d)@f$,
    * which is optimal.
    *
-   * If DGtal has been built with OpenMP support (WITH_OPENMP flag set
-   * to "true"), the computation is done in parallel (multithreaded)
-   * in an optimal way: on @a p processors, expected runtime is in
-   * @f$ O(f.h.d.n^d / p)@f$.
+   * The computation may be done in parallel (multithreaded) using
+   * the WorkStealingScheduler, in an optimal way: on @a p processors,
+   * expected runtime is in @f$ O(f.h.d.n^d / p)@f$. It is sequential
+   * unless the number of threads is set with
+   * WorkStealingScheduler::setNumberOfThreads, or DGtal is built with
+   * WITH_OPENMP (see WorkStealingScheduler::defaultNumberOfThreads).
+   * In that case, the
+   * point predicate and the metric are called concurrently from
+   * several threads and must be thread-safe for const calls.
    *
    * This class is a model of concepts::CConstImage.
    *
@@ -0,0 +1,241 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file VoronoiMapLineBatch.h
+ * @brief Line-batched lower envelope computation for the separable
+ * Voronoi map construction with the exact l_2 metric.
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module VoronoiMapLineBatch.ih
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see VoronoiMap.h
+ */
+
+#if defined(VoronoiMapLineBatch_RECURSES)
+#error Recursive header files inclusion detected in VoronoiMapLineBatch.h
+#else // defined(VoronoiMapLineBatch_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define VoronoiMapLineBatch_RECURSES
+
+#if !defined VoronoiMapLineBatch_h
+/** Prevents repeated inclusion of headers. */
+#define VoronoiMapLineBatch_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <vector>
+#include <type_traits>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/NumberTraits.h"
+#include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  namespace detail
+  {
+    /**
+     * Type trait telling if a separable metric is the exact l_2
+     * metric, i.e. an ExactPredicateLpSeparableMetric with p=2, for
+     * which the line-batched engine VoronoiMapLineBatch can be used.
+     *
+     * @tparam TMetric any model of concepts::CSeparableMetric.
+     */
+    template <typename TMetric>
+    struct IsExactL2SeparableMetric : std::false_type {};
+
+    /// Specialization for ExactPredicateLpSeparableMetric with p=2.
+    template <typename TSpace, typename TRawValue>
+    struct IsExactL2SeparableMetric< ExactPredicateLpSeparableMetric<TSpace, 2, TRawValue> >
+      : std::true_type {};
+
+    /////////////////////////////////////////////////////////////////////////////
+    // template class VoronoiMapLineBatch
+    /**
+     * Description of template class 'VoronoiMapLineBatch' <p>
+     * \brief Aim: Computes, for the exact l_2 metric, one step of the
+     * separable Voronoi map construction on a tile of parallel
+     * lines at once.
+     *
+     * The lines of a tile are consecutive along the first dimension,
+     * hence in a row-major storage (e.g. ImageContainerBySTLVector),
+     * the i-th points of all the lines of a tile are contiguous in
+     * memory, even if the lines themselves are strided. The tile is
+     * first transposed into a contiguous scratch buffer (so that each
+     * cache line read from the image is fully used), the lower
+     * envelope of the sites is then computed line by line on the
+     * buffer, and the result is finally written back to the image.
+     *
+     * Unlike VoronoiMap::computeOtherStep1D, the squared distance of
+     * every candidate site to its line (the part of the l_2 distance
+     * that does not depend on the position along the line) is
+     * computed once per site, in a loop over flat arrays that the
+     * compiler can vectorize. The hiddenBy and closest predicates
+     * then only involve scalar arithmetic on these values. The
+     * predicates are evaluated with the same formulas and the same
+     * integer type as in ExactPredicateLpSeparableMetric, so that the
+     * resulting map is identical to the one obtained with the
+     * generic point by point process.
+     *
+     * Periodic dimensions are not handled by this engine.
+     *
+     * An instance owns its scratch buffers, which are reused from
+     * one tile to the next: one instance per thread should be used.
+     *
+     * @tparam TPoint type of points (model of PointVector).
+     * @tparam TRawValue integer type used to compute exact squared
+     * distances (see ExactPredicateLpSeparableMetric).
+     */
+    template <typename TPoint, typename TRawValue>
+    class VoronoiMapLineBatch
+    {
+    public:
+      /// Point type.
+      typedef TPoint Point;
+
+      /// Integer type for exact squared distances.
+      typedef TRawValue RawValue;
+
+      /// Dimension type.
+      typedef typename Point::Dimension Dimension;
+
+      /// Maximal number of lines processed in a tile.
+      static constexpr std::size_t batchSize = 16;
+
+      /**
+       * Constructor.
+       *
+       * @param anInfinity the value used in the image for points
+       * without site.
+       */
+      explicit VoronoiMapLineBatch( const Point & anInfinity );
+
+      /**
+       * Processes a tile of lines along dimension @a dim.
+       *
+       * The @a nbLines lines start at @a first, @a first + e_0,
+       * ..., and are stored at @a data, @a data + 1, ... in a
+       * row-major storage. Two consecutive points of a line are
+       * separated by @a lineStride elements in the storage. When @a
+       * dim is 0, a tile must contain a single line.
+       *
+       * @param data pointer to the value of the first point of the
+       * first line of the tile.
+       * @param nbLines number of lines in the tile (in [1, batchSize]).
+       * @param lineStride storage stride along dimension @a dim.
+       * @param length number of points of each line.
+       * @param first coordinates of the first point of the first line.
+       * @param dim dimension along which the lines are oriented.
+       */
+      void process( Point * data,
+                    const std::size_t nbLines,
+                    const std::size_t lineStride,
+                    const std::size_t length,
+                    const Point & first,
+                    const Dimension dim );
+
+      /**
+       * Processes a tile of lines along dimension @a dim whose
+       * points are only known by the squared distance to their
+       * closest site in the hyperplane orthogonal to @a dim (i.e.
+       * the result of the previous steps, as a raw l_2 distance),
+       * and gives the raw distance of each point to its closest site
+       * to a functor. This is the last step of a raw distance
+       * transformation which never stores the sites along @a dim.
+       *
+       * The layout of the tile is the same as in process.
+       *
+       * @tparam TWriter type of functor called as writer(point,
+       * rawDistance) for each point of the tile, with
+       * NumberTraits<RawValue>::max() for points without site.
+       *
+       * @param heights pointer to the squared distance of the first
+       * point of the first line of the tile
+       * (NumberTraits<RawValue>::max() for points without site).
+       * @param nbLines number of lines in the tile (in [1, batchSize]).
+       * @param lineStride storage stride along dimension @a dim.
+       * @param length number of points of each line.
+       * @param first coordinates of the first point of the first line.
+       * @param dim dimension along which the lines are oriented.
+       * @param writer the functor.
+       */
+      template <typename TWriter>
+      void processHeights( const RawValue * heights,
+                           const std::size_t nbLines,
+                           const std::size_t lineStride,
+                           const std::size_t length,
+                           const Point & first,
+                           const Dimension dim,
+                           const TWriter & writer );
+
+    private:
+      /// Value for points without site.
+      Point myInfinity;
+
+      /// Transposed tile: the i-th point of line b is at i*nbLines+b.
+      std::vector<Point> myTile;
+
+      /// Squared distance of each candidate site to its line (dim excluded).
+      std::vector<RawValue> myHeight;
+
+      /// Abscissa of each candidate site along the processed dimension.
+      std::vector<RawValue> myAbscissa;
+
+      /// Tells if the tile entry holds a site.
+      std::vector<unsigned char> myIsSite;
+
+      /// Stack of the lower envelope sites (indices in myTile).
+      std::vector<std::size_t> myStack;
+
+      /// Index in myTile of the closest site of each tile entry.
+      std::vector<std::size_t> myClosest;
+
+      /**
+       * Computes the lower envelope of the sites of a line of the
+       * tile and stores the closest site of each point in myClosest.
+       *
+       * @param lane index of the line in the tile.
+       * @param nbLines number of lines in the tile.
+       * @param length number of points of each line.
+       * @param origin abscissa of the first point of the line.
+       */
+      void processLine( const std::size_t lane,
+                        const std::size_t nbLines,
+                        const std::size_t length,
+                        const RawValue origin );
+    }; // end of class VoronoiMapLineBatch
+
+  } // namespace detail
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/volumes/distance/VoronoiMapLineBatch.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined VoronoiMapLineBatch_h
+
+#undef VoronoiMapLineBatch_RECURSES
+#endif // else defined(VoronoiMapLineBatch_RECURSES)
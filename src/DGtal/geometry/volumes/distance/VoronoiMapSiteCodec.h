@@ -0,0 +1,222 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file VoronoiMapSiteCodec.h
+ * @brief Encoding of the Voronoi sites stored in the output image of
+ * a VoronoiMap.
+ *
+ * @date 2026/10/16
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see VoronoiMap.h
+ */
+
+#if defined(VoronoiMapSiteCodec_RECURSES)
+#error Recursive header files inclusion detected in VoronoiMapSiteCodec.h
+#else // defined(VoronoiMapSiteCodec_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define VoronoiMapSiteCodec_RECURSES
+
+#if !defined VoronoiMapSiteCodec_h
+/** Prevents repeated inclusion of headers. */
+#define VoronoiMapSiteCodec_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <array>
+#include <type_traits>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/NumberTraits.h"
+#include "DGtal/kernel/domains/Linearizer.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  namespace detail
+  {
+    /////////////////////////////////////////////////////////////////////////////
+    // template class VoronoiMapSiteCodec
+    /**
+     * Description of template class 'VoronoiMapSiteCodec' <p>
+     * \brief Aim: Converts the Voronoi sites of a VoronoiMap to and
+     * from the values stored in its output image.
+     *
+     * When the value type of the image is the vector type of the
+     * space, the sites are stored as is. This is the default
+     * behavior of VoronoiMap.
+     *
+     * When the value type is an unsigned integer type (e.g.
+     * DGtal::uint32_t or DGtal::uint64_t), a site is stored as its
+     * linearized index (see Linearizer) in the domain, and the
+     * maximal value of the type stands for the absence of site. Along
+     * a periodic dimension, a site may lie up to one period outside
+     * of the domain (see VoronoiMap), hence the indices are taken in
+     * the domain extended by one period on both sides along such
+     * dimensions.
+     *
+     * @tparam TDomain type of domain (HyperRectDomain).
+     * @tparam TValue value type of the output image.
+     */
+    template <typename TDomain, typename TValue,
+              bool isIndex = std::is_integral<TValue>::value>
+    class VoronoiMapSiteCodec
+    {
+    public:
+      typedef typename TDomain::Space Space;
+      typedef typename Space::Point Point;
+      typedef typename Space::Dimension Dimension;
+      typedef TValue Value;
+
+      BOOST_STATIC_ASSERT(( boost::is_same< Value, typename Space::Vector >::value ));
+
+      /// Tells if the sites are stored as indices.
+      static constexpr bool isCompact = false;
+
+      /**
+       * Constructor.
+       *
+       * @param aLowerBound the lower bound of the domain.
+       * @param anUpperBound the upper bound of the domain.
+       * @param aPeriodicitySpec the periodicity of each dimension.
+       * @param anInfinity the point used for the absence of site.
+       */
+      VoronoiMapSiteCodec( const Point & /* aLowerBound */,
+                           const Point & /* anUpperBound */,
+                           const std::array<bool, Space::dimension> & /* aPeriodicitySpec */,
+                           const Point & /* anInfinity */ )
+      {}
+
+      /**
+       * @param aSite a site (or the infinity point).
+       * @return the value to store in the image.
+       */
+      const Value & encode( const Point & aSite ) const
+      {
+        return aSite;
+      }
+
+      /**
+       * @param aValue a value stored in the image.
+       * @return the corresponding site (or the infinity point).
+       */
+      const Point & decode( const Value & aValue ) const
+      {
+        return aValue;
+      }
+    };
+
+    /**
+     * Specialization storing the sites as linearized indices.
+     */
+    template <typename TDomain, typename TValue>
+    class VoronoiMapSiteCodec<TDomain, TValue, true>
+    {
+    public:
+      typedef typename TDomain::Space Space;
+      typedef typename Space::Point Point;
+      typedef typename Space::Dimension Dimension;
+      typedef TValue Value;
+      typedef typename Linearizer<TDomain>::Size Size;
+
+      BOOST_STATIC_ASSERT(( std::is_unsigned<Value>::value ));
+
+      /// Tells if the sites are stored as indices.
+      static constexpr bool isCompact = true;
+
+      /**
+       * Constructor.
+       *
+       * @param aLowerBound the lower bound of the domain.
+       * @param anUpperBound the upper bound of the domain.
+       * @param aPeriodicitySpec the periodicity of each dimension.
+       * @param anInfinity the point used for the absence of site.
+       *
+       * @throw InputException if the value type cannot index all the
+       * points of the domain (extended three times along periodic
+       * dimensions), the maximal value being reserved for infinity.
+       */
+      VoronoiMapSiteCodec( const Point & aLowerBound,
+                           const Point & anUpperBound,
+                           const std::array<bool, Space::dimension> & aPeriodicitySpec,
+                           const Point & anInfinity )
+        : myLowerBound( aLowerBound ),
+          myExtent( anUpperBound - aLowerBound + Point::diagonal( 1 ) ),
+          myInfinity( anInfinity )
+      {
+        // The indices are in [0, nbValues), and the maximal value
+        // stands for infinity.
+        const Size maxValues = static_cast<Size>( NumberTraits<Value>::max() );
+        Size nbValues = 1;
+        for ( Dimension i = 0; i < Space::dimension; ++i )
+          {
+            if ( aPeriodicitySpec[ i ] )
+              {
+                myLowerBound[ i ] -= myExtent[ i ];
+                myExtent[ i ]     *= 3;
+              }
+            const Size extent = static_cast<Size>( myExtent[ i ] );
+            if ( extent != 0 && nbValues > maxValues / extent )
+              {
+                trace.error() << "VoronoiMapSiteCodec: the value type of the image"
+                              << " is too small to index the domain." << std::endl;
+                throw InputException();
+              }
+            nbValues *= extent;
+          }
+      }
+
+      /**
+       * @param aSite a site (or the infinity point).
+       * @return the value to store in the image.
+       */
+      Value encode( const Point & aSite ) const
+      {
+        if ( aSite == myInfinity )
+          return NumberTraits<Value>::max();
+        return static_cast<Value>( Linearizer<TDomain>::getIndex( aSite, myLowerBound, myExtent ) );
+      }
+
+      /**
+       * @param aValue a value stored in the image.
+       * @return the corresponding site (or the infinity point).
+       */
+      Point decode( const Value aValue ) const
+      {
+        if ( aValue == NumberTraits<Value>::max() )
+          return myInfinity;
+        return Linearizer<TDomain>::getPoint( static_cast<Size>( aValue ), myLowerBound, myExtent );
+      }
+
+    private:
+      /// Lower bound of the (extended) indexed domain.
+      Point myLowerBound;
+      /// Extent of the (extended) indexed domain.
+      Point myExtent;
+      /// Point used for the absence of site.
+      Point myInfinity;
+    };
+
+  } // namespace detail
+} // namespace DGtal
+
+#endif // !defined VoronoiMapSiteCodec_h
+
+#undef VoronoiMapSiteCodec_RECURSES
+#endif // else defined(VoronoiMapSiteCodec_RECURSES)
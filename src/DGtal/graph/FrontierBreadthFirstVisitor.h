@@ -0,0 +1,332 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file FrontierBreadthFirstVisitor.h
+ *
+ * @date 2026/10/17
+ *
+ * Header file for template class FrontierBreadthFirstVisitor
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(FrontierBreadthFirstVisitor_RECURSES)
+#error Recursive header files inclusion detected in FrontierBreadthFirstVisitor.h
+#else // defined(FrontierBreadthFirstVisitor_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define FrontierBreadthFirstVisitor_RECURSES
+
+#if !defined FrontierBreadthFirstVisitor_h
+/** Prevents repeated inclusion of headers. */
+#define FrontierBreadthFirstVisitor_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <atomic>
+#include <cstdint>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class FrontierBreadthFirstVisitor
+  /**
+  Description of template class 'FrontierBreadthFirstVisitor' <p> \brief
+  Aim: A breadth-first exploration of a graph whose vertices are the
+  indices 0, 1, ..., size()-1, which computes each layer of vertices
+  at the same distance from the initial core in parallel.
+
+  Contrary to BreadthFirstVisitor, which visits the vertices one at a
+  time, this visitor is level-synchronous: it only gives the current
+  layer (called the frontier) and expandLayer() computes the whole
+  next layer at once. The visited vertices are marked in a bitmap
+  with atomic operations, and the layers are computed with
+  WorkStealingScheduler in one of two ways:
+
+  - PUSH (top-down): the neighbors of the frontier are marked if they
+    are not yet visited. The cost is proportional to the number of
+    arcs leaving the frontier.
+  - PULL (bottom-up): each vertex not yet visited looks for a
+    neighbor in the frontier. The cost is proportional to the number
+    of arcs leaving the unvisited vertices, which is much lower when
+    the frontier is large.
+
+  In AUTO mode (the default), each layer is computed by PULL when the
+  frontier is larger than a fraction of the unvisited vertices, and
+  by PUSH otherwise (direction-optimizing breadth-first search). The
+  layers are sorted by increasing index, hence the result depends
+  neither on the mode nor on the number of threads.
+
+  @tparam TGraph the type of the graph (model of
+  CUndirectedSimpleLocalGraph), whose vertices are convertible to and
+  from std::size_t indices in [0, size()) (e.g. IndexedDigitalSurface).
+  Its method writeNeighbors must be callable from several threads.
+
+  @code
+  typedef IndexedDigitalSurface< Container > Surface;
+  Surface surface( ... );
+  FrontierBreadthFirstVisitor< Surface > visitor( surface, 0 );
+  std::vector< std::size_t > distance( surface.size() );
+  while ( ! visitor.finished() )
+    {
+      for ( auto v : visitor.currentLayer() )
+        distance[ v ] = visitor.distance();
+      visitor.expandLayer();
+    }
+  @endcode
+
+  @see BreadthFirstVisitor
+  @see testFrontierBreadthFirstVisitor.cpp
+  */
+  template < typename TGraph >
+  class FrontierBreadthFirstVisitor
+  {
+    // ----------------------- Associated types ------------------------------
+  public:
+    typedef FrontierBreadthFirstVisitor<TGraph> Self;
+    typedef TGraph Graph;
+    typedef typename Graph::Size Size;
+    typedef typename Graph::Vertex Vertex;
+    /// Internal data structure for storing vertices.
+    typedef std::vector< Vertex > VertexList;
+
+    /// How the next layer is computed.
+    enum Mode { PUSH, PULL, AUTO };
+
+    /// In AUTO mode, PULL is used when ALPHA times the size of the
+    /// frontier is greater than the number of unvisited vertices.
+    static const Size ALPHA = 14;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~FrontierBreadthFirstVisitor() = default;
+
+    /**
+     * Constructor from a vertex, which is the initial core of the visitor.
+     *
+     * @param graph the graph in which the breadth first traversal takes place.
+     * @param p any vertex of the graph.
+     * @param mode the way the layers are computed.
+     */
+    FrontierBreadthFirstVisitor( ConstAlias<Graph> graph, const Vertex & p,
+                                 Mode mode = AUTO );
+
+    /**
+       Constructor from iterators. The vertices between the iterators
+       are the initial core of the traversal, at distance 0.
+
+       @tparam VertexIterator any type of single pass iterator on vertices.
+       @param graph the graph in which the breadth first traversal takes place.
+       @param b the begin iterator in a container of vertices.
+       @param e the end iterator in a container of vertices.
+       @param mode the way the layers are computed.
+    */
+    template <typename VertexIterator>
+    FrontierBreadthFirstVisitor( ConstAlias<Graph> graph,
+                                 VertexIterator b, VertexIterator e,
+                                 Mode mode = AUTO );
+
+    /**
+       @return a const reference on the graph that is traversed.
+    */
+    const Graph & graph() const;
+
+    /**
+       @return the way the layers are computed.
+    */
+    Mode mode() const;
+
+    /**
+       Changes the way the next layers are computed.
+       @param mode the new mode.
+    */
+    void setMode( Mode mode );
+
+    // ----------------------- traversal services ------------------------------
+  public:
+
+    /**
+       @return the vertices of the current layer, sorted by increasing index.
+     */
+    const VertexList & currentLayer() const;
+
+    /**
+       @return the topological distance of the current layer to the
+       initial core.
+     */
+    Size distance() const;
+
+    /**
+       Replaces the current layer by the vertices, not yet visited,
+       that are adjacent to it.
+     */
+    void expandLayer();
+
+    /**
+       Replaces the current layer by the vertices, not yet visited,
+       that are adjacent to it and satisfy a predicate.
+
+       @tparam VertexPredicate a type that satisfies CPredicate on
+       Vertex, which may be called from several threads.
+
+       @param authorized_vtx the predicate that should satisfy the
+       visited vertices.
+     */
+    template <typename VertexPredicate>
+    void expandLayer( const VertexPredicate & authorized_vtx );
+
+    /**
+       @return 'true' if all possible elements have been visited.
+     */
+    bool finished() const;
+
+    /**
+       Force termination of the breadth first traversal. The current
+       layer becomes empty.
+     */
+    void terminate();
+
+    /**
+       @param v any vertex.
+       @return 'true' iff @a v is in the current layer or in a previous one.
+     */
+    bool isMarked( const Vertex & v ) const;
+
+    /**
+       @return the number of vertices in the current layer or in a
+       previous one.
+     */
+    Size nbMarked() const;
+
+    /**
+       @return the number of layers computed by PULL so far.
+     */
+    Size nbPullLayers() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The graph where the traversal takes place.
+    const Graph & myGraph;
+
+    /// The number of vertices of the graph.
+    std::size_t myNbVertices;
+
+    /// The way the layers are computed.
+    Mode myMode;
+
+    /// One bit per vertex, set when the vertex is visited.
+    std::vector< std::atomic< std::uint64_t > > myMarks;
+
+    /// The number of marked vertices.
+    Size myNbMarked;
+
+    /// The current layer, sorted by increasing index.
+    VertexList myFrontier;
+
+    /// The distance of the current layer.
+    Size myDistance;
+
+    /// The number of layers computed by PULL.
+    Size myNbPullLayers;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    FrontierBreadthFirstVisitor() = delete;
+    FrontierBreadthFirstVisitor ( const FrontierBreadthFirstVisitor & other ) = delete;
+    FrontierBreadthFirstVisitor & operator= ( const FrontierBreadthFirstVisitor & other ) = delete;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+       Marks the vertex of index @a i.
+       @return 'true' iff it was not marked before.
+    */
+    bool mark( std::size_t i );
+
+    /**
+       Computes the next layer from the neighbors of the frontier.
+       @param authorized_vtx the predicate that should satisfy the
+       visited vertices.
+    */
+    template <typename VertexPredicate>
+    void push( const VertexPredicate & authorized_vtx );
+
+    /**
+       Computes the next layer from the unvisited vertices.
+       @param authorized_vtx the predicate that should satisfy the
+       visited vertices.
+    */
+    template <typename VertexPredicate>
+    void pull( const VertexPredicate & authorized_vtx );
+
+  }; // end of class FrontierBreadthFirstVisitor
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'FrontierBreadthFirstVisitor'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'FrontierBreadthFirstVisitor' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TGraph>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const FrontierBreadthFirstVisitor<TGraph> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/graph/FrontierBreadthFirstVisitor.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined FrontierBreadthFirstVisitor_h
+
+#undef FrontierBreadthFirstVisitor_RECURSES
+#endif // else defined(FrontierBreadthFirstVisitor_RECURSES)
@@ -48,6 +48,9 @@
 #include "DGtal/geometry/surfaces/estimation/IIGeometricFunctors.h"
 #include "DGtal/geometry/surfaces/estimation/IntegralInvariantVolumeEstimator.h"
 #include "DGtal/geometry/surfaces/estimation/IntegralInvariantCovarianceEstimator.h"
+#if defined(WITH_FFTW3)
+#include "DGtal/geometry/surfaces/FFTDigitalSurfaceConvolver.h"
+#endif
 
 #include "DGtal/dec/DiscreteExteriorCalculusFactory.h"
 #include "DGtal/dec/ATSolver2D.h"
@@ -638,6 +641,7 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - kernel          [ "hat"]: the kernel integration function chi_r, either "hat" or "ball". )
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
+      ///   - ii-prefix-sums  [     0]: when 1, the II estimators use prefix sums of the shape (PrefixSumConvolver), faster for large radii.
       ///   - surfelEmbedding [     0]: the surfel -> point embedding for VCM estimator: 0: Pointels, 1: InnerSpel, 2: OuterSpel.
       static Parameters parametersGeometryEstimation()
       {
@@ -648,6 +652,7 @@ namespace DGtal
           ( "R-radius",       10.0 )
           ( "r-radius",        3.0 )
           ( "alpha",          0.33 )
+          ( "ii-prefix-sums",    0 )
           ( "surfelEmbedding",   0 );
       }
 
@@ -831,6 +836,7 @@ namespace DGtal
       ///   - verbose         [     1]: verbose trace mode 0: silent, 1: verbose.
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
+      ///   - ii-prefix-sums  [     0]: when 1, the II estimators use prefix sums of the shape (PrefixSumConvolver).
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
       ///
       /// @return the vector containing the estimated normals, in the
@@ -866,6 +872,7 @@ namespace DGtal
       ///   - verbose         [     1]: verbose trace mode 0: silent, 1: verbose.
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
+      ///   - ii-prefix-sums  [     0]: when 1, the II estimators use prefix sums of the shape (PrefixSumConvolver).
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
       ///   - minAABB         [ -10.0]: the min value of the AABB bounding box (domain)
       ///   - maxAABB         [  10.0]: the max value of the AABB bounding box (domain)
@@ -907,6 +914,7 @@ namespace DGtal
       ///   - verbose         [     1]: verbose trace mode 0: silent, 1: verbose.
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
+      ///   - ii-prefix-sums  [     0]: when 1, the II estimators use prefix sums of the shape (PrefixSumConvolver).
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
       ///
       /// @return the vector containing the estimated normals, in the
@@ -936,6 +944,7 @@ namespace DGtal
           Scalar     h       = params[ "gridstep"  ].as<Scalar>();
           Scalar     r       = params[ "r-radius"  ].as<Scalar>();
           Scalar     alpha   = params[ "alpha"     ].as<Scalar>();
+          bool       prefix  = params[ "ii-prefix-sums" ].as<int>() != 0;
           if ( alpha != 1.0 ) r *= pow( h, alpha-1.0 );
           if ( verbose > 0 )
             {
@@ -947,7 +956,7 @@ namespace DGtal
           functor.init( h, r*h );
           IINormalEstimator   ii_estimator( functor );
           ii_estimator.attach( K, shape );
-          ii_estimator.setParams( r );
+          ii_estimator.setParams( r, prefix );
           ii_estimator.init( h, surfels.begin(), surfels.end() );
           ii_estimator.eval( surfels.begin(), surfels.end(),
                              std::back_inserter( n_estimations ) );
@@ -968,6 +977,7 @@ namespace DGtal
       ///   - verbose         [     1]: verbose trace mode 0: silent, 1: verbose.
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
+      ///   - ii-prefix-sums  [     0]: when 1, the II estimators use prefix sums of the shape (PrefixSumConvolver).
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
       ///
       /// @return the vector containing the estimated mean curvatures, in the
@@ -999,6 +1009,7 @@ namespace DGtal
       ///   - verbose         [     1]: verbose trace mode 0: silent, 1: verbose.
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
+      ///   - ii-prefix-sums  [     0]: when 1, the II estimators use prefix sums of the shape (PrefixSumConvolver).
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
       ///   - minAABB         [ -10.0]: the min value of the AABB bounding box (domain)
       ///   - maxAABB         [  10.0]: the max value of the AABB bounding box (domain)
@@ -1038,6 +1049,7 @@ namespace DGtal
       ///   - verbose         [     1]: verbose trace mode 0: silent, 1: verbose.
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
+      ///   - ii-prefix-sums  [     0]: when 1, the II estimators use prefix sums of the shape (PrefixSumConvolver).
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
       ///
       /// @return the vector containing the estimated mean curvatures, in the
@@ -1063,6 +1075,7 @@ namespace DGtal
           Scalar   h       = params[ "gridstep"  ].as<Scalar>();
           Scalar   r       = params[ "r-radius"  ].as<Scalar>();
           Scalar   alpha   = params[ "alpha"     ].as<Scalar>();
+          bool     prefix  = params[ "ii-prefix-sums" ].as<int>() != 0;
           if ( alpha != 1.0 ) r *= pow( h, alpha-1.0 );
           if ( verbose > 0 )
             {
@@ -1074,7 +1087,7 @@ namespace DGtal
           functor.init( h, r*h );
           IIMeanCurvEstimator ii_estimator( functor );
           ii_estimator.attach( K, shape );
-          ii_estimator.setParams( r );
+          ii_estimator.setParams( r, prefix );
           ii_estimator.init( h, surfels.begin(), surfels.end() );
           ii_estimator.eval( surfels.begin(), surfels.end(),
                              std::back_inserter( mc_estimations ) );
@@ -1092,6 +1105,7 @@ namespace DGtal
       ///   - verbose         [     1]: verbose trace mode 0: silent, 1: verbose.
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
+      ///   - ii-prefix-sums  [     0]: when 1, the II estimators use prefix sums of the shape (PrefixSumConvolver).
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
       ///
       /// @return the vector containing the estimated Gaussian curvatures, in the
@@ -1123,6 +1137,7 @@ namespace DGtal
       ///   - verbose         [     1]: verbose trace mode 0: silent, 1: verbose.
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
+      ///   - ii-prefix-sums  [     0]: when 1, the II estimators use prefix sums of the shape (PrefixSumConvolver).
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
       ///   - minAABB         [ -10.0]: the min value of the AABB bounding box (domain)
       ///   - maxAABB         [  10.0]: the max value of the AABB bounding box (domain)
@@ -1162,6 +1177,7 @@ namespace DGtal
       ///   - verbose         [     1]: verbose trace mode 0: silent, 1: verbose.
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
+      ///   - ii-prefix-sums  [     0]: when 1, the II estimators use prefix sums of the shape (PrefixSumConvolver).
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
       ///
       /// @return the vector containing the estimated Gaussian curvatures, in the
@@ -1187,6 +1203,7 @@ namespace DGtal
           Scalar   h       = params[ "gridstep"  ].as<Scalar>();
           Scalar   r       = params[ "r-radius"  ].as<Scalar>();
           Scalar   alpha   = params[ "alpha"     ].as<Scalar>();
+          bool     prefix  = params[ "ii-prefix-sums" ].as<int>() != 0;
           if ( alpha != 1.0 ) r *= pow( h, alpha-1.0 );
           if ( verbose > 0 )
             {
@@ -1198,7 +1215,7 @@ namespace DGtal
           functor.init( h, r*h );
           IIGaussianCurvEstimator ii_estimator( functor );
           ii_estimator.attach( K, shape );
-          ii_estimator.setParams( r );
+          ii_estimator.setParams( r, prefix );
           ii_estimator.init( h, surfels.begin(), surfels.end() );
           ii_estimator.eval( surfels.begin(), surfels.end(),
                              std::back_inserter( mc_estimations ) );
@@ -1217,6 +1234,7 @@ namespace DGtal
       ///   - verbose         [     1]: verbose trace mode 0: silent, 1: verbose.
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
+      ///   - ii-prefix-sums  [     0]: when 1, the II estimators use prefix sums of the shape (PrefixSumConvolver).
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
       ///
       /// @return the vector containing the estimated Gaussian curvatures, in the
@@ -1249,6 +1267,7 @@ namespace DGtal
       ///   - verbose         [     1]: verbose trace mode 0: silent, 1: verbose.
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
+      ///   - ii-prefix-sums  [     0]: when 1, the II estimators use prefix sums of the shape (PrefixSumConvolver).
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
       ///   - minAABB         [ -10.0]: the min value of the AABB bounding box (domain)
       ///   - maxAABB         [  10.0]: the max value of the AABB bounding box (domain)
@@ -1288,6 +1307,7 @@ namespace DGtal
       ///   - verbose         [     1]: verbose trace mode 0: silent, 1: verbose.
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
+      ///   - ii-prefix-sums  [     0]: when 1, the II estimators use prefix sums of the shape (PrefixSumConvolver).
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
       ///
       /// @return the vector containing the estimated principal curvatures and directions,
@@ -1312,6 +1332,7 @@ namespace DGtal
         Scalar   h       = params[ "gridstep"  ].as<Scalar>();
         Scalar   r       = params[ "r-radius"  ].as<Scalar>();
         Scalar   alpha   = params[ "alpha"     ].as<Scalar>();
+        bool     prefix  = params[ "ii-prefix-sums" ].as<int>() != 0;
         if ( alpha != 1.0 ) r *= pow( h, alpha-1.0 );
         if ( verbose > 0 )
         {
@@ -1323,13 +1344,218 @@ namespace DGtal
         functor.init( h, r*h );
         IICurvEstimator ii_estimator( functor );
         ii_estimator.attach( K, shape );
-        ii_estimator.setParams( r );
+        ii_estimator.setParams( r, prefix );
         ii_estimator.init( h, surfels.begin(), surfels.end() );
         ii_estimator.eval( surfels.begin(), surfels.end(),
                           std::back_inserter( mc_estimations ) );
         return mc_estimations;
       }
 
+#if defined(WITH_FFTW3)
+
+      /// Given a digital shape \a bimage, a sequence of \a surfels,
+      /// several kernel radii \a radii, and some parameters \a params,
+      /// returns the mean curvature Integral Invariant (II) estimation
+      /// at the specified surfels for each radius.
+      ///
+      /// @param[in] bimage the characteristic function of the shape as a binary image (inside is true, outside is false).
+      /// @param[in] surfels the sequence of surfels at which we compute the mean curvatures
+      /// @param[in] radii the constants r of the kernel radii r(h)=r h^alpha, which replace parameter r-radius.
+      /// @param[in] params the parameters (see @ref getIIMeanCurvaturesAtScales).
+      ///
+      /// @return for each radius, the vector containing the estimated
+      /// mean curvatures, in the same order as \a surfels.
+      ///
+      /// @note Requires FFTW3 (WITH_FFTW3).
+      static std::vector< Scalars >
+      getIIMeanCurvaturesAtScales( CountedPtr<BinaryImage> bimage,
+                                   const SurfelRange&      surfels,
+                                   const Scalars&          radii,
+                                   const Parameters&       params
+                                   = parametersGeometryEstimation()
+                                   | parametersKSpace() )
+      {
+        auto K =  getKSpace( bimage, params );
+        return getIIMeanCurvaturesAtScales( *bimage, K, surfels, radii, params );
+      }
+
+      /// Given an arbitrary PointPredicate \a shape: Point -> boolean, a
+      /// Khalimsky space \a K, a sequence of \a surfels, several kernel
+      /// radii \a radii, and some parameters \a params, returns the mean
+      /// curvature Integral Invariant (II) estimation at the specified
+      /// surfels for each radius.
+      ///
+      /// The volumes of all the kernels are computed in one pass over
+      /// the shape by FFTDigitalSurfaceConvolver, and are those of
+      /// getIIMeanCurvatures with parameter ii-prefix-sums.
+      ///
+      /// @tparam TPointPredicate any type of map Point -> boolean.
+      /// @param[in] shape a function Point -> boolean telling if you are inside the shape.
+      /// @param[in] K the Khalimsky space where the shape and surfels live.
+      /// @param[in] surfels the sequence of surfels at which we compute the mean curvatures
+      /// @param[in] radii the constants r of the kernel radii r(h)=r h^alpha, which replace parameter r-radius.
+      /// @param[in] params the parameters:
+      ///   - verbose         [     1]: verbose trace mode 0: silent, 1: verbose.
+      ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
+      ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///
+      /// @return for each radius, the vector containing the estimated
+      /// mean curvatures, in the same order as \a surfels.
+      ///
+      /// @note Requires FFTW3 (WITH_FFTW3).
+      template <typename TPointPredicate>
+      static std::vector< Scalars >
+      getIIMeanCurvaturesAtScales( const TPointPredicate&  shape,
+                                   const KSpace&           K,
+                                   const SurfelRange&      surfels,
+                                   const Scalars&          radii,
+                                   const Parameters&       params
+                                   = parametersGeometryEstimation()
+                                   | parametersKSpace() )
+      {
+        typedef functors::IIMeanCurvature3DFunctor<Space> IIMeanCurvFunctor;
+        typedef FFTDigitalSurfaceConvolver<KSpace, TPointPredicate> Convolver;
+        typedef ImplicitBall<Space>                        KernelSupport;
+        typedef GaussDigitizer<Space, KernelSupport>       DigitalKernel;
+
+        int      verbose = params[ "verbose"   ].as<int>();
+        Scalar   h       = params[ "gridstep"  ].as<Scalar>();
+        Scalar   alpha   = params[ "alpha"     ].as<Scalar>();
+        Convolver convolver( K, shape, false );
+        for ( Scalar r : radii )
+          {
+            if ( alpha != 1.0 ) r *= pow( h, alpha-1.0 );
+            if ( verbose > 0 )
+              trace.info() << "- II mean curvature r=" << (r*h)  << " (continuous) "
+                           << r << " (discrete)" << std::endl;
+            KernelSupport ball( RealPoint::zero, r*h );
+            DigitalKernel kernel;
+            kernel.attach( ball );
+            kernel.init( ball.getLowerBound() + Point::diagonal(-1),
+                         ball.getUpperBound() + Point::diagonal(1), h );
+            convolver.addKernel( kernel );
+          }
+        std::vector< Scalars > mc_estimations;
+        convolver.volumes( surfels.begin(), surfels.end(), mc_estimations );
+        for ( std::size_t i = 0; i < radii.size(); ++i )
+          {
+            Scalar r = radii[ i ];
+            if ( alpha != 1.0 ) r *= pow( h, alpha-1.0 );
+            IIMeanCurvFunctor functor;
+            functor.init( h, r*h );
+            for ( auto& v : mc_estimations[ i ] ) v = functor( v );
+          }
+        return mc_estimations;
+      }
+
+      /// Given a digital shape \a bimage, a sequence of \a surfels,
+      /// several kernel radii \a radii, and some parameters \a params,
+      /// returns the principal curvatures and directions using Integral
+      /// Invariant (II) estimation at the specified surfels for each
+      /// radius.
+      ///
+      /// @param[in] bimage the characteristic function of the shape as a binary image (inside is true, outside is false).
+      /// @param[in] surfels the sequence of surfels at which we compute the principal curvatures
+      /// @param[in] radii the constants r of the kernel radii r(h)=r h^alpha, which replace parameter r-radius.
+      /// @param[in] params the parameters (see @ref getIIPrincipalCurvaturesAndDirectionsAtScales).
+      ///
+      /// @return for each radius, the vector containing the estimated
+      /// principal curvatures and directions, in the same order as \a surfels.
+      ///
+      /// @note Requires FFTW3 (WITH_FFTW3).
+      static std::vector< CurvatureTensorQuantities >
+      getIIPrincipalCurvaturesAndDirectionsAtScales( CountedPtr<BinaryImage> bimage,
+                                                     const SurfelRange&      surfels,
+                                                     const Scalars&          radii,
+                                                     const Parameters&       params
+                                                     = parametersGeometryEstimation()
+                                                     | parametersKSpace() )
+      {
+        auto K =  getKSpace( bimage, params );
+        return getIIPrincipalCurvaturesAndDirectionsAtScales( *bimage, K, surfels, radii, params );
+      }
+
+      /// Given an arbitrary PointPredicate \a shape: Point -> boolean, a
+      /// Khalimsky space \a K, a sequence of \a surfels, several kernel
+      /// radii \a radii, and some parameters \a params, returns the
+      /// principal curvatures and directions using Integral Invariant
+      /// (II) estimation at the specified surfels for each radius.
+      ///
+      /// The covariance matrices of all the kernels are computed in one
+      /// pass over the shape by FFTDigitalSurfaceConvolver, and are
+      /// those of getIIPrincipalCurvaturesAndDirections with parameter
+      /// ii-prefix-sums.
+      ///
+      /// @tparam TPointPredicate any type of map Point -> boolean.
+      /// @param[in] shape a function Point -> boolean telling if you are inside the shape.
+      /// @param[in] K the Khalimsky space where the shape and surfels live.
+      /// @param[in] surfels the sequence of surfels at which we compute the principal curvatures
+      /// @param[in] radii the constants r of the kernel radii r(h)=r h^alpha, which replace parameter r-radius.
+      /// @param[in] params the parameters:
+      ///   - verbose         [     1]: verbose trace mode 0: silent, 1: verbose.
+      ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
+      ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///
+      /// @return for each radius, the vector containing the estimated
+      /// principal curvatures and directions, in the same order as \a surfels.
+      ///
+      /// @note Requires FFTW3 (WITH_FFTW3).
+      template <typename TPointPredicate>
+      static std::vector< CurvatureTensorQuantities >
+      getIIPrincipalCurvaturesAndDirectionsAtScales( const TPointPredicate&  shape,
+                                                     const KSpace&           K,
+                                                     const SurfelRange&      surfels,
+                                                     const Scalars&          radii,
+                                                     const Parameters&       params
+                                                     = parametersGeometryEstimation()
+                                                     | parametersKSpace() )
+      {
+        typedef functors::IIPrincipalCurvaturesAndDirectionsFunctor<Space> IICurvFunctor;
+        typedef FFTDigitalSurfaceConvolver<KSpace, TPointPredicate> Convolver;
+        typedef ImplicitBall<Space>                        KernelSupport;
+        typedef GaussDigitizer<Space, KernelSupport>       DigitalKernel;
+
+        int      verbose = params[ "verbose"   ].as<int>();
+        Scalar   h       = params[ "gridstep"  ].as<Scalar>();
+        Scalar   alpha   = params[ "alpha"     ].as<Scalar>();
+        Convolver convolver( K, shape, true );
+        for ( Scalar r : radii )
+          {
+            if ( alpha != 1.0 ) r *= pow( h, alpha-1.0 );
+            if ( verbose > 0 )
+              trace.info() << "- II principal curvatures and directions r=" << (r*h)
+                           << " (continuous) " << r << " (discrete)" << std::endl;
+            KernelSupport ball( RealPoint::zero, r*h );
+            DigitalKernel kernel;
+            kernel.attach( ball );
+            kernel.init( ball.getLowerBound() + Point::diagonal(-1),
+                         ball.getUpperBound() + Point::diagonal(1), h );
+            convolver.addKernel( kernel );
+          }
+        std::vector< std::vector< typename Convolver::CovarianceMatrix > > matrices;
+        convolver.covarianceMatrices( surfels.begin(), surfels.end(), matrices );
+        std::vector< CurvatureTensorQuantities > mc_estimations( radii.size() );
+        for ( std::size_t i = 0; i < radii.size(); ++i )
+          {
+            Scalar r = radii[ i ];
+            if ( alpha != 1.0 ) r *= pow( h, alpha-1.0 );
+            IICurvFunctor functor;
+            functor.init( h, r*h );
+            mc_estimations[ i ].resize( matrices[ i ].size() );
+            WorkStealingScheduler::forEach
+              ( matrices[ i ].size(),
+                [&] ( std::size_t first, std::size_t last, unsigned int )
+                {
+                  IICurvFunctor f = functor;
+                  for ( std::size_t j = first; j < last; ++j )
+                    mc_estimations[ i ][ j ] = f( matrices[ i ][ j ] );
+                } );
+          }
+        return mc_estimations;
+      }
+
+#endif // defined(WITH_FFTW3)
+
       /// @}
 
       // --------------------------- AT approximation ------------------------------
@@ -0,0 +1,323 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ImageContainerByBricks.h
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module ImageContainerByBricks.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ImageContainerByBricks_RECURSES)
+#error Recursive header files inclusion detected in ImageContainerByBricks.h
+#else // defined(ImageContainerByBricks_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ImageContainerByBricks_RECURSES
+
+#if !defined ImageContainerByBricks_h
+/** Prevents repeated inclusion of headers. */
+#define ImageContainerByBricks_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <array>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/CLabel.h"
+#include "DGtal/kernel/domains/CDomain.h"
+#include "DGtal/kernel/SpaceND.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/images/DefaultConstImageRange.h"
+#include "DGtal/images/DefaultImageRange.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class ImageContainerByBricks
+
+  /**
+   * Description of class 'ImageContainerByBricks' <p>
+   *
+   * Aim: Model of CImage storing the values of a rectangular domain
+   * in a single vector, in an order that keeps close points close in
+   * memory (whereas ImageContainerBySTLVector stores the points that
+   * are adjacent along the last axis at a distance of a whole slice).
+   *
+   * The domain is cut into bricks of side 2^TBrickBits (e.g. 8x8x8
+   * by default in 3D), stored one after the other in the row-major
+   * order of the bricks. Inside a brick, the values are stored in
+   * Morton (Z-) order: the index of a point in its brick interleaves
+   * the bits of its coordinates (see Morton), which is computed with
+   * one precomputed table of dilated integers per axis. When the
+   * bricks are larger than the domain, the whole image is in Morton
+   * order. The bricks on the upper border of the domain are padded.
+   *
+   * As a model of CImage, the values are accessed with operator(),
+   * setValue() and through range() and constRange(), in the order of
+   * the domain. The storage can also be traversed directly in the
+   * order of the memory (storageBegin(), storageEnd()), the point of
+   * an index being given by point(). Last, indexIncr() and
+   * indexDecr() give the index of the neighbors of a point along an
+   * axis in constant time.
+   *
+   * @code
+   * typedef ImageContainerByBricks< Z3i::Domain, float > Image;
+   * Image image( domain );
+   * Image::Index i = image.index( p );
+   * float laplacian = image[ image.indexIncr( i, 2 ) ]
+   *   + image[ image.indexDecr( i, 2 ) ] - 2 * image[ i ]; // along z.
+   * @endcode
+   *
+   * @tparam TDomain a HyperRectDomain.
+   * @tparam TValue at least a model of CLabel.
+   * @tparam TBrickBits the base 2 logarithm of the side of the bricks.
+   *
+   * @see ImageContainerBySTLVector
+   * @see testImageContainerByBricks.cpp
+   * @see benchmarkImageContainer.cpp
+   */
+  template <typename TDomain, typename TValue, unsigned int TBrickBits = 3>
+  class ImageContainerByBricks
+  {
+
+  public:
+
+    typedef ImageContainerByBricks<TDomain, TValue, TBrickBits> Self;
+
+    /// domain
+    BOOST_CONCEPT_ASSERT ( ( concepts::CDomain<TDomain> ) );
+    typedef TDomain Domain;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Vector Vector;
+    typedef typename Domain::Integer Integer;
+    typedef typename Domain::Size Size;
+    typedef typename Domain::Dimension Dimension;
+    typedef Point Vertex;
+
+    BOOST_STATIC_CONSTANT( Dimension, dimension = Domain::Space::dimension );
+
+    /// domain should be rectangular
+    BOOST_STATIC_ASSERT ( ( boost::is_same< Domain,
+                            HyperRectDomain< typename Domain::Space > >::value ) );
+
+    /// range of values
+    BOOST_CONCEPT_ASSERT ( ( concepts::CLabel<TValue> ) );
+    typedef TValue Value;
+
+    /// Index of a value in the storage.
+    typedef std::size_t Index;
+    typedef std::vector<Value> Container;
+    typedef typename Container::const_iterator StorageConstIterator;
+    typedef typename Container::iterator StorageIterator;
+
+    typedef DefaultConstImageRange<Self> ConstRange;
+    typedef DefaultImageRange<Self> Range;
+
+    /// Base 2 logarithm of the side of a brick.
+    BOOST_STATIC_CONSTANT( unsigned int, BRICK_BITS = TBrickBits );
+    /// Side of a brick.
+    BOOST_STATIC_CONSTANT( Index, BRICK_SIDE = Index( 1 ) << BRICK_BITS );
+    /// Number of points of a brick.
+    BOOST_STATIC_CONSTANT( Index, BRICK_SIZE = Index( 1 ) << ( BRICK_BITS * dimension ) );
+
+    BOOST_STATIC_ASSERT(( BRICK_BITS * dimension < 8 * sizeof( Index ) ));
+
+    /////////////////// standard services //////////////////
+
+  public:
+
+    /**
+     * Constructor from a Domain.
+     *
+     * @param aDomain the image domain.
+     * @param aValue the initial value of all the points.
+     */
+    ImageContainerByBricks( const Domain & aDomain,
+                            const Value & aValue = Value() );
+
+    /////////////////// Interface //////////////////
+
+    /**
+     * Get the value of an image at a given position given
+     * by a Point.
+     *
+     * @pre the point must be in the domain
+     *
+     * @param aPoint the point.
+     * @return the value at aPoint.
+     */
+    Value operator() ( const Point & aPoint ) const;
+
+    /**
+     * Set a value on an Image at a position specified by a Point.
+     *
+     * @pre @c aPoint must be a point in the image domain.
+     *
+     * @param aPoint the point.
+     * @param aValue the value.
+     */
+    void setValue ( const Point & aPoint, const Value & aValue );
+
+    /**
+     * @return the domain associated to the image.
+     */
+    const Domain & domain() const;
+
+    /**
+     * @return the range of the values, in the order of the domain.
+     */
+    ConstRange constRange() const;
+
+    /**
+     * @return the range of the values, in the order of the domain.
+     */
+    Range range();
+
+    /////////////////// Storage services //////////////////
+
+    /**
+     * @pre @c aPoint must be a point in the image domain.
+     * @param aPoint the point.
+     * @return the index of the value of @a aPoint in the storage.
+     */
+    Index index( const Point & aPoint ) const;
+
+    /**
+     * @param anIndex an index in the storage.
+     * @return the point whose value is at @a anIndex (which may lie
+     * outside the domain in the padding of the bricks).
+     */
+    Point point( Index anIndex ) const;
+
+    /**
+     * @pre the neighbor of the point of @a anIndex along @a k must be
+     * in the domain or in the padding of the bricks.
+     * @param anIndex the index of a point.
+     * @param k any axis.
+     * @return the index of the point following it along axis @a k.
+     */
+    Index indexIncr( Index anIndex, Dimension k ) const;
+
+    /**
+     * @pre the neighbor of the point of @a anIndex along @a k must be
+     * in the domain.
+     * @param anIndex the index of a point.
+     * @param k any axis.
+     * @return the index of the point preceding it along axis @a k.
+     */
+    Index indexDecr( Index anIndex, Dimension k ) const;
+
+    /**
+     * @param anIndex an index in the storage.
+     * @return the value at @a anIndex.
+     */
+    const Value & operator[] ( Index anIndex ) const;
+
+    /**
+     * @param anIndex an index in the storage.
+     * @return a reference on the value at @a anIndex.
+     */
+    Value & operator[] ( Index anIndex );
+
+    /**
+     * @return the number of values in the storage (including the
+     * padding of the bricks).
+     */
+    Index storageSize() const;
+
+    /// @return an iterator on the first value of the storage.
+    StorageConstIterator storageBegin() const;
+    /// @return an iterator after the last value of the storage.
+    StorageConstIterator storageEnd() const;
+    /// @return an iterator on the first value of the storage.
+    StorageIterator storageBegin();
+    /// @return an iterator after the last value of the storage.
+    StorageIterator storageEnd();
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * @return the validity of the Image
+     */
+    bool isValid() const;
+
+    /**
+     * @return the style name used for drawing this object.
+     */
+    std::string className() const;
+
+    /////////////////// Data members //////////////////
+
+  private:
+
+    /// Image domain.
+    Domain myDomain;
+
+    /// Number of bricks before the next one along each axis.
+    std::array< Index, dimension > myBrickStrides;
+
+    /// Number of bricks along each axis.
+    std::array< Index, dimension > myNbBricks;
+
+    /// For each axis, the coordinates in a brick with their bits
+    /// spread at the place of this axis in the Morton order.
+    std::array< std::array< Index, BRICK_SIDE >, dimension > myDilated;
+
+    /// The bits of each axis in a Morton index.
+    std::array< Index, dimension > myAxisMasks;
+
+    /// The values.
+    Container myData;
+
+  }; // end of class ImageContainerByBricks
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ImageContainerByBricks'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ImageContainerByBricks' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TDomain, typename TValue, unsigned int TBrickBits>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const ImageContainerByBricks<TDomain, TValue, TBrickBits> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/ImageContainerByBricks.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ImageContainerByBricks_h
+
+#undef ImageContainerByBricks_RECURSES
+#endif // else defined(ImageContainerByBricks_RECURSES)
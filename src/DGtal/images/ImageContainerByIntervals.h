@@ -0,0 +1,330 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ImageContainerByIntervals.h
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module ImageContainerByIntervals.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ImageContainerByIntervals_RECURSES)
+#error Recursive header files inclusion detected in ImageContainerByIntervals.h
+#else // defined(ImageContainerByIntervals_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ImageContainerByIntervals_RECURSES
+
+#if !defined ImageContainerByIntervals_h
+/** Prevents repeated inclusion of headers. */
+#define ImageContainerByIntervals_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/CLabel.h"
+#include "DGtal/kernel/domains/CDomain.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/sets/DigitalSetByIntervals.h"
+#include "DGtal/images/DefaultConstImageRange.h"
+#include "DGtal/images/DefaultImageRange.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class ImageContainerByIntervals
+
+  /**
+   * Description of class 'ImageContainerByIntervals' <p>
+   *
+   * Aim: Model of CImage for binary images, whose foreground is stored
+   * as runs along the first axis in a DigitalSetByIntervals.
+   *
+   * The value of a point is the foreground value if it belongs to the
+   * set, and Value() otherwise. Setting any value different from
+   * Value() inserts the point in the set, setting Value() removes it:
+   * the image only distinguishes the background from the foreground.
+   * Reading a value is logarithmic in the number of rows and of runs.
+   *
+   * The functions digitalSetByIntervalsFromImage() and copyToImage()
+   * convert the foreground of a dense image to runs and back, run
+   * after run. With VolReader::mapVol() and VolWriter, they read and
+   * write .vol files (see importVolByIntervals() and
+   * exportVolByIntervals()).
+   *
+   * @code
+   * typedef ImageContainerBySTLVector< Z3i::Domain, unsigned char > Image;
+   * auto set = functions::digitalSetByIntervalsFromImage( image );
+   * ImageContainerByIntervals< Z3i::Domain > binary( set );
+   * trace.info() << set.nbRuns() << " runs for " << set.size() << " voxels\n";
+   * @endcode
+   *
+   * @tparam TDomain a HyperRectDomain.
+   * @tparam TValue at least a model of CLabel, constructible from 1.
+   *
+   * @see DigitalSetByIntervals
+   * @see testDigitalSetByIntervals.cpp
+   */
+  template <typename TDomain, typename TValue = bool>
+  class ImageContainerByIntervals
+  {
+
+  public:
+
+    typedef ImageContainerByIntervals<TDomain, TValue> Self;
+
+    /// domain
+    BOOST_CONCEPT_ASSERT ( ( concepts::CDomain<TDomain> ) );
+    typedef TDomain Domain;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Vector Vector;
+    typedef typename Domain::Integer Integer;
+    typedef typename Domain::Size Size;
+    typedef typename Domain::Dimension Dimension;
+    typedef Point Vertex;
+
+    BOOST_STATIC_CONSTANT( Dimension, dimension = Domain::Space::dimension );
+
+    BOOST_STATIC_ASSERT ( ( boost::is_same< Domain,
+                            HyperRectDomain<typename Domain::Space> >::value ) );
+
+    /// range of values
+    BOOST_CONCEPT_ASSERT ( ( concepts::CLabel<TValue> ) );
+    typedef TValue Value;
+
+    typedef DigitalSetByIntervals<Domain> DigitalSet;
+    typedef DefaultConstImageRange<Self> ConstRange;
+    typedef DefaultImageRange<Self> Range;
+
+    /////////////////// standard services //////////////////
+
+  public:
+
+    /**
+     * Constructor from a Domain. The image is empty (all the points
+     * have value Value()).
+     *
+     * @param aDomain the image domain.
+     * @param aForeground the value of the points of the foreground.
+     */
+    ImageContainerByIntervals( const Domain & aDomain,
+                               const Value & aForeground = Value( 1 ) );
+
+    /**
+     * Constructor from a set.
+     *
+     * @param aSet the foreground, whose domain is the image domain.
+     * @param aForeground the value of the points of the foreground.
+     */
+    ImageContainerByIntervals( const DigitalSet & aSet,
+                               const Value & aForeground = Value( 1 ) );
+
+    /////////////////// Interface //////////////////
+
+    /**
+     * Get the value of an image at a given position given
+     * by a Point.
+     *
+     * @pre the point must be in the domain
+     *
+     * @param aPoint the point.
+     * @return the value at aPoint.
+     */
+    Value operator() ( const Point & aPoint ) const;
+
+    /**
+     * Set a value on an Image at a position specified by a Point.
+     *
+     * @pre @c aPoint must be a point in the image domain.
+     *
+     * @param aPoint the point.
+     * @param aValue the value (any value but Value() means foreground).
+     */
+    void setValue ( const Point & aPoint, const Value & aValue );
+
+    /**
+     * @return the domain associated to the image.
+     */
+    const Domain & domain() const;
+
+    /**
+     * @return the range of the values, in the order of the domain.
+     */
+    ConstRange constRange() const;
+
+    /**
+     * @return the range of the values, in the order of the domain.
+     */
+    Range range();
+
+    /////////////////// Set services //////////////////
+
+    /**
+     * @return the foreground of the image.
+     */
+    const DigitalSet & digitalSet() const;
+
+    /**
+     * @return the foreground of the image.
+     */
+    DigitalSet & digitalSet();
+
+    /**
+     * @return the value of the points of the foreground.
+     */
+    const Value & foreground() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    /**
+     * @return the style name used for drawing this object.
+     */
+    std::string className() const;
+
+    /////////////////// Data members //////////////////
+
+  private:
+
+    /// The foreground.
+    DigitalSet mySet;
+
+    /// The value of the points of the foreground.
+    Value myForeground;
+
+  }; // end of class ImageContainerByIntervals
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ImageContainerByIntervals'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ImageContainerByIntervals' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TDomain, typename TValue>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const ImageContainerByIntervals<TDomain, TValue> & object );
+
+  namespace functions {
+
+    /**
+     * Builds the runs of the points of an image whose value satisfies
+     * a predicate, scanning the values of the image once in the order
+     * of its domain.
+     *
+     * @tparam TImage any model of CConstImage on a HyperRectDomain.
+     * @tparam TPredicate a functor Value -> bool.
+     *
+     * @param image the image.
+     * @param pred the predicate on the values of the foreground.
+     * @return the foreground as a set of runs, on the image domain.
+     */
+    template <typename TImage, typename TPredicate>
+    DigitalSetByIntervals<typename TImage::Domain>
+    digitalSetByIntervalsFromImage( const TImage & image, const TPredicate & pred );
+
+    /**
+     * Builds the runs of the points of an image whose value is not
+     * Value().
+     *
+     * @tparam TImage any model of CConstImage on a HyperRectDomain.
+     * @param image the image.
+     * @return the foreground as a set of runs, on the image domain.
+     */
+    template <typename TImage>
+    DigitalSetByIntervals<typename TImage::Domain>
+    digitalSetByIntervalsFromImage( const TImage & image );
+
+    /**
+     * Sets the value of the points of a set in a dense image, a
+     * whole run at a time.
+     *
+     * @param aSet any set of runs.
+     * @param[in,out] image an image whose domain contains the set.
+     * @param aValue the value to write.
+     */
+    template <typename TDomain, typename TValue>
+    void
+    copyToImage( const DigitalSetByIntervals<TDomain> & aSet,
+                 ImageContainerBySTLVector<TDomain, TValue> & image,
+                 const TValue & aValue );
+
+    /**
+     * Reads the voxels of a .vol file whose value is at least \a
+     * threshold as a set of runs. The file is mapped in memory (see
+     * VolReader::mapVol), hence no dense image is built.
+     *
+     * @tparam TDomain a 3D HyperRectDomain.
+     * @param filename the .vol file.
+     * @param threshold the smallest value of the foreground.
+     * @return the foreground as a set of runs, on the domain of the file.
+     */
+    template <typename TDomain>
+    DigitalSetByIntervals<TDomain>
+    importVolByIntervals( const std::string & filename,
+                          unsigned char threshold = 1 );
+
+    /**
+     * Writes a set of runs as a .vol file on its domain, the points of
+     * the set having value \a foreground.
+     *
+     * @tparam TDomain a 3D HyperRectDomain.
+     * @param filename the .vol file.
+     * @param aSet any set of runs.
+     * @param foreground the value of the points of the set.
+     * @param compressed if true, writes a compressed file (Version 3).
+     * @return 'true' if no error occurred.
+     */
+    template <typename TDomain>
+    bool
+    exportVolByIntervals( const std::string & filename,
+                          const DigitalSetByIntervals<TDomain> & aSet,
+                          unsigned char foreground = 255,
+                          bool compressed = true );
+
+  } // namespace functions
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/ImageContainerByIntervals.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ImageContainerByIntervals_h
+
+#undef ImageContainerByIntervals_RECURSES
+#endif // else defined(ImageContainerByIntervals_RECURSES)
@@ -0,0 +1,244 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ImageFactoryFromChunkedVol.h
+ * @brief Image factory reading and writing the bricks of a chunked
+ * volume file.
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module ImageFactoryFromChunkedVol.ih
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see testChunkedVol.cpp
+ */
+
+#if defined(ImageFactoryFromChunkedVol_RECURSES)
+#error Recursive header files inclusion detected in ImageFactoryFromChunkedVol.h
+#else // defined(ImageFactoryFromChunkedVol_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ImageFactoryFromChunkedVol_RECURSES
+
+#if !defined ImageFactoryFromChunkedVol_h
+/** Prevents repeated inclusion of headers. */
+#define ImageFactoryFromChunkedVol_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include "DGtal/base/Common.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/io/ChunkedVolLayout.h"
+#include "DGtal/io/MemoryMappedFile.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // Template class ImageFactoryFromChunkedVol
+  /**
+   * Description of template class 'ImageFactoryFromChunkedVol' <p>
+   * \brief Aim: implements a factory from a chunked volume file (see
+   * ChunkedVolLayout).
+   *
+   * @tparam TImageContainer an image container type (model of CImage,
+   * with trivially copyable values of the size of the file ones).
+   *
+   * The factory images production (images are copied, so it's a
+   * creation process) is done with the function 'requestImage' so
+   * the deletion must be done with the function 'detachImage'. Only
+   * the bricks intersecting the requested domain are decompressed, in
+   * parallel, so that a TiledImage whose tiles match the bricks of
+   * the file (see brickExtent) pages the bricks on demand.
+   *
+   * The update of the original image is done with the function
+   * 'flushImage': the bricks intersecting the image domain are
+   * compressed again, appended at the end of the file and their index
+   * entries are updated. The previous versions of these bricks are
+   * left in the file, which grows at each flush: the file may be
+   * compacted by reading it and writing it again (see
+   * ChunkedVolReader and ChunkedVolWriter).
+   *
+   * Example usage:
+   * @code
+   * typedef ImageContainerBySTLVector<Z3i::Domain, unsigned char> Image;
+   * typedef ImageFactoryFromChunkedVol<Image> Factory;
+   * typedef ImageCacheReadPolicyFIFO<Image, Factory> ReadPolicy;
+   * typedef ImageCacheWritePolicyWT<Image, Factory> WritePolicy;
+   * typedef TiledImage<Image, Factory, ReadPolicy, WritePolicy> Tiled;
+   *
+   * Factory factory( "data.cvol" );
+   * ReadPolicy readPolicy( factory, 8 );
+   * WritePolicy writePolicy( factory );
+   * Tiled tiled( factory, readPolicy, writePolicy, 4 );
+   * @endcode
+   */
+  template <typename TImageContainer>
+  class ImageFactoryFromChunkedVol
+  {
+
+    // ----------------------- Types ------------------------------
+
+  public:
+    typedef ImageFactoryFromChunkedVol<TImageContainer> Self;
+
+    ///Checking concepts
+    BOOST_CONCEPT_ASSERT(( concepts::CImage<TImageContainer> ));
+
+    ///Types copied from the container
+    typedef TImageContainer ImageContainer;
+    typedef typename ImageContainer::Domain Domain;
+    typedef typename Domain::Vector Vector;
+
+    ///New types
+    typedef ImageContainer OutputImage;
+    typedef typename OutputImage::Value Value;
+
+    BOOST_STATIC_ASSERT(( std::is_trivially_copyable<Value>::value ));
+
+    // ----------------------- Standard services ------------------------------
+
+  public:
+
+    /**
+     * Constructor. Reads the header and the index of the file.
+     *
+     * @param aFilename chunked volume filename.
+     * @param aLevel the zlib compression level used by flushImage
+     * (-1 for the default one).
+     */
+    ImageFactoryFromChunkedVol( const std::string & aFilename, const int aLevel = -1 );
+
+    /**
+     * Copy constructor.
+     * Forbidden.
+     */
+    ImageFactoryFromChunkedVol( const ImageFactoryFromChunkedVol & other ) = delete;
+
+    /**
+     * Assignment.
+     * Forbidden.
+     */
+    ImageFactoryFromChunkedVol & operator=( const ImageFactoryFromChunkedVol & other ) = delete;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /////////////////// Domains //////////////////
+
+    /**
+     * Returns a reference to the underlying image domain.
+     *
+     * @return a reference to the domain.
+     */
+    const Domain & domain() const;
+
+    /////////////////// Accessors //////////////////
+
+    /**
+     * @return the extent of the bricks of the file.
+     */
+    const Vector & brickExtent() const;
+
+    /////////////////// API //////////////////
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    /**
+     * Returns a pointer of an OutputImage created with the Domain
+     * aDomain, whose values are decompressed from the bricks
+     * intersecting aDomain.
+     *
+     * @param aDomain the domain.
+     *
+     * @return an ImagePtr.
+     */
+    OutputImage * requestImage( const Domain & aDomain );
+
+    /**
+     * Flush (i.e. write/synchronize) an OutputImage.
+     *
+     * @param outputImage the OutputImage.
+     */
+    void flushImage( OutputImage* outputImage );
+
+    /**
+     * Free (i.e. delete) an OutputImage.
+     *
+     * @param outputImage the OutputImage.
+     */
+    void detachImage( OutputImage* outputImage );
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// Name of the file
+    std::string myFilename;
+
+    /// zlib compression level of the flushed bricks
+    int myLevel;
+
+    /// Mapping of the file
+    std::unique_ptr<MemoryMappedFile> myFile;
+
+    /// Header and brick index of the file
+    ChunkedVolLayout<Domain> myLayout;
+
+  }; // end of class ImageFactoryFromChunkedVol
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ImageFactoryFromChunkedVol'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ImageFactoryFromChunkedVol' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TImageContainer>
+  std::ostream&
+  operator<< ( std::ostream & out, const ImageFactoryFromChunkedVol<TImageContainer> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/ImageFactoryFromChunkedVol.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ImageFactoryFromChunkedVol_h
+
+#undef ImageFactoryFromChunkedVol_RECURSES
+#endif // else defined(ImageFactoryFromChunkedVol_RECURSES)
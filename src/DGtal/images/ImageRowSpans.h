@@ -0,0 +1,239 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ImageRowSpans.h
+ * @brief Traversal of a HyperRectDomain and of the storage of an
+ * ImageContainerBySTLVector row by row, and bulk image kernels
+ * (transforms, reductions, bit masks) built on the rows.
+ *
+ * @date 2026/10/17
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see testImageRowSpans.cpp
+ * @see benchmarkImageContainer.cpp
+ * @see benchmarkHyperRectDomain-google.cpp
+ */
+
+#if defined(ImageRowSpans_RECURSES)
+#error Recursive header files inclusion detected in ImageRowSpans.h
+#else // defined(ImageRowSpans_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ImageRowSpans_RECURSES
+
+#if !defined ImageRowSpans_h
+/** Prevents repeated inclusion of headers. */
+#define ImageRowSpans_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <cstdint>
+#include <cstddef>
+#include "boost/dynamic_bitset.hpp"
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  namespace functions {
+
+    /**
+     * Visits a rectangular domain as a sequence of rows along the
+     * first axis, in the order of the domain iterator: \a f( first,
+     * length ) is called for each row, where \a first is the first
+     * point of the row and \a length the number of its points.
+     *
+     * Only the row starts are computed with carries, hence the points
+     * of a row can be visited with a plain loop on the first
+     * coordinate:
+     * @code
+     * functions::forEachRow( domain, [&] ( const Point & first, std::size_t n )
+     *   {
+     *     for ( auto x = first[ 0 ]; x < first[ 0 ] + n; ++x ) ...
+     *   } );
+     * @endcode
+     *
+     * @tparam TSpace any model of CSpace.
+     * @tparam TFunctor a functor ( const Point &, std::size_t ).
+     *
+     * @param domain any domain (may be empty).
+     * @param f the functor.
+     */
+    template <typename TSpace, typename TFunctor>
+    void
+    forEachRow( const HyperRectDomain< TSpace > & domain, TFunctor f );
+
+    /**
+     * Visits the values of an image row by row: \a f( data, length,
+     * first ) is called for each row of \a subDomain, where \a data
+     * points to the \a length contiguous values of the row and \a first
+     * is the first point of the row.
+     *
+     * @tparam TDomain a HyperRectDomain.
+     * @tparam TValue the type of the values (not bool).
+     * @tparam TFunctor a functor ( Value *, std::size_t, const Point & ).
+     *
+     * @param image any image.
+     * @param subDomain a domain included in the image domain.
+     * @param f the functor.
+     */
+    template <typename TDomain, typename TValue, typename TFunctor>
+    void
+    forEachRowSpan( ImageContainerBySTLVector< TDomain, TValue > & image,
+                    const TDomain & subDomain, TFunctor f );
+
+    /**
+     * Visits the values of an image row by row (read only).
+     * @see forEachRowSpan( ImageContainerBySTLVector &, const TDomain &, TFunctor )
+     *
+     * @tparam TFunctor a functor ( const Value *, std::size_t, const Point & ).
+     * @param image any image.
+     * @param subDomain a domain included in the image domain.
+     * @param f the functor.
+     */
+    template <typename TDomain, typename TValue, typename TFunctor>
+    void
+    forEachRowSpan( const ImageContainerBySTLVector< TDomain, TValue > & image,
+                    const TDomain & subDomain, TFunctor f );
+
+    /**
+     * Visits all the values of an image row by row.
+     * @see forEachRowSpan( ImageContainerBySTLVector &, const TDomain &, TFunctor )
+     *
+     * @tparam TFunctor a functor ( Value *, std::size_t, const Point & ).
+     * @param image any image.
+     * @param f the functor.
+     */
+    template <typename TDomain, typename TValue, typename TFunctor>
+    void
+    forEachRowSpan( ImageContainerBySTLVector< TDomain, TValue > & image,
+                    TFunctor f );
+
+    /**
+     * Visits all the values of an image row by row (read only).
+     * @see forEachRowSpan( ImageContainerBySTLVector &, const TDomain &, TFunctor )
+     *
+     * @tparam TFunctor a functor ( const Value *, std::size_t, const Point & ).
+     * @param image any image.
+     * @param f the functor.
+     */
+    template <typename TDomain, typename TValue, typename TFunctor>
+    void
+    forEachRowSpan( const ImageContainerBySTLVector< TDomain, TValue > & image,
+                    TFunctor f );
+
+    /**
+     * Sets the values of the points of \a subDomain, a row at a time.
+     *
+     * @param[in,out] image any image.
+     * @param subDomain a domain included in the image domain.
+     * @param aValue the value to write.
+     */
+    template <typename TDomain, typename TValue>
+    void
+    fillImage( ImageContainerBySTLVector< TDomain, TValue > & image,
+               const TDomain & subDomain, const TValue & aValue );
+
+    /**
+     * Writes \a f( v ) in \a output for each value \a v of \a input,
+     * in one loop over the storage that the compiler can vectorize
+     * (with an OpenMP simd directive when WITH_OPENMP is defined).
+     *
+     * @tparam TFunctor a functor TInputValue -> TOutputValue.
+     *
+     * @param input any image.
+     * @param[out] output an image with the same domain as \a input.
+     * @param f the functor.
+     */
+    template <typename TDomain, typename TInputValue, typename TOutputValue,
+              typename TFunctor>
+    void
+    transformImage( const ImageContainerBySTLVector< TDomain, TInputValue > & input,
+                    ImageContainerBySTLVector< TDomain, TOutputValue > & output,
+                    TFunctor f );
+
+    /**
+     * Replaces each value \a v of \a image by \a f( v ).
+     * @see transformImage( const ImageContainerBySTLVector &, ImageContainerBySTLVector &, TFunctor )
+     *
+     * @tparam TFunctor a functor TValue -> TValue.
+     * @param[in,out] image any image.
+     * @param f the functor.
+     */
+    template <typename TDomain, typename TValue, typename TFunctor>
+    void
+    transformImage( ImageContainerBySTLVector< TDomain, TValue > & image,
+                    TFunctor f );
+
+    /**
+     * @tparam TPredicate a functor TValue -> bool.
+     * @param image any image.
+     * @param pred a predicate on values.
+     * @return the number of values of \a image that satisfy \a pred.
+     */
+    template <typename TDomain, typename TValue, typename TPredicate>
+    std::size_t
+    countIf( const ImageContainerBySTLVector< TDomain, TValue > & image,
+             TPredicate pred );
+
+    /**
+     * Sum of the values of an image, accumulated in type \a T.
+     *
+     * @param image any image.
+     * @param init the initial value of the sum.
+     * @return \a init plus the sum of the values of \a image.
+     */
+    template <typename TDomain, typename TValue, typename T>
+    T
+    sumImage( const ImageContainerBySTLVector< TDomain, TValue > & image, T init );
+
+    /**
+     * Converts a predicate on the values of an image to a bit mask:
+     * bit i is set iff the i-th value of the storage (see
+     * ImageContainerBySTLVector::linearized) satisfies \a pred. The
+     * bits are computed by blocks of 64.
+     *
+     * @tparam TPredicate a functor TValue -> bool.
+     * @param image any image.
+     * @param pred a predicate on values.
+     * @return the bit mask, of size image.size().
+     */
+    template <typename TDomain, typename TValue, typename TPredicate>
+    boost::dynamic_bitset< std::uint64_t >
+    bitmaskFromImage( const ImageContainerBySTLVector< TDomain, TValue > & image,
+                      TPredicate pred );
+
+  } // namespace functions
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/ImageRowSpans.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ImageRowSpans_h
+
+#undef ImageRowSpans_RECURSES
+#endif // else defined(ImageRowSpans_RECURSES)
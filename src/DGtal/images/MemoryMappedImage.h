@@ -0,0 +1,214 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file MemoryMappedImage.h
+ * @brief Read-only image viewing the values stored in a memory buffer,
+ * e.g. a memory-mapped file.
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module MemoryMappedImage.ih
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see testVolReader.cpp
+ */
+
+#if defined(MemoryMappedImage_RECURSES)
+#error Recursive header files inclusion detected in MemoryMappedImage.h
+#else // defined(MemoryMappedImage_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define MemoryMappedImage_RECURSES
+
+#if !defined MemoryMappedImage_h
+/** Prevents repeated inclusion of headers. */
+#define MemoryMappedImage_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <type_traits>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/domains/Linearizer.h"
+#include "DGtal/images/DefaultConstImageRange.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class MemoryMappedImage
+  /**
+   * Description of template class 'MemoryMappedImage' <p>
+   * \brief Aim: model of CConstImage whose values are read directly
+   * from a memory buffer, without any copy.
+   *
+   * The values are stored in the buffer in the order of the domain
+   * points (first coordinate first, see Linearizer), as in
+   * ImageContainerBySTLVector. The buffer is typically the payload of
+   * a memory-mapped file (see MemoryMappedFile), so that a large
+   * image can be used as soon as its header is parsed, the pages
+   * being loaded by the system on demand. The values are read with
+   * std::memcpy, so that the payload does not have to be aligned.
+   *
+   * The image shares the ownership of the object holding the buffer:
+   * copies are shallow and the buffer lives as long as one of them.
+   *
+   * Example usage:
+   * @code
+   * typedef ImageSelector<Z3i::Domain, unsigned char>::Type Image;
+   * MemoryMappedImage<Z3i::Domain, unsigned char> image = VolReader<Image>::mapVol( "data.vol" );
+   * for ( auto const & p : image.domain() )
+   *   ... image( p ) ...
+   * @endcode
+   *
+   * @tparam TDomain a HyperRectDomain.
+   * @tparam TValue the type of the stored values (trivially copyable).
+   *
+   * @see ArrayImageAdapter
+   * @see VolReader::mapVol, LongvolReader::mapLongvol, RawReader::mapRaw
+   */
+  template <typename TDomain, typename TValue>
+  class MemoryMappedImage
+  {
+    // ----------------------- Types ------------------------------
+  public:
+
+    typedef MemoryMappedImage<TDomain, TValue> Self;
+    typedef TDomain Domain;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Vector Vector;
+    typedef typename Domain::Dimension Dimension;
+    typedef typename Domain::Size Size;
+    typedef TValue Value;
+    typedef DefaultConstImageRange<Self> ConstRange;
+
+    BOOST_STATIC_ASSERT(( boost::is_same< Domain,
+                          HyperRectDomain<typename Domain::Space> >::value ));
+    BOOST_STATIC_ASSERT(( std::is_trivially_copyable<Value>::value ));
+    BOOST_STATIC_CONSTANT( Dimension, dimension = Domain::dimension );
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Default constructor. Empty image.
+     */
+    MemoryMappedImage();
+
+    /**
+     * Constructor.
+     *
+     * @param aDomain the image domain.
+     * @param aData a pointer on the first value, whose buffer holds at
+     * least aDomain.size() values.
+     * @param aStorage the object owning the buffer (may be empty if
+     * the buffer is owned elsewhere).
+     */
+    MemoryMappedImage( const Domain & aDomain,
+                       const unsigned char * aData,
+                       std::shared_ptr<const void> aStorage );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * @return the image domain.
+     */
+    const Domain & domain() const;
+
+    /**
+     * @return the range of the image values.
+     */
+    ConstRange constRange() const;
+
+    /**
+     * @param aPoint a point of the domain.
+     * @return the value at @a aPoint.
+     */
+    Value operator()( const Point & aPoint ) const;
+
+    /**
+     * @param anIndex an index in [0, domain().size()).
+     * @return the value at @a anIndex, in the order of the domain points.
+     */
+    Value operator[]( const Size anIndex ) const;
+
+    /**
+     * @return a pointer on the first byte of the values.
+     */
+    const unsigned char * data() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// Image domain
+    Domain myDomain;
+
+    /// Extent of the image domain
+    Vector myExtent;
+
+    /// First byte of the values
+    const unsigned char * myData;
+
+    /// Owner of the buffer
+    std::shared_ptr<const void> myStorage;
+
+  }; // end of class MemoryMappedImage
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'MemoryMappedImage'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'MemoryMappedImage' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TDomain, typename TValue>
+  std::ostream&
+  operator<< ( std::ostream & out, const MemoryMappedImage<TDomain, TValue> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/MemoryMappedImage.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined MemoryMappedImage_h
+
+#undef MemoryMappedImage_RECURSES
+#endif // else defined(MemoryMappedImage_RECURSES)
@@ -0,0 +1,372 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ChunkedVolLayout.h
+ * @brief Layout of the chunked volume files (.cvol): header, brick
+ * index and compressed bricks.
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module ChunkedVolLayout.ih
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see ChunkedVolReader.h
+ * @see ChunkedVolWriter.h
+ * @see ImageFactoryFromChunkedVol.h
+ */
+
+#if defined(ChunkedVolLayout_RECURSES)
+#error Recursive header files inclusion detected in ChunkedVolLayout.h
+#else // defined(ChunkedVolLayout_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ChunkedVolLayout_RECURSES
+
+#if !defined ChunkedVolLayout_h
+/** Prevents repeated inclusion of headers. */
+#define ChunkedVolLayout_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/domains/Linearizer.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ChunkedVolLayout
+  /**
+   * Description of template class 'ChunkedVolLayout' <p>
+   * \brief Aim: describes the layout of a chunked volume file and
+   * encodes/decodes its bricks.
+   *
+   * A chunked volume file (extension .cvol) stores an image of any
+   * dimension as a grid of bricks (e.g. 64^3 voxels), each brick
+   * being compressed independently with zlib, so that the bricks can
+   * be compressed and decompressed in parallel and a sub-block of the
+   * image can be read without decompressing the others. The file is
+   * made of:
+   * - a text header, in the spirit of the Vol format:
+   * @code
+   * Chunked-Vol: 1
+   * Dimension: 3
+   * Lower: 0 0 0
+   * Upper: 255 255 255
+   * Brick: 64 64 64
+   * Value-Size: 1
+   * .
+   * @endcode
+   * - the brick index: for each brick, the offset of its compressed
+   *   data from the beginning of the file and its compressed size
+   *   (two 64-bit unsigned integers, host byte order);
+   * - the compressed bricks.
+   *
+   * The bricks are numbered in the order of the brick grid and the
+   * values within a brick in the order of the brick points (first
+   * coordinate first, see Linearizer). The bricks on the upper
+   * boundary of the image may be smaller than the others. The values
+   * are stored as raw bytes in the host byte order.
+   *
+   * Since the bricks are located through the index only, a brick may
+   * be rewritten by appending it at the end of the file and updating
+   * its index entry (see ImageFactoryFromChunkedVol::flushImage).
+   *
+   * @tparam TDomain a HyperRectDomain.
+   *
+   * @see ChunkedVolReader, ChunkedVolWriter, ImageFactoryFromChunkedVol
+   */
+  template <typename TDomain>
+  class ChunkedVolLayout
+  {
+    // ----------------------- Types ------------------------------
+  public:
+
+    typedef TDomain Domain;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Vector Vector;
+    typedef typename Domain::Dimension Dimension;
+    typedef typename Linearizer<Domain>::Size Size;
+
+    BOOST_STATIC_ASSERT(( boost::is_same< Domain,
+                          HyperRectDomain<typename Domain::Space> >::value ));
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Default constructor. Empty layout, to be read from a file.
+     */
+    ChunkedVolLayout();
+
+    /**
+     * Constructor. The index is filled with zeros.
+     *
+     * @param aDomain the image domain.
+     * @param aBrickExtent the extent of the bricks (positive).
+     * @param aValueSize the size of a value in bytes.
+     */
+    ChunkedVolLayout( const Domain & aDomain,
+                      const Vector & aBrickExtent,
+                      const std::size_t aValueSize );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * @return the image domain.
+     */
+    const Domain & domain() const;
+
+    /**
+     * @return the extent of the bricks.
+     */
+    const Vector & brickExtent() const;
+
+    /**
+     * @return the size of a value in bytes.
+     */
+    std::size_t valueSize() const;
+
+    /**
+     * @return the number of bricks.
+     */
+    Size nbBricks() const;
+
+    /**
+     * @param aBrick a brick index in [0, nbBricks()).
+     * @return the domain of the brick, clipped to the image domain.
+     */
+    Domain brickDomain( const Size aBrick ) const;
+
+    /**
+     * @param aDomain any domain.
+     * @return the indices of the bricks intersecting @a aDomain, in
+     * increasing order.
+     */
+    std::vector<Size> bricks( const Domain & aDomain ) const;
+
+    /**
+     * @param aBrick a brick index in [0, nbBricks()).
+     * @return the offset of the compressed brick in the file.
+     */
+    DGtal::uint64_t brickOffset( const Size aBrick ) const;
+
+    /**
+     * @param aBrick a brick index in [0, nbBricks()).
+     * @return the compressed size of the brick in bytes.
+     */
+    DGtal::uint64_t brickSize( const Size aBrick ) const;
+
+    /**
+     * Sets the index entry of a brick.
+     *
+     * @param aBrick a brick index in [0, nbBricks()).
+     * @param anOffset the offset of the compressed brick in the file.
+     * @param aSize the compressed size of the brick in bytes.
+     */
+    void setBrick( const Size aBrick, const DGtal::uint64_t anOffset,
+                   const DGtal::uint64_t aSize );
+
+    /**
+     * @return the offset of the brick index in the file (i.e. the size
+     * of the text header).
+     */
+    std::size_t indexOffset() const;
+
+    /**
+     * @return the offset of the first compressed brick in the file
+     * (i.e. the size of the header and of the index).
+     */
+    std::size_t dataOffset() const;
+
+    /**
+     * Writes the header and the index.
+     *
+     * @param out the output stream, positioned at the beginning of the
+     * file.
+     */
+    void write( std::ostream & out ) const;
+
+    /**
+     * Writes an index entry of a brick at its position in the file.
+     * The index of the layout itself is not modified (see setBrick).
+     *
+     * @param out the output stream.
+     * @param aBrick a brick index in [0, nbBricks()).
+     * @param anOffset the offset of the compressed brick in the file.
+     * @param aSize the compressed size of the brick in bytes.
+     */
+    void writeIndexEntry( std::ostream & out, const Size aBrick,
+                          const DGtal::uint64_t anOffset,
+                          const DGtal::uint64_t aSize ) const;
+
+    /**
+     * Reads the header and the index from the content of a file.
+     * An IOException is thrown if the content is not a valid chunked
+     * volume.
+     *
+     * @param aData the first byte of the file.
+     * @param aSize the size of the file in bytes.
+     */
+    void read( const unsigned char * aData, const std::size_t aSize );
+
+    /**
+     * Decompresses in parallel the bricks intersecting the domain of
+     * @a anImage and sets the values of @a anImage.
+     *
+     * The bricks are decompressed by the threads of
+     * WorkStealingScheduler, the values being set in @a anImage by one
+     * thread at a time.
+     *
+     * @tparam TImage a model of CImage whose values are trivially
+     * copyable and of size valueSize().
+     * @param aData the first byte of the file.
+     * @param anImage the image to fill, whose domain is included in
+     * the image domain.
+     */
+    template <typename TImage>
+    void decode( const unsigned char * aData, TImage & anImage ) const;
+
+    /**
+     * Compresses in parallel the given bricks from the values of
+     * @a anImage.
+     *
+     * The values of a brick are read from @a anImage by one thread at
+     * a time, the bricks being compressed by the threads of
+     * WorkStealingScheduler. If a brick is not included in the domain
+     * of @a anImage, its values outside that domain are read from
+     * the current brick in @a aData (or set to zero if @a aData is
+     * null).
+     *
+     * @tparam TImage a model of CConstImage whose values are
+     * trivially copyable and of size valueSize().
+     * @param aData the first byte of the file, or null.
+     * @param anImage the image whose values are compressed.
+     * @param someBricks indices of the bricks to compress.
+     * @param aLevel the zlib compression level (-1 for the default
+     * one).
+     * @return the compressed bricks.
+     */
+    template <typename TImage>
+    std::vector< std::vector<unsigned char> >
+    encode( const unsigned char * aData, const TImage & anImage,
+            const std::vector<Size> & someBricks, const int aLevel ) const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @return the text header.
+     */
+    std::string header() const;
+
+    /**
+     * Computes the brick grid and resets the index.
+     */
+    void initGrid();
+
+    /**
+     * Parses a non-negative integer header field.
+     *
+     * @param aKey the name of the field.
+     * @param aValue the text of the field.
+     * @return the value of the field.
+     * @throw IOException if the field is not a non-negative integer.
+     */
+    static DGtal::uint64_t parseCount( const std::string & aKey,
+                                       const std::string & aValue );
+
+    /**
+     * Decompresses a brick.
+     *
+     * @param aData the first byte of the file.
+     * @param aBrick a brick index.
+     * @param[out] aBuffer the brick values (resized).
+     */
+    void inflateBrick( const unsigned char * aData, const Size aBrick,
+                       std::vector<unsigned char> & aBuffer ) const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// Image domain
+    Domain myDomain;
+
+    /// Extent of the bricks
+    Vector myBrickExtent;
+
+    /// Number of bricks along each axis
+    Vector myGridExtent;
+
+    /// Size of a value in bytes
+    std::size_t myValueSize;
+
+    /// Size of the text header in bytes
+    std::size_t myHeaderSize;
+
+    /// Offset and compressed size of each brick
+    std::vector<DGtal::uint64_t> myIndex;
+
+  }; // end of class ChunkedVolLayout
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ChunkedVolLayout'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ChunkedVolLayout' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TDomain>
+  std::ostream&
+  operator<< ( std::ostream & out, const ChunkedVolLayout<TDomain> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/ChunkedVolLayout.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ChunkedVolLayout_h
+
+#undef ChunkedVolLayout_RECURSES
+#endif // else defined(ChunkedVolLayout_RECURSES)
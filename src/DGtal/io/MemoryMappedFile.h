@@ -0,0 +1,178 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file MemoryMappedFile.h
+ * @brief Read-only memory mapping of a file.
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module MemoryMappedFile.ih
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see MemoryMappedImage.h
+ */
+
+#if defined(MemoryMappedFile_RECURSES)
+#error Recursive header files inclusion detected in MemoryMappedFile.h
+#else // defined(MemoryMappedFile_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define MemoryMappedFile_RECURSES
+
+#if !defined MemoryMappedFile_h
+/** Prevents repeated inclusion of headers. */
+#define MemoryMappedFile_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class MemoryMappedFile
+  /**
+   * Description of class 'MemoryMappedFile' <p>
+   * \brief Aim: Maps a whole file in memory (read-only), so that its
+   * content can be accessed without any copy.
+   *
+   * The mapping is done with mmap on POSIX systems. On Windows, the
+   * file is read at once into a buffer.
+   *
+   * Example usage:
+   * @code
+   * MemoryMappedFile file( "data.raw" );
+   * const unsigned char * bytes = file.data();
+   * for ( std::size_t i = 0; i < file.size(); ++i )
+   *   ... bytes[ i ] ...
+   * @endcode
+   *
+   * @note An IOException is thrown if the file cannot be opened or
+   * mapped.
+   *
+   * @see MemoryMappedImage
+   */
+  class MemoryMappedFile
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. Maps the file.
+     *
+     * @param filename the name of the file to map.
+     */
+    explicit MemoryMappedFile( const std::string & filename );
+
+    /**
+     * Destructor. Unmaps the file.
+     */
+    ~MemoryMappedFile();
+
+    /**
+     * Copy constructor.
+     * Forbidden.
+     */
+    MemoryMappedFile( const MemoryMappedFile & other ) = delete;
+
+    /**
+     * Assignment.
+     * Forbidden.
+     */
+    MemoryMappedFile & operator=( const MemoryMappedFile & other ) = delete;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * @return a pointer on the first byte of the file.
+     */
+    const unsigned char * data() const;
+
+    /**
+     * @return the size of the file in bytes.
+     */
+    std::size_t size() const;
+
+    /**
+     * @return the name of the mapped file.
+     */
+    const std::string & filename() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// Name of the file
+    std::string myFilename;
+
+    /// First byte of the file (or nullptr for an empty file)
+    const unsigned char * myData;
+
+    /// Size of the file in bytes
+    std::size_t mySize;
+
+#ifdef _WIN32
+    /// Content of the file
+    std::vector<unsigned char> myBuffer;
+#endif
+
+  }; // end of class MemoryMappedFile
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'MemoryMappedFile'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'MemoryMappedFile' to write.
+   * @return the output stream after the writing.
+   */
+  std::ostream&
+  operator<< ( std::ostream & out, const MemoryMappedFile & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/MemoryMappedFile.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined MemoryMappedFile_h
+
+#undef MemoryMappedFile_RECURSES
+#endif // else defined(MemoryMappedFile_RECURSES)
@@ -0,0 +1,138 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ChunkedVolReader.h
+ * @brief Reading of chunked volume files (.cvol).
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module ChunkedVolReader.ih
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see testChunkedVol.cpp
+ */
+
+#if defined(ChunkedVolReader_RECURSES)
+#error Recursive header files inclusion detected in ChunkedVolReader.h
+#else // defined(ChunkedVolReader_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ChunkedVolReader_RECURSES
+
+#if !defined ChunkedVolReader_h
+/** Prevents repeated inclusion of headers. */
+#define ChunkedVolReader_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <type_traits>
+#include <boost/static_assert.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/io/ChunkedVolLayout.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ChunkedVolReader
+  /**
+   * Description of template class 'ChunkedVolReader' <p>
+   * \brief Aim: implements methods to read a chunked volume file
+   * (see ChunkedVolLayout for the file format).
+   *
+   * The file is memory-mapped and its bricks are decompressed in
+   * parallel (see WorkStealingScheduler). The method
+   * "importChunkedVol" with a domain only decompresses the bricks
+   * intersecting that domain.
+   *
+   * The values of the file must have the size of the values of the
+   * image container, they are copied byte per byte.
+   *
+   * Example usage:
+   * @code
+   * typedef ImageContainerBySTLVector<Z3i::Domain, DGtal::uint16_t> Image;
+   * Image image = ChunkedVolReader<Image>::importChunkedVol( "data.cvol" );
+   * Image block = ChunkedVolReader<Image>::importChunkedVol( "data.cvol",
+   *     Z3i::Domain( Z3i::Point( 64, 64, 64 ), Z3i::Point( 127, 127, 127 ) ) );
+   * @endcode
+   *
+   * @tparam TImageContainer the image container to use (model of
+   * CImage, with trivially copyable values).
+   *
+   * @see ChunkedVolWriter, ImageFactoryFromChunkedVol
+   */
+  template <typename TImageContainer>
+  struct ChunkedVolReader
+  {
+    // ----------------------- Standard services ------------------------------
+
+    typedef TImageContainer ImageContainer;
+    typedef typename TImageContainer::Value Value;
+    typedef typename TImageContainer::Domain Domain;
+
+    BOOST_STATIC_ASSERT(( std::is_trivially_copyable<Value>::value ));
+
+    /**
+     * Main method to import a chunked volume into an instance of the
+     * template parameter ImageContainer.
+     *
+     * @param filename the file name to import.
+     * @return an instance of the ImageContainer.
+     */
+    static ImageContainer importChunkedVol( const std::string & filename );
+
+    /**
+     * Imports a block of a chunked volume, decompressing only the
+     * bricks intersecting that block.
+     *
+     * @param filename the file name to import.
+     * @param aDomain the domain of the block, included in the image
+     * domain.
+     * @return an instance of the ImageContainer, of domain @a aDomain.
+     */
+    static ImageContainer importChunkedVol( const std::string & filename,
+                                            const Domain & aDomain );
+
+    /**
+     * Reads the header and the index of a chunked volume.
+     *
+     * @param filename the file name.
+     * @return the layout of the file.
+     */
+    static ChunkedVolLayout<Domain> layout( const std::string & filename );
+
+  }; // end of class ChunkedVolReader
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/readers/ChunkedVolReader.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ChunkedVolReader_h
+
+#undef ChunkedVolReader_RECURSES
+#endif // else defined(ChunkedVolReader_RECURSES)
@@ -44,10 +44,14 @@
 #include <sstream>
 #include <string>
 #include <cstdio>
+#include <memory>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include <boost/static_assert.hpp>
 #include "DGtal/helpers/StdDefs.h"
 #include "DGtal/base/CUnaryFunctor.h"
+#include "DGtal/io/MemoryMappedFile.h"
+#include "DGtal/images/MemoryMappedImage.h"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -64,6 +68,12 @@ namespace DGtal
    * The main import method "importLongvol" returns an instance of the template
    * parameter TImageContainer.
    *
+   * The method "mapLongvol" returns instead a read-only view on the
+   * voxels (see MemoryMappedImage). For an uncompressed file
+   * (Version 2), the file is memory-mapped and the voxels are not
+   * copied. A compressed file (Version 3) is uncompressed into a
+   * buffer owned by the view.
+   *
    * The private methods have been backported from the Simplelvol project
    * (see http://liris.cnrs.fr/david.coeurjolly).
    *
@@ -113,28 +123,50 @@ namespace DGtal
      */
     static ImageContainer importLongvol(const std::string & filename,
                                         const Functor & aFunctor =  Functor());
+
+    /**
+     * Maps the voxels of a Longvol file as a read-only image, without
+     * copying them if the file is not compressed.
+     *
+     * @param filename the file name to import.
+     *
+     * @return a view on the voxels, which keeps the file mapped.
+     */
+    static MemoryMappedImage<typename ImageContainer::Domain, DGtal::uint64_t>
+    mapLongvol(const std::string & filename);
     
     
     
   private:
-    
+
+    /// Opened file, closed when the handle is destroyed.
+    typedef std::unique_ptr<FILE, decltype(&fclose)> FileHandle;
+
+    /**
+     * Opens a Longvol file and reads its header.
+     *
+     * @param filename the file name to import.
+     * @param domain (returns) the image domain.
+     * @param version (returns) the version of the file format.
+     *
+     * @return the file, positioned at the first voxel.
+     */
+    static FileHandle readHeader(const std::string & filename,
+                             typename ImageContainer::Domain & domain,
+                             int & version);
+
     /**
-     * Generic read word (binary mode) in little-endian mode.
+     * Reads the voxels at once (and uncompresses them if needed).
      *
-     * @param fin input stream.
-     * @param aValue value to write.
+     * @param fin the file, positioned at the first voxel.
+     * @param totalbytes the number of bytes of the voxels.
+     * @param compressed 'true' if the voxels are compressed.
      *
-     * @return modified stream.
+     * @return the bytes of the voxels.
      */
-    template <typename Word>
-    static
-    std::stringstream& read_word( std::stringstream & fin, Word& aValue )
-    {
-      char* raw = reinterpret_cast<char*>(&aValue);
-      for (std::size_t i = 0; i < sizeof(Word); ++i)
-          raw[i] = fin.get();
-      return fin;
-    }
+    static std::vector<char> readPayload(FILE * fin, std::size_t totalbytes,
+                                         bool compressed);
+    
     
     
     typedef unsigned char voxel;
@@ -43,8 +43,11 @@
 #include <iostream>
 #include <string>
 #include <cstdio>
+#include <memory>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CUnaryFunctor.h"
+#include "DGtal/io/MemoryMappedFile.h"
+#include "DGtal/images/MemoryMappedImage.h"
 #include <boost/static_assert.hpp>
 //////////////////////////////////////////////////////////////////////////////
 
@@ -64,6 +67,10 @@ namespace DGtal
    *
    * All these methods return an instance of the template parameter \c TImageContainer. A functor can be specified to convert raw values to image values.
    *
+   * The method \c mapRaw returns instead a read-only view on the
+   * values of the memory-mapped file (see MemoryMappedImage), without
+   * any copy. The values are then read in the byte order of the host.
+   *
    * Example usage:
    * @code
    * ...
@@ -166,6 +173,20 @@ namespace DGtal
              const Vector & extent,
              const Functor & aFunctor =  Functor());
 
+    /**
+     * Maps a Raw file (any type stored in the byte order of the host)
+     * as a read-only image, without copying its values.
+     *
+     * @tparam Word read pixel type.
+     * @param filename the file name to import.
+     * @param extent the size of the raw data set.
+     * @return a view on the values, which keeps the file mapped.
+     */
+    template <typename Word>
+    static MemoryMappedImage<typename ImageContainer::Domain, Word>
+    mapRaw(const std::string & filename,
+           const Vector & extent);
+
 
   private:
 
@@ -44,8 +44,12 @@
 #include <sstream>
 #include <string>
 #include <cstdio>
+#include <memory>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CUnaryFunctor.h"
+#include "DGtal/io/MemoryMappedFile.h"
+#include "DGtal/images/MemoryMappedImage.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -60,6 +64,12 @@ namespace DGtal
    * The main import method "importVol" returns an instance of the template 
    * parameter TImageContainer.
    *
+   * The method "mapVol" returns instead a read-only view on the
+   * voxels (see MemoryMappedImage). For an uncompressed file
+   * (Version 2), the file is memory-mapped and the voxels are not
+   * copied. A compressed file (Version 3) is uncompressed into a
+   * buffer owned by the view.
+   *
    * The private methods have been backported from the SimpleVol project 
    * (see http://liris.cnrs.fr/david.coeurjolly).
    *
@@ -113,9 +123,48 @@ namespace DGtal
      */
     static ImageContainer importVol(const std::string & filename, 
                                     const Functor & aFunctor =  Functor());
+
+    /**
+     * Maps the voxels of a Vol file as a read-only image, without
+     * copying them if the file is not compressed.
+     *
+     * @param filename the file name to import.
+     *
+     * @return a view on the voxels, which keeps the file mapped.
+     */
+    static MemoryMappedImage<typename ImageContainer::Domain, unsigned char>
+    mapVol(const std::string & filename);
     
   private:
 
+    /// Opened file, closed when the handle is destroyed.
+    typedef std::unique_ptr<FILE, decltype(&fclose)> FileHandle;
+
+    /**
+     * Opens a Vol file and reads its header.
+     *
+     * @param filename the file name to import.
+     * @param domain (returns) the image domain.
+     * @param version (returns) the version of the file format.
+     *
+     * @return the file, positioned at the first voxel.
+     */
+    static FileHandle readHeader(const std::string & filename,
+                             typename ImageContainer::Domain & domain,
+                             int & version);
+
+    /**
+     * Reads the voxels at once (and uncompresses them if needed).
+     *
+     * @param fin the file, positioned at the first voxel.
+     * @param total the number of voxels.
+     * @param compressed 'true' if the voxels are compressed.
+     *
+     * @return the voxels.
+     */
+    static std::vector<char> readPayload(FILE * fin, std::size_t total,
+                                         bool compressed);
+
     typedef unsigned char voxel;
     /**
      * This class help us to associate a field type and his value.
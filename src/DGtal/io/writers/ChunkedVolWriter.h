@@ -0,0 +1,108 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ChunkedVolWriter.h
+ * @brief Writing of chunked volume files (.cvol).
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module ChunkedVolWriter.ih
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see testChunkedVol.cpp
+ */
+
+#if defined(ChunkedVolWriter_RECURSES)
+#error Recursive header files inclusion detected in ChunkedVolWriter.h
+#else // defined(ChunkedVolWriter_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ChunkedVolWriter_RECURSES
+
+#if !defined ChunkedVolWriter_h
+/** Prevents repeated inclusion of headers. */
+#define ChunkedVolWriter_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <type_traits>
+#include <boost/static_assert.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/io/ChunkedVolLayout.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ChunkedVolWriter
+  /**
+   * Description of template struct 'ChunkedVolWriter' <p>
+   * \brief Aim: Export an Image of any dimension as a chunked volume
+   * (see ChunkedVolLayout for the file format).
+   *
+   * The image is cut into bricks which are compressed in parallel
+   * (see WorkStealingScheduler). The image values are read by one
+   * thread at a time, so that any model of CConstImage can be
+   * exported (e.g. a TiledImage).
+   *
+   * @tparam TImage the Image type (values trivially copyable).
+   *
+   * @see ChunkedVolReader, ImageFactoryFromChunkedVol
+   */
+  template <typename TImage>
+  struct ChunkedVolWriter
+  {
+    // ----------------------- Standard services ------------------------------
+    typedef TImage Image;
+    typedef typename TImage::Value Value;
+    typedef typename TImage::Domain Domain;
+    typedef typename Domain::Vector Vector;
+
+    BOOST_STATIC_ASSERT(( std::is_trivially_copyable<Value>::value ));
+
+    /**
+     * Export an Image with the chunked volume format.
+     *
+     * @param filename name of the output file
+     * @param aImage the image to export
+     * @param aBrickExtent the extent of the bricks
+     * @param aLevel the zlib compression level (from 0 to 9, -1 for
+     * the default one)
+     * @return true if no errors occur.
+     */
+    static bool exportChunkedVol( const std::string & filename, const Image & aImage,
+                                  const Vector & aBrickExtent = Vector::diagonal( 64 ),
+                                  const int aLevel = -1 );
+  };
+}//namespace
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/writers/ChunkedVolWriter.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ChunkedVolWriter_h
+
+#undef ChunkedVolWriter_RECURSES
+#endif // else defined(ChunkedVolWriter_RECURSES)
@@ -0,0 +1,845 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+/**
+ * @file ConcurrentUnorderedSetByBlock.h
+ *
+ * @date 2026/10/17
+ *
+ */
+#ifndef CONCURRENTUNORDEREDSETBYBLOCK_HPP
+#define CONCURRENTUNORDEREDSETBYBLOCK_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <unordered_map>
+#include <boost/iterator/iterator_facade.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Bits.h"
+#include "DGtal/base/WorkStealingScheduler.h"
+#include "DGtal/kernel/UnorderedSetByBlock.h"
+#include "DGtal/kernel/sets/DigitalSetByAssociativeContainer.h"
+
+namespace DGtal
+{
+
+  /// This data structure is a variant of \ref UnorderedSetByBlock
+  /// that can be filled by several threads at the same time. Points
+  /// are grouped by blocks of 32 (or 64) consecutive points along x,
+  /// and each block is a word whose bits tell which points are in the
+  /// set. Blocks are distributed over a power of two number of shards
+  /// according to their hash. Each shard is an unordered_map from
+  /// blocks to atomic words protected by its own mutex: an insertion
+  /// only locks the shard of its block to find or create the word,
+  /// then sets its bit with an atomic `fetch_or` once the lock is
+  /// released. Threads inserting points of different shards never
+  /// wait for each other.
+  ///
+  /// The following services may be called concurrently: \ref insert
+  /// (with or without hint, and on ranges), \ref emplace, \ref
+  /// insert_block, \ref count and \ref size (which is exact once
+  /// insertions are finished). All other services (iterators, find,
+  /// erase, clear, copies) require that no other thread modifies the
+  /// set: insertions may rehash a shard and invalidate its iterators,
+  /// as with std::unordered_set. For the same reason, the iterator
+  /// returned by \ref insert may only be used once insertions have
+  /// stopped.
+  ///
+  /// Blocks are visited in parallel with \ref for_each_block, which
+  /// distributes the shards with WorkStealingScheduler.
+  ///
+  /// Almost all standard operations of unordered_set in c++11 are
+  /// implemented, so that it can be used in
+  /// DigitalSetByAssociativeContainer (see \ref
+  /// DigitalSetByConcurrentBlocks).
+  ///
+  /// @tparam Key the type of integral array.
+  /// @tparam TSplitter the type for splitting a key into a block and a bit (see \ref Splitter).
+  /// @tparam Hash the type that provides a hasher for Key.
+  /// @tparam KeyEqual the type that provides an equality comparator for Key.
+  ///
+  /// @code
+  /// #include "DGtal/kernel/ConcurrentUnorderedSetByBlock.h"
+  /// ...
+  /// typedef DGtal::PointVector< 3, int >  Point3i;
+  /// DGtal::ConcurrentUnorderedSetByBlock< Point3i > aSet;
+  /// WorkStealingScheduler::forEach( n,
+  ///   [&] ( std::size_t first, std::size_t last, unsigned int )
+  ///   {
+  ///     for ( std::size_t i = first; i < last; ++i )
+  ///       aSet.insert( someComputation( i ) );
+  ///   } );
+  /// @endcode
+  template < typename Key,
+             typename TSplitter = Splitter< Key >,
+             class Hash = std::hash<Key>,
+             class KeyEqual = std::equal_to<Key> >
+  struct ConcurrentUnorderedSetByBlock {
+    typedef ConcurrentUnorderedSetByBlock< Key, TSplitter, Hash, KeyEqual > Self;
+    typedef TSplitter               Splitter;
+    typedef typename Splitter::Word Word;
+    typedef typename Splitter::Coordinate Coordinate;
+    /// The type of the words, modified with atomic operations.
+    typedef std::atomic< Word >     AtomicWord;
+    /// The container of a shard, an unordered_map.
+    typedef std::unordered_map< Key, AtomicWord, Hash, KeyEqual > Container;
+
+    // Standard types
+    /// Key
+    typedef Key key_type;
+    /// Key
+    typedef Key value_type;
+    /// Unsigned integer type (usually std::size_t)
+    typedef typename Container::size_type size_type;
+    /// Signed integer type (usually std::ptrdiff_t)
+    typedef typename Container::difference_type difference_type;
+    /// Hash
+    typedef Hash     hasher;
+    /// KeyEqual
+    typedef KeyEqual key_equal;
+    /// Reference to value_type/Key
+    typedef Key& reference;
+    /// Const reference to value_type/Key
+    typedef const Key& const_reference;
+    /// Pointer to value_type/Key
+    typedef Key* pointer;
+    /// Const Pointer to value_type/Key
+    typedef const Key* const_pointer;
+
+  private:
+    /// A part of the blocks, with its own lock. Shards are aligned
+    /// on cache lines so that their locks and counters are not
+    /// shared between cores.
+    struct alignas( 64 ) Shard {
+      /// Protects the structure of the map (not the words).
+      mutable std::mutex     mutex;
+      /// The blocks of this shard.
+      Container              blocks;
+      /// The number of elements in this shard.
+      std::atomic<size_type> size { 0 };
+    };
+
+  public:
+    // ---------------------- iterators --------------------------------
+
+    /// Read iterator on set elements. Model of ForwardIterator.
+    /// Shards are visited one after the other.
+    struct const_iterator
+      : public boost::iterator_facade< const_iterator, Key const,
+                                       boost::forward_traversal_tag,
+                                       Key const >
+    {
+      friend struct ConcurrentUnorderedSetByBlock< Key, TSplitter, Hash, KeyEqual >;
+      /// Elements are returned by value, but the iterator is
+      /// multi-pass (required by DigitalSetByAssociativeContainer).
+      typedef std::forward_iterator_tag iterator_category;
+      /// Default constructor
+      const_iterator() : collection( nullptr ), shard( 0 ), it(),
+                         bit( static_cast<Coordinate>(0) ),
+                         current( static_cast<Word>(0) ) {}
+
+    private:
+      /// Constructor from set, shard and block iterator in this
+      /// shard, which may be the end of the shard.
+      /// @param aSet a reference to the visited set
+      /// @param aShard the index of a shard.
+      /// @param anIt an iterator in the blocks of this shard.
+      const_iterator( const Self& aSet, size_type aShard,
+                      typename Container::const_iterator anIt )
+        : collection( &aSet ), shard( aShard ), it( anIt )
+      {
+        load();
+      }
+
+      /// Constructor from set, shard, block iterator and starting bit
+      /// @param aSet a reference to the visited set
+      /// @param aShard the index of a shard.
+      /// @param anIt a valid iterator in the blocks of this shard.
+      /// @param aBit the bit index in the word pointed by \a anIt.
+      const_iterator( const Self& aSet, size_type aShard,
+                      typename Container::const_iterator anIt,
+                      Coordinate aBit )
+        : collection( &aSet ), shard( aShard ), it( anIt ), bit( aBit )
+      {
+        current  = it->second.load( std::memory_order_relaxed );
+        current &= ~( ( static_cast<Word>(1) << bit ) - static_cast<Word>(1) );
+      }
+
+      /// Constructor from set, shard, block iterator, starting bit
+      /// and word of the block, which does not read the block.
+      /// @param aSet a reference to the visited set
+      /// @param aShard the index of a shard.
+      /// @param anIt an iterator in the blocks of this shard.
+      /// @param aBit the bit index in the word pointed by \a anIt.
+      /// @param aWord the word of the block pointed by \a anIt.
+      const_iterator( const Self& aSet, size_type aShard,
+                      typename Container::const_iterator anIt,
+                      Coordinate aBit, Word aWord )
+        : collection( &aSet ), shard( aShard ), it( anIt ), bit( aBit )
+      {
+        current  = aWord;
+        current &= ~( ( static_cast<Word>(1) << bit ) - static_cast<Word>(1) );
+      }
+
+      /// Reads the block pointed by \a it, or the first block of the
+      /// next non-empty shard if \a it is the end of its shard.
+      void load()
+      {
+        const size_type nb = collection->my_nb_shards;
+        while ( shard < nb && it == collection->my_shards[ shard ].blocks.cend() )
+          if ( ++shard < nb ) it = collection->my_shards[ shard ].blocks.cbegin();
+        if ( shard < nb )
+          {
+            current = it->second.load( std::memory_order_relaxed );
+            bit     = static_cast<Coordinate>( Bits::leastSignificantBit( current ) );
+          }
+        else
+          {
+            it      = typename Container::const_iterator();
+            current = static_cast<Word>(0);
+            bit     = static_cast<Coordinate>(0);
+          }
+      }
+
+      friend class boost::iterator_core_access;
+      void increment()
+      {
+        ASSERT( current != static_cast<Word>(0)
+                && "Invalid increment on const_iterator" );
+        current &= ~( static_cast<Word>(1) << bit );
+        if ( current == static_cast<Word>(0) )
+          {
+            ++it;
+            load();
+          }
+        else
+          bit = static_cast<Coordinate>( Bits::leastSignificantBit( current ) );
+      }
+
+      bool equal( const const_iterator & other ) const
+      {
+        ASSERT( collection == other.collection );
+        return shard == other.shard && it == other.it && bit == other.bit;
+      }
+
+      const Key dereference() const
+      {
+        return collection->my_splitter.join( it->first, bit );
+      }
+
+      /// the collection that this iterator is traversing.
+      const Self*                  collection;
+      /// the index of the visited shard (the number of shards at the end).
+      size_type                    shard;
+      /// the hidden iterator that traverses the blocks of the shard.
+      typename Container::const_iterator it;
+      /// the current position in the block.
+      Coordinate                   bit;
+      /// the current value of the block, where visited bits have been erased.
+      Word                         current;
+    };
+
+    /// Elements cannot be modified through iterators (as with std::unordered_set).
+    typedef const_iterator iterator;
+
+    // ------------------------- standard services ----------------------------------
+    /// @name Standard services (construction, initialization, assignment)
+    /// @{
+  public:
+
+    /// Main constructor.
+    /// @param nb_shards the number of shards (rounded up to a power of two).
+    /// @param splitter the splitter object for keys.
+    /// @param hash the hash object for keys.
+    /// @param equal the key equality comparator object for keys.
+    ConcurrentUnorderedSetByBlock( size_type nb_shards = 64,
+                                   const Splitter & splitter = Splitter(),
+                                   const Hash& hash = Hash(),
+                                   const key_equal& equal = key_equal() )
+      : my_splitter( splitter ), my_hasher( hash ), my_equal( equal )
+    {
+      init( nb_shards );
+    }
+
+    /// Default destructor
+    ~ConcurrentUnorderedSetByBlock() = default;
+
+    /// Copy constructor
+    /// @param other the object to clone (not modified concurrently).
+    ConcurrentUnorderedSetByBlock( const Self& other )
+      : my_splitter( other.my_splitter ),
+        my_hasher( other.my_hasher ), my_equal( other.my_equal )
+    {
+      init( other.my_nb_shards );
+      for ( size_type s = 0; s < my_nb_shards; ++s )
+        {
+          const Shard & src = other.my_shards[ s ];
+          Shard       & dst = my_shards[ s ];
+          dst.blocks.reserve( src.blocks.size() );
+          for ( const auto & b : src.blocks )
+            dst.blocks.emplace( b.first, b.second.load( std::memory_order_relaxed ) );
+          dst.size.store( src.size.load( std::memory_order_relaxed ),
+                          std::memory_order_relaxed );
+        }
+    }
+
+    /// Move constructor. The other set is left empty.
+    /// @param other the object to clone
+    ConcurrentUnorderedSetByBlock( Self&& other )
+      : my_splitter( other.my_splitter ),
+        my_hasher( other.my_hasher ), my_equal( other.my_equal )
+    {
+      init( 1 );
+      swap( other );
+    }
+
+    /// Assignment
+    /// @param other the object to clone
+    /// @return a reference to this
+    Self& operator=( const Self& other )
+    {
+      if ( this != &other )
+        {
+          Self tmp( other );
+          swap( tmp );
+        }
+      return *this;
+    }
+
+    /// Move assignment
+    /// @param other the object to clone
+    /// @return a reference to this
+    Self& operator=( Self&& other )
+    {
+      swap( other );
+      return *this;
+    }
+
+    /// @}
+
+    // ---------------------- iterator services -----------------------------
+    /// @name Iterator services
+    /// @{
+  public:
+
+    /// @return an iterator of the first stored element
+    const_iterator begin() const
+    {
+      return const_iterator( *this, 0, my_shards[ 0 ].blocks.cbegin() );
+    }
+    /// @return an iterator past the last stored element
+    const_iterator end() const
+    {
+      return const_iterator( *this, my_nb_shards,
+                             typename Container::const_iterator() );
+    }
+
+    /// @return an iterator of the first stored element
+    const_iterator cbegin() const { return begin(); }
+    /// @return an iterator past the last stored element
+    const_iterator cend() const { return end(); }
+
+    /// @}
+
+    // ---------------------- capacity services -----------------------------
+    /// @name Capacity services
+    /// @{
+  public:
+
+    /// @return 'true' iff the container is empty
+    bool empty() const noexcept { return size() == 0; }
+    /// @return the number of elements stored in the container.
+    size_type size() const noexcept
+    {
+      size_type n = 0;
+      for ( size_type s = 0; s < my_nb_shards; ++s )
+        n += my_shards[ s ].size.load( std::memory_order_relaxed );
+      return n;
+    }
+    /// @return the maximum number of elements that can be stored in the container.
+    size_type max_size() const noexcept { return my_shards[ 0 ].blocks.max_size(); }
+
+    /// @note Specific to this data structure.
+    /// @return the number of blocks stored in the container.
+    size_type blocks() const noexcept
+    {
+      size_type n = 0;
+      for ( size_type s = 0; s < my_nb_shards; ++s )
+        n += my_shards[ s ].blocks.size();
+      return n;
+    }
+
+    /// @note Specific to this data structure.
+    /// @return the number of shards.
+    size_type shards() const noexcept { return my_nb_shards; }
+
+    /// @note Specific to this data structure.
+    /// @return an evaluation of the memory usage of this data structure.
+    size_type memory_usage() const noexcept
+    {
+      size_type mem = my_nb_shards * sizeof( Shard ) + 2 * sizeof( size_type );
+      for ( size_type s = 0; s < my_nb_shards; ++s )
+        mem += ( my_shards[ s ].blocks.bucket_count() + 1 ) * sizeof( void* );
+      mem += blocks() * ( sizeof( void* )       /* next */
+                          + sizeof( Key )       /* key */
+                          + sizeof( Word )      /* value */
+                          + sizeof( size_type ) /* hash  */
+                          + sizeof( void* )     /* dyn. alloc. */ );
+      return mem;
+    }
+
+    /// @}
+
+    // ---------------------- modifier services -----------------------------
+    /// @name Modifier services
+    /// @{
+  public:
+
+    /// Clears the container
+    void clear() noexcept
+    {
+      for ( size_type s = 0; s < my_nb_shards; ++s )
+        {
+          my_shards[ s ].blocks.clear();
+          my_shards[ s ].size.store( 0, std::memory_order_relaxed );
+        }
+    }
+
+    /// Exchanges the contents of the container with those of
+    /// other, in O(1).
+    ///
+    /// @param other the other set to exchange with.
+    void swap( Self& other ) noexcept
+    {
+      std::swap( my_splitter,  other.my_splitter );
+      std::swap( my_hasher,    other.my_hasher );
+      std::swap( my_equal,     other.my_equal );
+      std::swap( my_shards,    other.my_shards );
+      std::swap( my_nb_shards, other.my_nb_shards );
+      std::swap( my_shift,     other.my_shift );
+    }
+
+    /**
+     *  @brief Attempts to insert an element into the set. Thread-safe.
+     *  @param  value  Element to be inserted.
+     *  @return  A pair, of which the first element is an iterator that points
+     *           to the possibly inserted element, and the second is a bool
+     *           that is true if the element was actually inserted.
+     *
+     *  Only the shard of the block of \a value is locked, to find or
+     *  create the block. The bit of \a value is then set atomically.
+     *  When several threads insert the same element, exactly one of
+     *  them gets 'true'.
+     *
+     *  Insertion requires amortized constant time.
+     *
+     *  @note Another insertion may rehash the shard, hence the
+     *  returned iterator may only be used once insertions have
+     *  stopped.
+     */
+    std::pair<iterator,bool> insert( const value_type& value )
+    {
+      const auto se = my_splitter.split( value );
+      const size_type s = shard_index( se.first );
+      typename Container::iterator it;
+      AtomicWord & word = find_or_create_block( s, se.first, it );
+      const Word bit = static_cast<Word>(1) << se.second;
+      const Word old = word.fetch_or( bit, std::memory_order_relaxed );
+      const bool inserted = ( old & bit ) == static_cast<Word>(0);
+      if ( inserted ) my_shards[ s ].size.fetch_add( 1, std::memory_order_relaxed );
+      return std::make_pair( const_iterator( *this, s, it, se.second, old | bit ),
+                             inserted );
+    }
+
+    /**
+     *  @brief Attempts to insert an element into the set. Thread-safe.
+     *  @param  hint  Ignored (for compatibility with std::unordered_set).
+     *  @param  value  Element to be inserted.
+     *  @return  An iterator that points to the element, which may only
+     *  be used once insertions have stopped.
+     */
+    iterator insert( const_iterator hint, const value_type& value )
+    {
+      (void) hint;
+      return insert( value ).first;
+    }
+
+    /**
+     *  @brief Inserts a range of element into the set. Thread-safe.
+     *
+     *  @tparam InputIterator any model of input iterator
+     *  @param[in]  first an iterator pointing on the first element of the range
+     *  @param[in]  last an iterator pointing after the last element of the range
+     */
+    template <typename InputIterator>
+    void  insert( InputIterator first, InputIterator last )
+    {
+      for ( ; first != last; ++first ) insert( *first );
+    }
+
+    /**
+     *  @brief Attempts to build and insert an element into the set. Thread-safe.
+     *  @param __args  Arguments used to generate an element.
+     *  @return  A pair, of which the first element is an iterator that points
+     *           to the possibly inserted element, and the second is a bool
+     *           that is true if the element was actually inserted.
+     */
+    template<typename... _Args>
+    std::pair<iterator, bool>
+    emplace(_Args&&... __args)
+    {
+      return insert( Key( std::forward<_Args>(__args)... ) );
+    }
+
+    /**
+     *  @brief Inserts several elements of the same block at once. Thread-safe.
+     *
+     *  @param block the block, i.e. the first element of the block
+     *  (see Splitter::split).
+     *  @param bits the elements of the block to insert, bit \e i
+     *  standing for the element Splitter::join( block, i ).
+     *
+     *  @return the number of elements actually inserted.
+     *
+     *  @note Specific to this data structure. Well suited to insert
+     *  spans of consecutive points along x.
+     */
+    size_type insert_block( const Key& block, Word bits )
+    {
+      ASSERT( my_splitter.split( block ).second == static_cast<Coordinate>(0) );
+      if ( bits == static_cast<Word>(0) ) return 0;
+      const size_type s = shard_index( block );
+      const Word old = find_or_create_block( s, block )
+        .fetch_or( bits, std::memory_order_relaxed );
+      const size_type n = Bits::nbSetBits( static_cast<Word>( bits & ~old ) );
+      if ( n != 0 ) my_shards[ s ].size.fetch_add( n, std::memory_order_relaxed );
+      return n;
+    }
+
+    /// Removes specified element from the container. Not thread-safe.
+    ///
+    /// @param pos a valid iterator in this data structure
+    ///
+    /// @return the iterator following the removed element.
+    ///
+    /// @pre The iterator pos must be valid and dereferenceable.
+    iterator erase( const_iterator pos ) noexcept
+    {
+      ASSERT( this == pos.collection );
+      ASSERT( pos  != cend() );
+      Shard & shard = my_shards[ pos.shard ];
+      AtomicWord & w = const_cast< AtomicWord& >( pos.it->second );
+      const Word bit = static_cast<Word>(1) << pos.bit;
+      ASSERT( ( w.load( std::memory_order_relaxed ) & bit ) != static_cast<Word>(0) );
+      const Word rest = w.fetch_and( ~bit, std::memory_order_relaxed ) & ~bit;
+      shard.size.fetch_sub( 1, std::memory_order_relaxed );
+      if ( rest == static_cast<Word>(0) )
+        return const_iterator( *this, pos.shard, shard.blocks.erase( pos.it ) );
+      // Bits after pos.bit (NB: 2 << bit wraps to 0 for the last bit).
+      const Word next = rest & ~( ( static_cast<Word>(2) << pos.bit )
+                                  - static_cast<Word>(1) );
+      if ( next == static_cast<Word>(0) )
+        return const_iterator( *this, pos.shard, std::next( pos.it ) );
+      return const_iterator( *this, pos.shard, pos.it,
+                             static_cast<Coordinate>( Bits::leastSignificantBit( next ) ) );
+    }
+
+    /// Removes the elements in the range [first; last), which must be
+    /// a valid range in *this. Not thread-safe.
+    ///
+    /// @param first an iterator such that [first; last) is a valid
+    /// range in this data structure
+    ///
+    /// @param last an iterator such that [first; last) is a valid
+    /// range in this data structure
+    ///
+    /// @return the iterator following the last removed element.
+    iterator erase( const_iterator first, const_iterator last ) noexcept
+    {
+      ASSERT( this == first.collection );
+      ASSERT( this == last.collection );
+      while ( first != last ) first = erase( first );
+      return first;
+    }
+
+    /// Removes specified element from the container, if it
+    /// exists. Not thread-safe.
+    /// @param key the value to erase from the set
+    /// @return the number of value removed from the set (either 0 or 1 ).
+    size_type erase( const key_type& key )
+    {
+      auto it = find( key );
+      if ( it != end() )
+        {
+          erase( it );
+          return 1;
+        }
+      else return 0;
+    }
+
+    /// @}
+
+    // ---------------------- lookup services -----------------------------
+    /// @name Lookup services
+    /// @{
+  public:
+
+    /// Finds an element with key equivalent to key.
+    /// @param key the value to look-up.
+    ///
+    /// @return a const iterator pointing to \a key or `end()` if the key
+    /// is not the set.
+    const_iterator find( const Key& key ) const
+    {
+      const auto se = my_splitter.split( key );
+      const size_type s = shard_index( se.first );
+      typename Container::const_iterator it;
+      {
+        std::lock_guard< std::mutex > guard( my_shards[ s ].mutex );
+        it = my_shards[ s ].blocks.find( se.first );
+        if ( it == my_shards[ s ].blocks.cend() ) return cend();
+      }
+      const bool exist = it->second.load( std::memory_order_relaxed )
+        & ( static_cast<Word>(1) << se.second );
+      if ( exist ) return const_iterator( *this, s, it, se.second );
+      else         return cend();
+    }
+
+    /// Thread-safe.
+    /// @param key the value to look-up.
+    /// @return the number of elements with key that compares equal to
+    /// the specified argument key, which is either 1 or 0 since this
+    /// container does not allow duplicates.
+    size_type count( const Key& key ) const
+    {
+      const auto se = my_splitter.split( key );
+      const Shard & shard = my_shards[ shard_index( se.first ) ];
+      std::lock_guard< std::mutex > guard( shard.mutex );
+      const auto it = shard.blocks.find( se.first );
+      if ( it == shard.blocks.cend() ) return 0;
+      const bool exist = it->second.load( std::memory_order_relaxed )
+        & ( static_cast<Word>(1) << se.second );
+      return exist ? 1 : 0;
+    }
+
+    /// Returns the bounds of a range that includes all the elements
+    /// that compare equal to k. In set containers, where keys are
+    /// unique, the range will include one element at most.
+    ///
+    /// @param key the value to look-up.
+    ///
+    /// @return a range containing the sought element or an empty
+    /// range if \a key is not in this set.
+    std::pair<const_iterator,const_iterator>
+    equal_range( const Key & key ) const
+    {
+      const_iterator first = find( key );
+      if ( first != end() )
+        {
+          const_iterator last = first;
+          return std::make_pair( first, ++last );
+        }
+      else return std::make_pair( first, first );
+    }
+
+    /// @}
+
+    // ---------------------- block services -----------------------------
+    /// @name Block services
+    /// @{
+  public:
+
+    /// Calls \a f( block, bits ) for each block of the shard \a s,
+    /// where \a block is the first element of the block and \a bits
+    /// the word of its elements.
+    ///
+    /// @tparam TFunctor the type of functor ( const Key&, Word ).
+    /// @param s the index of a shard (less than \ref shards()).
+    /// @param f the functor.
+    template <typename TFunctor>
+    void for_each_block_of_shard( size_type s, TFunctor && f ) const
+    {
+      ASSERT( s < my_nb_shards );
+      for ( const auto & b : my_shards[ s ].blocks )
+        {
+          const Word w = b.second.load( std::memory_order_relaxed );
+          if ( w != static_cast<Word>(0) ) f( b.first, w );
+        }
+    }
+
+    /// Calls \a f( block, bits, thread ) for each block, on several
+    /// threads (see WorkStealingScheduler): \a thread is the index,
+    /// in [0, WorkStealingScheduler::numberOfThreads()), of the
+    /// calling thread. The shards are distributed to the threads,
+    /// hence \a f is never called concurrently on the same block.
+    ///
+    /// @tparam TFunctor the type of functor ( const Key&, Word, unsigned int ).
+    /// @param f the functor.
+    template <typename TFunctor>
+    void for_each_block( TFunctor && f ) const
+    {
+      WorkStealingScheduler::forEach( my_nb_shards,
+        [this, &f] ( std::size_t first, std::size_t last, unsigned int thread )
+        {
+          for ( std::size_t s = first; s < last; ++s )
+            for_each_block_of_shard( s, [&f, thread] ( const Key& b, Word w )
+                                     { f( b, w, thread ); } );
+        } );
+    }
+
+    /// @}
+
+    // ---------------------- hash policy services -----------------------------
+    /// @name Hash policy services
+    /// @{
+  public:
+
+    /// Reserves buckets for at least \a block_count blocks, spread
+    /// evenly over the shards. Not thread-safe.
+    ///
+    /// @param block_count new capacity of the container (should be thought
+    /// in terms of number of expected blocks).
+    void reserve( size_type block_count )
+    {
+      const size_type per_shard = ( block_count + my_nb_shards - 1 ) / my_nb_shards;
+      for ( size_type s = 0; s < my_nb_shards; ++s )
+        my_shards[ s ].blocks.reserve( per_shard );
+    }
+
+    /// @}
+
+  private:
+    /// Creates the shards.
+    /// @param nb_shards the number of shards (rounded up to a power of two).
+    void init( size_type nb_shards )
+    {
+      my_nb_shards = 1;
+      my_shift     = 64;
+      while ( my_nb_shards < nb_shards ) { my_nb_shards <<= 1; my_shift -= 1; }
+      my_shards.reset( new Shard[ my_nb_shards ] );
+      for ( size_type s = 0; s < my_nb_shards; ++s )
+        my_shards[ s ].blocks = Container( 23, my_hasher, my_equal );
+    }
+
+    /// @param block any block.
+    /// @return the index of the shard of \a block.
+    size_type shard_index( const Key& block ) const
+    {
+      // Fibonacci hashing: the high bits do not depend on the low
+      // bits of the hash used within the shard.
+      if ( my_nb_shards == 1 ) return 0;
+      const std::uint64_t h = static_cast<std::uint64_t>( my_hasher( block ) )
+        * UINT64_C( 0x9E3779B97F4A7C15 );
+      return static_cast<size_type>( h >> my_shift );
+    }
+
+    /// Finds the block in its shard, and creates it if needed.
+    /// @param s the shard of the block.
+    /// @param block any block.
+    /// @param[out] it an iterator on the block, which is invalidated
+    /// when another insertion rehashes the shard.
+    /// @return a reference to the word of the block, which can be
+    /// modified atomically after the shard is unlocked (references to
+    /// the elements of an unordered_map survive a rehash).
+    AtomicWord&
+    find_or_create_block( size_type s, const Key& block,
+                          typename Container::iterator & it )
+    {
+      std::lock_guard< std::mutex > guard( my_shards[ s ].mutex );
+      it = my_shards[ s ].blocks.try_emplace( block, static_cast<Word>(0) ).first;
+      return it->second;
+    }
+
+    /// Finds the block in its shard, and creates it if needed.
+    /// @param s the shard of the block.
+    /// @param block any block.
+    /// @return a reference to the word of the block.
+    AtomicWord&
+    find_or_create_block( size_type s, const Key& block )
+    {
+      typename Container::iterator it;
+      return find_or_create_block( s, block, it );
+    }
+
+    // -------------------------- data ---------------------------------
+    /// The splitter object
+    Splitter  my_splitter;
+    /// The hash object, used for choosing shards.
+    Hash      my_hasher;
+    /// The key equality comparator object.
+    KeyEqual  my_equal;
+    /// The shards.
+    std::unique_ptr< Shard[] > my_shards;
+    /// The number of shards, a power of two.
+    size_type my_nb_shards;
+    /// 64 minus the base 2 logarithm of the number of shards.
+    unsigned int my_shift;
+  };
+
+
+  /// This functions swaps in O(1) the given two sets. Calls
+  /// ConcurrentUnorderedSetByBlock::swap.
+  ///
+  /// @tparam Key the type of integral array.
+  /// @tparam TSplitter the type for splitting a key into a block and a bit (see \ref Splitter).
+  /// @tparam Hash the type that provides a hasher for Key.
+  /// @tparam KeyEqual the type that provides an equality comparator for Key.
+  template < typename Key,
+             typename TSplitter,
+             class Hash,
+             class KeyEqual >
+  void swap
+  ( ConcurrentUnorderedSetByBlock< Key, TSplitter, Hash, KeyEqual >& s1,
+    ConcurrentUnorderedSetByBlock< Key, TSplitter, Hash, KeyEqual >& s2 )
+    noexcept
+  {
+    s1.swap( s2 );
+  }
+
+  /// A digital set (model of concepts::CDigitalSet) which can be
+  /// filled by several threads at the same time with \c insert (see
+  /// ConcurrentUnorderedSetByBlock for the thread-safe services).
+  ///
+  /// @tparam TDomain the domain of the set.
+  template < typename TDomain >
+  using DigitalSetByConcurrentBlocks =
+    DigitalSetByAssociativeContainer
+    < TDomain, ConcurrentUnorderedSetByBlock< typename TDomain::Point > >;
+
+  /// Tells if points can be inserted concurrently in a digital set
+  /// (false by default).
+  ///
+  /// @tparam TDigitalSet any model of concepts::CDigitalSet.
+  template < typename TDigitalSet >
+  struct IsConcurrentDigitalSet : std::false_type {};
+
+  /// Digital sets on a ConcurrentUnorderedSetByBlock can be filled
+  /// concurrently.
+  template < typename TDomain, typename Key, typename TSplitter,
+             class Hash, class KeyEqual >
+  struct IsConcurrentDigitalSet
+  < DigitalSetByAssociativeContainer
+    < TDomain, ConcurrentUnorderedSetByBlock< Key, TSplitter, Hash, KeyEqual > > >
+    : std::true_type {};
+
+} // namespace DGtal
+
+#endif // #ifndef CONCURRENTUNORDEREDSETBYBLOCK_HPP
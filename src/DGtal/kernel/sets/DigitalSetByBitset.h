@@ -0,0 +1,595 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file DigitalSetByBitset.h
+ * @brief A digital set of a rectangular domain stored as one bit per
+ * point of the domain.
+ *
+ * @date 2026/10/17
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see testDigitalSetByBitset.cpp
+ */
+
+#if defined(DigitalSetByBitset_RECURSES)
+#error Recursive header files inclusion detected in DigitalSetByBitset.h
+#else // defined(DigitalSetByBitset_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define DigitalSetByBitset_RECURSES
+
+#if !defined DigitalSetByBitset_h
+/** Prevents repeated inclusion of headers. */
+#define DigitalSetByBitset_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <array>
+#include <cstdint>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/CowPtr.h"
+#include "DGtal/base/Clone.h"
+#include "DGtal/base/SetFunctions.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class DigitalSetByBitset
+  /**
+    Description of template class 'DigitalSetByBitset' <p>
+
+    \brief Aim: A container class for storing sets of digital points
+    within some given rectangular domain, with one bit per point of
+    the domain.
+
+    The points are linearized as in ImageContainerBySTLVector (the
+    first axis is the fastest), and each row along the first axis
+    starts on a new 64-bit word, the last word of a row being padded
+    with zeros. A set of a 1024^3 domain thus takes 128 MB whatever its
+    number of points, and membership (operator()) is a bit probe.
+
+    The set operations (operator+=, and the functions of
+    SetFunctions.h, see HasNativeSetOperations) and the
+    complement process whole words, and require both sets to have the
+    same domain. The number of points is cached and recounted with
+    popcounts after these operations. Iterators skip the null words.
+    dilation() and erosion() by a structuring element are computed
+    by shifting whole rows of words.
+
+    Model of CDigitalSet. The iterators are constant and visit the
+    points in the order of the domain.
+
+    @code
+    typedef DigitalSetByBitset< Z3i::Domain > DigitalSet;
+    DigitalSet set( domain );
+    set.insert( Z3i::Point( 0, 0, 0 ) );
+    std::vector< Z3i::Vector > se = { Z3i::Vector( 0, 0, 0 ), Z3i::Vector( 1, 0, 0 ),
+                                      Z3i::Vector( -1, 0, 0 ) };
+    DigitalSet dilated = set.dilation( se ); // 3 points
+    @endcode
+
+    @tparam TDomain a HyperRectDomain.
+   */
+  template <typename TDomain>
+  class DigitalSetByBitset
+  {
+  public:
+    typedef TDomain Domain;
+    typedef DigitalSetByBitset<Domain> Self;
+    typedef typename Domain::Space Space;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Size Size;
+    typedef typename Space::Vector Vector;
+    typedef typename Space::Integer Integer;
+    /// The type of the words storing the bits.
+    typedef std::uint64_t Word;
+    /// The words of the set.
+    typedef std::vector<Word> Container;
+
+    ///Concept checks
+    BOOST_STATIC_ASSERT(( boost::is_same< Domain, HyperRectDomain<Space> >::value ));
+
+    /// The number of bits of a word.
+    static const unsigned int wordBits = 64;
+
+    /**
+     * Constant iterator on the points of the set, in the order of the
+     * domain. Model of forward iterator.
+     */
+    class ConstIterator
+    {
+    public:
+      typedef std::forward_iterator_tag iterator_category;
+      typedef Point value_type;
+      typedef std::ptrdiff_t difference_type;
+      typedef const Point* pointer;
+      typedef const Point& reference;
+
+      /// Default constructor (singular iterator).
+      ConstIterator() = default;
+
+      /**
+       * Constructor on the first point of the words from [word].
+       * @param aSet the visited set.
+       * @param word the index of a word (the number of words for end()).
+       */
+      ConstIterator( const Self & aSet, Size word );
+
+      /**
+       * Constructor at a given point of the set.
+       * @param aSet the visited set.
+       * @param word the index of the word of the point.
+       * @param bit the bit of the point in its word.
+       */
+      ConstIterator( const Self & aSet, Size word, unsigned int bit );
+
+      /// @return the current point.
+      reference operator*() const { return myPoint; }
+      /// @return a pointer to the current point.
+      pointer operator->() const { return &myPoint; }
+      /// Moves to the next point. @return a reference to this.
+      ConstIterator & operator++();
+      /// Moves to the next point. @return the iterator before moving.
+      ConstIterator operator++( int );
+      /// @param other any iterator on the same set.
+      /// @return 'true' iff both point to the same point.
+      bool operator==( const ConstIterator & other ) const
+      { return myWord == other.myWord && myBits == other.myBits; }
+      /// @param other any iterator on the same set.
+      /// @return 'true' iff they point to different points.
+      bool operator!=( const ConstIterator & other ) const
+      { return ! ( *this == other ); }
+
+    private:
+      /// The visited set.
+      const Self * mySet = nullptr;
+      /// The index of the current word.
+      Size myWord = 0;
+      /// The bits of the current word not visited yet (current included).
+      Word myBits = 0;
+      /// The row of the current point.
+      Size myRow = 0;
+      /// The current point.
+      Point myPoint;
+
+      /// Skips the null words, then goes to the first bit of the word.
+      void skip();
+      /// Computes the current point from the word and the lowest bit.
+      void computePoint();
+    };
+    typedef ConstIterator Iterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * Creates the empty set in the domain [d].
+     *
+     * @param d any rectangular domain.
+     */
+    DigitalSetByBitset( Clone<Domain> d );
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    DigitalSetByBitset ( const DigitalSetByBitset & other ) = default;
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    DigitalSetByBitset & operator= ( const DigitalSetByBitset & other ) = default;
+
+    /**
+     * @return the embedding domain.
+     */
+    const Domain & domain() const;
+
+    /**
+     * @return a copy on write pointer on the embedding domain.
+     */
+    CowPtr<Domain> domainPointer() const;
+
+    // ----------------------- Standard Set services --------------------------
+  public:
+
+    /**
+     * @return the number of elements in the set (constant time).
+     */
+    Size size() const;
+
+    /**
+     * @return 'true' iff the set is empty (no element).
+     */
+    bool empty() const;
+
+    /**
+     * Adds point [p] to this set.
+     *
+     * @param p any digital point.
+     * @pre p should belong to the associated domain.
+     */
+    void insert( const Point & p );
+
+    /**
+     * Adds the collection of points specified by the two iterators to
+     * this set.
+     *
+     * @param first the start point in the collection of Point.
+     * @param last the last point in the collection of Point.
+     * @pre all points should belong to the associated domain.
+     */
+    template <typename PointInputIterator>
+    void insert( PointInputIterator first, PointInputIterator last );
+
+    /**
+     * Adds point [p] to this set. Same as insert.
+     *
+     * @param p any digital point.
+     * @pre p should belong to the associated domain.
+     * @pre p should not belong to this.
+     */
+    void insertNew( const Point & p );
+
+    /**
+     * Adds the collection of points specified by the two iterators to
+     * this set. Same as insert.
+     *
+     * @param first the start point in the collection of Point.
+     * @param last the last point in the collection of Point.
+     *
+     * @pre all points should belong to the associated domain.
+     * @pre each point should not belong to this.
+     */
+    template <typename PointInputIterator>
+    void insertNew( PointInputIterator first, PointInputIterator last );
+
+    /**
+     * Removes point [p] from the set.
+     *
+     * @param p the point to remove.
+     * @return the number of removed elements (0 or 1).
+     */
+    Size erase( const Point & p );
+
+    /**
+     * Removes the point pointed by [it] from the set.
+     *
+     * @param it an iterator on this set.
+     */
+    void erase( Iterator it );
+
+    /**
+     * Removes the collection of points specified by the two iterators from
+     * this set.
+     *
+     * @param first the start point in this set.
+     * @param last the last point in this set.
+     */
+    void erase( Iterator first, Iterator last );
+
+    /**
+     * Clears the set.
+     * @post this set is empty.
+     */
+    void clear();
+
+    /**
+     * @param p any digital point.
+     * @return an iterator pointing on [p] if found, otherwise end().
+     */
+    ConstIterator find( const Point & p ) const;
+
+    /**
+     * @return a const iterator on the first element in this set.
+     */
+    ConstIterator begin() const;
+
+    /**
+     * @return a const iterator on the element after the last in this set.
+     */
+    ConstIterator end() const;
+
+    /**
+     * set union to left.
+     * @param aSet any other set with the same domain.
+     * @return a reference on 'this'.
+     */
+    Self & operator+=( const Self & aSet );
+
+    // ----------------------- Model of concepts::CPointPredicate -----------------------------
+  public:
+
+    /**
+       @param p any point.
+       @return 'true' if and only if \a p belongs to this set (a bit probe).
+    */
+    bool operator()( const Point & p ) const;
+
+    // ----------------------- Bitset services --------------------------------
+  public:
+
+    /**
+     * @return the words of this set, row after row, each row
+     * starting on a new word.
+     */
+    const Container & words() const;
+
+    /**
+     * @return the number of words of a row along the first axis.
+     */
+    Size rowWords() const;
+
+    /**
+     * @return an evaluation of the memory usage of this set, in bytes.
+     */
+    Size memoryUsage() const;
+
+    // ----------------------- Set operations ---------------------------------
+  public:
+
+    /**
+     * Updates this set as the union of this set and [other], word by word.
+     * @param other any other set with the same domain.
+     * @return a reference on 'this'.
+     */
+    Self & assignUnion( const Self & other );
+
+    /**
+     * Updates this set as the difference of this set and [other], word by word.
+     * @param other any other set with the same domain.
+     * @return a reference on 'this'.
+     */
+    Self & assignDifference( const Self & other );
+
+    /**
+     * Updates this set as the intersection of this set and [other], word by word.
+     * @param other any other set with the same domain.
+     * @return a reference on 'this'.
+     */
+    Self & assignIntersection( const Self & other );
+
+    /**
+     * Updates this set as the symmetric difference of this set and
+     * [other], word by word.
+     * @param other any other set with the same domain.
+     * @return a reference on 'this'.
+     */
+    Self & assignSymmetricDifference( const Self & other );
+
+    /**
+     * @param other any other set with the same domain.
+     * @return 'true' iff [other] is a subset of this set.
+     */
+    bool includes( const Self & other ) const;
+
+    /**
+     * @param other any other set with the same domain.
+     * @return 'true' iff [other] and this set have the same points.
+     */
+    bool equals( const Self & other ) const;
+
+    // ----------------------- Morphological operations -----------------------
+  public:
+
+    /**
+     * Dilation by a structuring element: the points \a p + \a v of
+     * the domain, for each point \a p of this set and each vector \a
+     * v of \a structuringElement. The rows of words are shifted once
+     * per vector.
+     *
+     * @tparam TVectorRange any range of vectors.
+     * @param structuringElement the vectors of the structuring element.
+     * @return the dilated set, in the same domain.
+     */
+    template <typename TVectorRange>
+    Self dilation( const TVectorRange & structuringElement ) const;
+
+    /**
+     * Erosion by a structuring element: the points \a p of the domain
+     * such that \a p + \a v belongs to this set for each vector \a v
+     * of \a structuringElement (points outside the domain do not
+     * belong to the set).
+     *
+     * @tparam TVectorRange any range of vectors.
+     * @param structuringElement the vectors of the structuring element.
+     * @return the eroded set, in the same domain.
+     */
+    template <typename TVectorRange>
+    Self erosion( const TVectorRange & structuringElement ) const;
+
+    // ----------------------- Other Set services -----------------------------
+  public:
+
+    /**
+     * Computes the complement in the domain of this set
+     * @param ito an output iterator
+     * @tparam TOutputIterator a model of output iterator
+     */
+    template< typename TOutputIterator >
+    void computeComplement(TOutputIterator& ito) const;
+
+    /**
+     * Builds the complement in the domain of the set [other_set] in
+     * this, word by word.
+     *
+     * @param other_set defines the set whose complement is assigned
+     * to 'this' (with the same domain).
+     */
+    void assignFromComplement( const Self & other_set );
+
+    /**
+     * Computes the bounding box of this set.
+     *
+     * @param lower the first point of the bounding box (lowest in all
+     * directions).
+     * @param upper the last point of the bounding box (highest in all
+     * directions).
+     */
+    void computeBoundingBox( Point & lower, Point & upper ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    /**
+     * @return the style name used for drawing this object.
+     */
+    std::string className() const;
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+
+    /**
+     * The associated domain. The pointed domain may be changed but it
+     * remains valid during the lifetime of the set.
+     */
+    CowPtr<Domain> myDomain;
+
+    /// The lowest point of the domain.
+    Point myLower;
+
+    /// The number of points of the domain along each axis.
+    Point myExtent;
+
+    /// The number of rows between consecutive rows along each axis (0 for axis 0).
+    std::array<Size, Space::dimension> myRowStrides;
+
+    /// The number of words of a row.
+    Size myRowWords;
+
+    /// The number of rows.
+    Size myNbRows;
+
+    /// The valid bits of the last word of a row.
+    Word myLastMask;
+
+    /// The words, row after row. The padding bits are zero.
+    Container myWords;
+
+    /// The number of points of the set.
+    Size mySize;
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /**
+     * Default Constructor.
+     * Forbidden since a Domain is necessary for defining a set.
+     */
+    DigitalSetByBitset();
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Recomputes the number of points with popcounts.
+     */
+    void update();
+
+    /**
+     * @param p a point of the domain.
+     * @param[out] bit the bit of \a p in its word.
+     * @return the index of the word of \a p.
+     */
+    Size wordIndex( const Point & p, unsigned int & bit ) const;
+
+    /**
+     * @param row the index of a row.
+     * @return the first point of the row.
+     */
+    Point rowPoint( Size row ) const;
+
+    /**
+     * Moves \a p to the first point of the next row (the coordinates
+     * 1 to d-1 are incremented with carries).
+     * @param[in,out] p the first point of a row.
+     */
+    void nextRow( Point & p ) const;
+
+    /**
+     * For each row of this set, combines its words with the words of
+     * the row of [other] translated by [v] (zero words where the
+     * translated row is outside the domain).
+     *
+     * @tparam TOperation a functor ( Word&, Word ).
+     * @param other a set with the same domain.
+     * @param v any vector.
+     * @param op the operation.
+     */
+    template <typename TOperation>
+    void combineTranslated( const Self & other, const Vector & v, TOperation op );
+
+    /// @param other any other set.
+    /// @return 'true' iff both sets have the same domain.
+    bool sameDomain( const Self & other ) const;
+
+  }; // end of class DigitalSetByBitset
+
+  /// DigitalSetByBitset processes whole words in its set operations.
+  template <typename TDomain>
+  struct HasNativeSetOperations< DigitalSetByBitset< TDomain > >
+    : public std::true_type {};
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'DigitalSetByBitset'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'DigitalSetByBitset' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename Domain>
+  std::ostream&
+  operator<< ( std::ostream & out, const DigitalSetByBitset<Domain> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/kernel/sets/DigitalSetByBitset.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined DigitalSetByBitset_h
+
+#undef DigitalSetByBitset_RECURSES
+#endif // else defined(DigitalSetByBitset_RECURSES)
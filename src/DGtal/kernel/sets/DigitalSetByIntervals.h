@@ -0,0 +1,547 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file DigitalSetByIntervals.h
+ * @brief A digital set stored as runs of consecutive points along the
+ * first axis (see LatticeSetByIntervals).
+ *
+ * @date 2026/10/17
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see LatticeSetByIntervals.h
+ * @see ImageContainerByIntervals.h
+ * @see testDigitalSetByIntervals.cpp
+ */
+
+#if defined(DigitalSetByIntervals_RECURSES)
+#error Recursive header files inclusion detected in DigitalSetByIntervals.h
+#else // defined(DigitalSetByIntervals_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define DigitalSetByIntervals_RECURSES
+
+#if !defined DigitalSetByIntervals_h
+/** Prevents repeated inclusion of headers. */
+#define DigitalSetByIntervals_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <iterator>
+#include <string>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/CowPtr.h"
+#include "DGtal/base/Clone.h"
+#include "DGtal/base/SetFunctions.h"
+#include "DGtal/kernel/domains/CDomain.h"
+#include "DGtal/kernel/LatticeSetByIntervals.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class DigitalSetByIntervals
+  /**
+    Description of template class 'DigitalSetByIntervals' <p>
+
+    \brief Aim: A container class for storing sets of digital points
+    within some given domain, as runs of consecutive points along the
+    first axis.
+
+    The points are stored in a LatticeSetByIntervals along axis 0:
+    each row (a line parallel to the first axis) holds the sorted
+    sequence of its intervals. A solid shape of N points thus only
+    takes a memory proportional to the number of its runs, i.e. to
+    N^((d-1)/d) for a ball.
+
+    Membership is logarithmic in the number of rows and in the number
+    of runs of the row. The set operations (operator+=, and the
+    functions of SetFunctions.h, see HasNativeSetOperations)
+    merge the intervals row by row, in a time linear in the number of
+    runs. The runs can be visited directly with forEachRun().
+
+    Model of CDigitalSet. The iterators are constant and visit the
+    points row after row, each row in increasing order.
+
+    @code
+    typedef DigitalSetByIntervals< Z3i::Domain > DigitalSet;
+    DigitalSet set( domain );
+    set.insert( Z3i::Point( 0, 0, 0 ) );
+    set.forEachRun( [&] ( const Z3i::Point& first, const Z3i::Point& last )
+      { std::cout << first << " -> " << last << std::endl; } );
+    @endcode
+
+    @tparam TDomain any model of CDomain.
+   */
+  template <typename TDomain>
+  class DigitalSetByIntervals
+  {
+  public:
+    typedef TDomain Domain;
+    typedef DigitalSetByIntervals<Domain> Self;
+    typedef typename Domain::Space Space;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Size Size;
+    typedef typename Space::Integer Integer;
+    /// The lattice set storing the runs (along axis 0).
+    typedef LatticeSetByIntervals<Space> LatticeSet;
+    typedef typename LatticeSet::Intervals Intervals;
+    typedef typename LatticeSet::Interval Interval;
+    typedef typename LatticeSet::Container Container;
+
+    ///Concept checks
+    BOOST_CONCEPT_ASSERT(( concepts::CDomain< TDomain > ));
+
+    /**
+     * Constant iterator on the points of the set, row after row.
+     * Model of forward iterator.
+     */
+    class ConstIterator
+    {
+    public:
+      typedef std::forward_iterator_tag iterator_category;
+      typedef Point value_type;
+      typedef std::ptrdiff_t difference_type;
+      typedef const Point* pointer;
+      typedef const Point& reference;
+
+      /// Default constructor (singular iterator).
+      ConstIterator() = default;
+
+      /**
+       * Constructor.
+       * @param row the row of the point (or the end of the rows).
+       * @param rowEnd the end of the rows.
+       */
+      ConstIterator( typename Container::const_iterator row,
+                     typename Container::const_iterator rowEnd );
+
+      /**
+       * Constructor at a given point of the set.
+       * @param row the row of the point.
+       * @param rowEnd the end of the rows.
+       * @param interval the index of the interval containing \a p in its row.
+       * @param p a point of the set.
+       */
+      ConstIterator( typename Container::const_iterator row,
+                     typename Container::const_iterator rowEnd,
+                     std::size_t interval, const Point & p );
+
+      /// @return the current point.
+      reference operator*() const { return myPoint; }
+      /// @return a pointer to the current point.
+      pointer operator->() const { return &myPoint; }
+      /// Moves to the next point. @return a reference to this.
+      ConstIterator & operator++();
+      /// Moves to the next point. @return the iterator before moving.
+      ConstIterator operator++( int );
+      /// @param other any iterator on the same set.
+      /// @return 'true' iff both point to the same point.
+      bool operator==( const ConstIterator & other ) const;
+      /// @param other any iterator on the same set.
+      /// @return 'true' iff they point to different points.
+      bool operator!=( const ConstIterator & other ) const
+      { return ! ( *this == other ); }
+
+    private:
+      /// The current row.
+      typename Container::const_iterator myRow;
+      /// The end of the rows.
+      typename Container::const_iterator myRowEnd;
+      /// The index of the current interval in the row.
+      std::size_t myInterval = 0;
+      /// The current point.
+      Point myPoint;
+
+      /// Places the iterator on the first point of the current row, if any.
+      void enterRow();
+    };
+    typedef ConstIterator Iterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * Creates the empty set in the domain [d].
+     *
+     * @param d any domain.
+     */
+    DigitalSetByIntervals( Clone<Domain> d );
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    DigitalSetByIntervals ( const DigitalSetByIntervals & other ) = default;
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    DigitalSetByIntervals & operator= ( const DigitalSetByIntervals & other ) = default;
+
+    /**
+     * @return the embedding domain.
+     */
+    const Domain & domain() const;
+
+    /**
+     * @return a copy on write pointer on the embedding domain.
+     */
+    CowPtr<Domain> domainPointer() const;
+
+    // ----------------------- Standard Set services --------------------------
+  public:
+
+    /**
+     * @return the number of elements in the set (constant time).
+     */
+    Size size() const;
+
+    /**
+     * @return 'true' iff the set is empty (no element).
+     */
+    bool empty() const;
+
+    /**
+     * Adds point [p] to this set.
+     *
+     * @param p any digital point.
+     * @pre p should belong to the associated domain.
+     */
+    void insert( const Point & p );
+
+    /**
+     * Adds the collection of points specified by the two iterators to
+     * this set.
+     *
+     * @param first the start point in the collection of Point.
+     * @param last the last point in the collection of Point.
+     * @pre all points should belong to the associated domain.
+     */
+    template <typename PointInputIterator>
+    void insert( PointInputIterator first, PointInputIterator last );
+
+    /**
+     * Adds point [p] to this set. Same as insert.
+     *
+     * @param p any digital point.
+     * @pre p should belong to the associated domain.
+     * @pre p should not belong to this.
+     */
+    void insertNew( const Point & p );
+
+    /**
+     * Adds the collection of points specified by the two iterators to
+     * this set. Same as insert.
+     *
+     * @param first the start point in the collection of Point.
+     * @param last the last point in the collection of Point.
+     *
+     * @pre all points should belong to the associated domain.
+     * @pre each point should not belong to this.
+     */
+    template <typename PointInputIterator>
+    void insertNew( PointInputIterator first, PointInputIterator last );
+
+    /**
+     * Adds the run of points from [first] to [last] along the first
+     * axis (both included) to this set.
+     *
+     * @param first any digital point.
+     * @param last a point on the same row as [first], with a greater
+     * or equal first coordinate.
+     * @pre both points should belong to the associated domain.
+     */
+    void insertRun( const Point & first, const Point & last );
+
+    /**
+     * Removes point [p] from the set.
+     *
+     * @param p the point to remove.
+     * @return the number of removed elements (0 or 1).
+     */
+    Size erase( const Point & p );
+
+    /**
+     * Removes the point pointed by [it] from the set.
+     *
+     * @param it an iterator on this set.
+     */
+    void erase( Iterator it );
+
+    /**
+     * Removes the collection of points specified by the two iterators from
+     * this set.
+     *
+     * @param first the start point in this set.
+     * @param last the last point in this set.
+     */
+    void erase( Iterator first, Iterator last );
+
+    /**
+     * Clears the set.
+     * @post this set is empty.
+     */
+    void clear();
+
+    /**
+     * @param p any digital point.
+     * @return an iterator pointing on [p] if found, otherwise end().
+     */
+    ConstIterator find( const Point & p ) const;
+
+    /**
+     * @return a const iterator on the first element in this set.
+     */
+    ConstIterator begin() const;
+
+    /**
+     * @return a const iterator on the element after the last in this set.
+     */
+    ConstIterator end() const;
+
+    /**
+     * set union to left.
+     * @param aSet any other set.
+     * @return a reference on 'this'.
+     */
+    Self & operator+=( const Self & aSet );
+
+    // ----------------------- Model of concepts::CPointPredicate -----------------------------
+  public:
+
+    /**
+       @param p any point.
+       @return 'true' if and only if \a p belongs to this set.
+    */
+    bool operator()( const Point & p ) const;
+
+    // ----------------------- Run services -----------------------------------
+  public:
+
+    /**
+     * @return the lattice set storing the runs of this set.
+     */
+    const LatticeSet & latticeSet() const;
+
+    /**
+     * @return the number of runs (maximal intervals along the first
+     * axis) of this set.
+     */
+    Size nbRuns() const;
+
+    /**
+     * Calls \a f( first, last ) for each run of this set, row after
+     * row, where \a first and \a last are the first and last points of
+     * the run (both included).
+     *
+     * @tparam TFunctor the type of a functor (const Point&, const Point&).
+     * @param f the functor.
+     */
+    template <typename TFunctor>
+    void forEachRun( TFunctor f ) const;
+
+    /**
+     * @return an evaluation of the memory usage of this set, in bytes.
+     */
+    Size memoryUsage() const;
+
+    // ----------------------- Set operations ---------------------------------
+  public:
+
+    /**
+     * Updates this set as the union of this set and [other], row by row.
+     * @param other any other set.
+     * @return a reference on 'this'.
+     */
+    Self & assignUnion( const Self & other );
+
+    /**
+     * Updates this set as the difference of this set and [other], row by row.
+     * @param other any other set.
+     * @return a reference on 'this'.
+     */
+    Self & assignDifference( const Self & other );
+
+    /**
+     * Updates this set as the intersection of this set and [other], row by row.
+     * @param other any other set.
+     * @return a reference on 'this'.
+     */
+    Self & assignIntersection( const Self & other );
+
+    /**
+     * Updates this set as the symmetric difference of this set and
+     * [other], row by row.
+     * @param other any other set.
+     * @return a reference on 'this'.
+     */
+    Self & assignSymmetricDifference( const Self & other );
+
+    /**
+     * @param other any other set.
+     * @return 'true' iff [other] is a subset of this set.
+     */
+    bool includes( const Self & other ) const;
+
+    /**
+     * @param other any other set.
+     * @return 'true' iff [other] and this set have the same points.
+     */
+    bool equals( const Self & other ) const;
+
+    // ----------------------- Other Set services -----------------------------
+  public:
+
+    /**
+     * Computes the complement in the domain of this set
+     * @param ito an output iterator
+     * @tparam TOutputIterator a model of output iterator
+     */
+    template< typename TOutputIterator >
+    void computeComplement(TOutputIterator& ito) const;
+
+    /**
+     * Builds the complement in the domain of the set [other_set] in
+     * this.
+     *
+     * @param other_set defines the set whose complement is assigned to 'this'.
+     */
+    void assignFromComplement( const Self & other_set );
+
+    /**
+     * Computes the bounding box of this set.
+     *
+     * @param lower the first point of the bounding box (lowest in all
+     * directions).
+     * @param upper the last point of the bounding box (highest in all
+     * directions).
+     */
+    void computeBoundingBox( Point & lower, Point & upper ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    /**
+     * @return the style name used for drawing this object.
+     */
+    std::string className() const;
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+
+    /**
+     * The associated domain. The pointed domain may be changed but it
+     * remains valid during the lifetime of the set.
+     */
+    CowPtr<Domain> myDomain;
+
+    /**
+     * The runs of the set, along axis 0. No row is empty.
+     */
+    LatticeSet myRuns;
+
+    /**
+     * The number of points of the set.
+     */
+    Size mySize;
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /**
+     * Default Constructor.
+     * Forbidden since a Domain is necessary for defining a set.
+     */
+    DigitalSetByIntervals();
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Recomputes the number of points and removes the empty rows.
+     */
+    void update();
+
+    /**
+     * @param A,B two sorted sequences of disjoint, non adjacent intervals.
+     * @return the intervals of the union of \a A and \a B.
+     */
+    static Intervals unite( const Intervals & A, const Intervals & B );
+
+    /**
+     * @param A,B two sorted sequences of disjoint, non adjacent intervals.
+     * @return the intervals of \a A minus \a B.
+     */
+    static Intervals subtract( const Intervals & A, const Intervals & B );
+
+    /**
+     * @param A,B two sorted sequences of disjoint, non adjacent intervals.
+     * @return the intervals of the intersection of \a A and \a B.
+     */
+    static Intervals intersect( const Intervals & A, const Intervals & B );
+
+  }; // end of class DigitalSetByIntervals
+
+  /// DigitalSetByIntervals merges the runs in its set operations.
+  template <typename TDomain>
+  struct HasNativeSetOperations< DigitalSetByIntervals< TDomain > >
+    : public std::true_type {};
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'DigitalSetByIntervals'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'DigitalSetByIntervals' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename Domain>
+  std::ostream&
+  operator<< ( std::ostream & out, const DigitalSetByIntervals<Domain> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/kernel/sets/DigitalSetByIntervals.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined DigitalSetByIntervals_h
+
+#undef DigitalSetByIntervals_RECURSES
+#endif // else defined(DigitalSetByIntervals_RECURSES)
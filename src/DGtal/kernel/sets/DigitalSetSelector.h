@@ -48,6 +48,7 @@
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/sets/DigitalSetByAssociativeContainer.h"
 #include "DGtal/kernel/sets/DigitalSetBySTLVector.h"
+#include "DGtal/kernel/sets/DigitalSetByBitset.h"
 
 #include "DGtal/kernel/PointHashFunctions.h"
 #include <unordered_set>
@@ -83,6 +84,10 @@ namespace DGtal
    SpecificSet set1( domain );
    *
    * @endcode
+   *
+   * A set that may fill a large part of a rectangular domain
+   * (WHOLE_DS) and that is mostly queried (HIGH_BEL_DS) is stored
+   * with one bit per point of the domain (DigitalSetByBitset).
    */
   template <typename Domain, int Preferences >
   struct DigitalSetSelector
@@ -46,6 +46,7 @@
 
 #include <complex>    // To be included before fftw: see http://www.fftw.org/doc/Complex-numbers.html#Complex-numbers
 #include <type_traits>
+#include <mutex>
 #include <fftw3.h>
 
 #include <boost/math/constants/constants.hpp>
@@ -193,6 +194,13 @@ struct FFTWWrapper<long double>
   };
 #endif
 
+/// Mutex serializing the calls to the FFTW planner, which is not thread-safe.
+inline std::mutex & fftwPlannerMutex()
+  {
+    static std::mutex plannerMutex;
+    return plannerMutex;
+  }
+
 } // detail namespace
 
 ///@cond
@@ -210,6 +218,14 @@ class RealFFT;
 ///@endcond
 
 /** Real-complex backward and forward Fast Fourier Transform over HyperRectDomain.
+ *
+ * The plans of the transformations are kept until the destruction of
+ * the object, so that repeated transformations of the same object
+ * (e.g. on the blocks of a larger image) do not call the planner
+ * again. The calls to the FFTW planner are serialized, so that
+ * distinct objects can be transformed concurrently by several
+ * threads.
+ *
  * @tparam  TSpace  Type of the space.
  * @tparam  T       Values type.
  */
@@ -689,6 +705,17 @@ class RealFFT< HyperRectDomain<TSpace>, T >
   public:
     const Real pi = boost::math::constants::pi<Real>(); ///< Pi.
 
+    // ------------------------- Internals ------------------------------------
+  private:
+    /** Creates a plan for the transformation of the storage, without
+     * modifying it. The caller must hold the planner mutex.
+     *
+     * @param flags Planner flags.
+     * @param way   FFTW_FORWARD for real->complex, FFTW_BACKWARD for complex->real.
+     * @return the plan, or NULL if none can be created.
+     */
+    typename FFTW::plan createPlanFor( unsigned flags, int way );
+
     // ------------------------- Private Datas --------------------------------
   private:
     const Domain  mySpatialDomain;  ///< Spatial domain (real).
@@ -700,6 +727,8 @@ class RealFFT< HyperRectDomain<TSpace>, T >
         RealPoint myScaledSpatialExtent;      ///< Extent of the scaled spatial domain.
         RealPoint myScaledSpatialLowerBound;  ///< Lower bound of the scaled spatial domain.
         Real      myScaledFreqMag;  ///< Magnitude ratio for the scaled frequency values.
+    typename FFTW::plan myPlans[2]; ///< Cached forward and backward plans.
+        unsigned  myPlanFlags[2];   ///< Planner flags of the cached plans.
 
   };
 
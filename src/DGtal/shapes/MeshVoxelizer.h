@@ -38,6 +38,7 @@
 #include "DGtal/shapes/IntersectionTarget.h"
 #include "DGtal/kernel/SpaceND.h"
 #include "DGtal/kernel/sets/CDigitalSet.h"
+#include "DGtal/kernel/ConcurrentUnorderedSetByBlock.h"
 #include "DGtal/geometry/tools/determinant/PredicateFromOrientationFunctor2.h"
 #include "DGtal/geometry/tools/determinant/InHalfPlaneBySimple3x3Matrix.h"
 //////////////////////////////////////////////////////////////////////////////
@@ -120,6 +121,11 @@ namespace DGtal
      * If one voxel is outside the digtial set (@a outputSet) domain, the voxel
      * is skipped.
      *
+     * If points can be inserted concurrently in @a outputSet (see
+     * IsConcurrentDigitalSet, e.g. DigitalSetByConcurrentBlocks), the
+     * faces are voxelized on several threads (see
+     * WorkStealingScheduler) directly into @a outputSet.
+     *
      * @param [out] outputSet the set that collects the voxels.
      * @param [in] aMesh the mesh to voxelize (vertex coordinates will
      * be casted to @e PointR3 points.
@@ -0,0 +1,264 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file BinaryImageNeighborhood.h
+ * @brief Neighborhood configurations of the points of a dense binary
+ * image, and homotopic thinning of images and objects with look up
+ * tables.
+ *
+ * @date 2026/10/17
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see NeighborhoodConfigurationTables.h
+ * @see testNeighborhoodConfigurations.cpp
+ */
+
+#if defined(BinaryImageNeighborhood_RECURSES)
+#error Recursive header files inclusion detected in BinaryImageNeighborhood.h
+#else // defined(BinaryImageNeighborhood_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define BinaryImageNeighborhood_RECURSES
+
+#if !defined BinaryImageNeighborhood_h
+/** Prevents repeated inclusion of headers. */
+#define BinaryImageNeighborhood_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <array>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/topology/Object.h"
+#include "DGtal/topology/NeighborhoodConfigurationTables.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class BinaryImageNeighborhood
+  /**
+   * Description of template class 'BinaryImageNeighborhood' <p>
+   * \brief Aim: Computes the configuration of the neighborhood of a
+   * point (see functions::mapZeroPointNeighborhoodToConfigurationMask)
+   * directly from a dense binary image, without building any set.
+   *
+   * A point is in the foreground iff its value is not zero. The
+   * points outside the domain are in the background. For points that
+   * are not on the border of the domain, the 3^d-1 neighbors are read
+   * at precomputed offsets in the image storage.
+   *
+   * @code
+   * typedef ImageContainerBySTLVector< Z3i::Domain, bool > Image;
+   * typedef NeighborhoodConfigurationTables< Z3i::DT26_6 > Tables;
+   * BinaryImageNeighborhood< Image > neighborhood( image );
+   * bool simple = Tables::isSimple( neighborhood.configuration( p ) );
+   * @endcode
+   *
+   * @tparam TImage an ImageContainerBySTLVector (2D or 3D) whose
+   * values are convertible to bool.
+   */
+  template <typename TImage>
+  class BinaryImageNeighborhood
+  {
+  public:
+    typedef TImage                    Image;
+    typedef typename Image::Domain    Domain;
+    typedef typename Image::Point     Point;
+    typedef typename Image::Value     Value;
+
+    /// The dimension of the space.
+    static const Dimension dimension = Point::dimension;
+    /// The number of neighbors of a point.
+    static const unsigned int NB_NEIGHBORS = dimension == 2 ? 8 : 26;
+
+    BOOST_STATIC_ASSERT(( dimension == 2 || dimension == 3 ));
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * @param image the binary image, which may be modified between
+     * calls as long as its domain stays the same.
+     */
+    BinaryImageNeighborhood( ConstAlias< Image > image );
+
+    // ----------------------- Neighborhood services --------------------------
+  public:
+
+    /// @return the image.
+    const Image & image() const;
+
+    /**
+     * @param p any point of the domain.
+     * @return the configuration of the neighborhood of @a p.
+     */
+    NeighborhoodConfiguration configuration( const Point & p ) const;
+
+    /**
+     * @param p any point of the domain.
+     * @param index the linearized index of @a p in the image.
+     * @return the configuration of the neighborhood of @a p.
+     */
+    NeighborhoodConfiguration configuration( const Point & p,
+                                             std::size_t index ) const;
+
+    /**
+     * @param p any point.
+     * @return 'true' iff all the neighbors of @a p are in the domain.
+     */
+    bool isInterior( const Point & p ) const;
+
+    /**
+     * @param k the bit of a neighbor in the configuration.
+     * @return the displacement from the center to this neighbor.
+     */
+    const Point & displacement( unsigned int k ) const;
+
+    /**
+     * @param k the bit of a neighbor in the configuration.
+     * @return the difference of linearized indices from the center
+     * to this neighbor (for interior points).
+     */
+    std::ptrdiff_t offset( unsigned int k ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The binary image.
+    const Image* myImage;
+    /// The displacements of the neighbors, in the order of the bits.
+    std::array< Point, NB_NEIGHBORS > myDisplacements;
+    /// The offsets of the neighbors in the image storage.
+    std::array< std::ptrdiff_t, NB_NEIGHBORS > myOffsets;
+
+  }; // end of class BinaryImageNeighborhood
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'BinaryImageNeighborhood'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'BinaryImageNeighborhood' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TImage>
+  std::ostream&
+  operator<< ( std::ostream & out, const BinaryImageNeighborhood<TImage> & object );
+
+  namespace functions {
+
+    /**
+     * Homotopic thinning of a binary image: the simple points of the
+     * foreground (for the digital topology @a TDigitalTopology) are
+     * set to zero until none is left, except those whose neighborhood
+     * configuration satisfies @a keep.
+     *
+     * Simplicity is read in the shared table of
+     * NeighborhoodConfigurationTables and the configurations are
+     * computed with BinaryImageNeighborhood, hence no memory is
+     * allocated per point. Each pass only visits the points adjacent
+     * to a point removed by the previous pass.
+     *
+     * @code
+     * typedef NeighborhoodConfigurationTables< Z3i::DT26_6 > Tables;
+     * functions::homotopicThinning< Z3i::DT26_6 >( image, Tables::isEnd );
+     * @endcode
+     *
+     * @tparam TDigitalTopology a digital topology with a simplicity
+     * table (see NeighborhoodTablesTraits).
+     * @tparam TImage an ImageContainerBySTLVector (2D or 3D).
+     * @tparam TPredicate a functor NeighborhoodConfiguration -> bool.
+     *
+     * @param[in,out] image the binary image to thin.
+     * @param keep the predicate of the points to preserve (e.g.
+     * NeighborhoodConfigurationTables::isEnd or isIsthmus).
+     *
+     * @return the number of removed points.
+     */
+    template <typename TDigitalTopology, typename TImage, typename TPredicate>
+    std::size_t
+    homotopicThinning( TImage & image, const TPredicate & keep );
+
+    /**
+     * Ultimate homotopic thinning of a binary image.
+     * @see homotopicThinning( TImage &, const TPredicate & )
+     *
+     * @tparam TDigitalTopology a digital topology with a simplicity table.
+     * @tparam TImage an ImageContainerBySTLVector (2D or 3D).
+     * @param[in,out] image the binary image to thin.
+     * @return the number of removed points.
+     */
+    template <typename TDigitalTopology, typename TImage>
+    std::size_t
+    homotopicThinning( TImage & image );
+
+    /**
+     * Homotopic thinning of an object, through a dense binary image
+     * of its domain.
+     * @see homotopicThinning( TImage &, const TPredicate & )
+     *
+     * @tparam TDigitalTopology a digital topology with a simplicity table.
+     * @tparam TDigitalSet the digital set of the object.
+     * @tparam TPredicate a functor NeighborhoodConfiguration -> bool.
+     *
+     * @param[in,out] object the object to thin, whose domain is a
+     * HyperRectDomain.
+     * @param keep the predicate of the points to preserve.
+     *
+     * @return the number of removed points.
+     */
+    template <typename TDigitalTopology, typename TDigitalSet, typename TPredicate>
+    std::size_t
+    homotopicThinning( Object< TDigitalTopology, TDigitalSet > & object,
+                       const TPredicate & keep );
+
+  } // namespace functions
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/BinaryImageNeighborhood.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined BinaryImageNeighborhood_h
+
+#undef BinaryImageNeighborhood_RECURSES
+#endif // else defined(BinaryImageNeighborhood_RECURSES)
@@ -0,0 +1,140 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ConnectedComponentLabeling.h
+ * @brief Labelling of the connected components of binary images and
+ * objects with a union-find structure, in parallel over slabs.
+ *
+ * @date 2026/10/17
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see Object.h
+ * @see testConnectedComponentLabeling.cpp
+ */
+
+#if defined(ConnectedComponentLabeling_RECURSES)
+#error Recursive header files inclusion detected in ConnectedComponentLabeling.h
+#else // defined(ConnectedComponentLabeling_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ConnectedComponentLabeling_RECURSES
+
+#if !defined ConnectedComponentLabeling_h
+/** Prevents repeated inclusion of headers. */
+#define ConnectedComponentLabeling_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/topology/Object.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  namespace functions {
+
+    /**
+     * Labels the connected components of the foreground of a binary
+     * image (the points whose value is not zero) for a given
+     * adjacency.
+     *
+     * The points of each component get the same label in @a labels,
+     * from 1 to the number of components, in the order of their
+     * first point in the scan of the domain; the background gets the
+     * label 0. Hence the labels do not depend on the number of
+     * threads.
+     *
+     * The domain is cut into slabs along the last axis. In each slab,
+     * each foreground point is united with its adjacent foreground
+     * points that precede it in the scan (union-find with path
+     * halving, the parent of a point being stored in @a labels), and
+     * the slabs are processed in parallel with WorkStealingScheduler.
+     * The components across slab boundaries are then merged, and a
+     * last scan replaces the parents by consecutive labels. No memory
+     * other than @a labels is used, and the set of points is never
+     * looked up.
+     *
+     * @code
+     * typedef ImageContainerBySTLVector< Z3i::Domain, bool >         Image;
+     * typedef ImageContainerBySTLVector< Z3i::Domain, unsigned int > LabelImage;
+     * LabelImage labels( image.domain() );
+     * auto sizes = functions::labelConnectedComponents( image, labels, Z3i::Adj26() );
+     * // sizes.size() - 1 components, sizes[ l ] points labelled l.
+     * @endcode
+     *
+     * @tparam TImage an ImageContainerBySTLVector.
+     * @tparam TLabelImage an ImageContainerBySTLVector with the same
+     * domain and integer values, able to represent image.size().
+     * @tparam TAdjacency a translation invariant adjacency (e.g. any
+     * MetricAdjacency), whose neighbors are found with writeNeighbors.
+     *
+     * @param image the binary image.
+     * @param[out] labels the label image, which may be @a image itself.
+     * @param adjacency the adjacency of the foreground points.
+     *
+     * @return the number of points of each label: the first element
+     * is the number of background points and the size of the vector
+     * is one more than the number of components.
+     */
+    template <typename TImage, typename TLabelImage, typename TAdjacency>
+    std::vector< std::size_t >
+    labelConnectedComponents( const TImage & image,
+                              TLabelImage & labels,
+                              const TAdjacency & adjacency );
+
+    /**
+     * Labels the connected components of an object for its foreground
+     * adjacency. This is much faster than Object::writeComponents
+     * when there are many points and components.
+     * @see labelConnectedComponents( const TImage &, TLabelImage &, const TAdjacency & )
+     *
+     * @tparam TDigitalTopology any realization of DigitalTopology.
+     * @tparam TDigitalSet the digital set of the object, whose domain
+     * is a HyperRectDomain.
+     * @tparam TLabelImage an ImageContainerBySTLVector on the domain
+     * of the object with integer values.
+     *
+     * @param object the object.
+     * @param[out] labels the label image.
+     *
+     * @return the number of points of each label, the first element
+     * being the number of points of the domain outside the object.
+     */
+    template <typename TDigitalTopology, typename TDigitalSet, typename TLabelImage>
+    std::vector< std::size_t >
+    labelConnectedComponents( const Object< TDigitalTopology, TDigitalSet > & object,
+                              TLabelImage & labels );
+
+  } // namespace functions
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/ConnectedComponentLabeling.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ConnectedComponentLabeling_h
+
+#undef ConnectedComponentLabeling_RECURSES
+#endif // else defined(ConnectedComponentLabeling_RECURSES)
@@ -44,6 +44,7 @@
 #include <vector>
 #include <string>
 #include <algorithm>
+#include <type_traits>
 #include <boost/type_traits.hpp>
 #include <boost/iterator/iterator_facade.hpp>
 #include "DGtal/base/Common.h"
@@ -1311,6 +1312,12 @@ namespace DGtal
     // ------------------------- Internals ------------------------------------
   private:
 
+    /**
+     * @param aK the Khalimsky space of the complex.
+     * @return an empty cell container, referring to @a aK when the
+     * container is built from a space (like DenseCellMap).
+     */
+    static CellMap makeCellMap( const KSpace & aK );
 
   }; // end of class CubicalComplex
 
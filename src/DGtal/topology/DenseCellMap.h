@@ -0,0 +1,422 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file DenseCellMap.h
+ * @brief An associative container mapping the cells of a bounded
+ * cellular grid space to some data, stored in blocks indexed by the
+ * Khalimsky coordinates of the cells.
+ *
+ * @date 2026/10/16
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see CubicalComplex.h
+ */
+
+#if defined(DenseCellMap_RECURSES)
+#error Recursive header files inclusion detected in DenseCellMap.h
+#else // defined(DenseCellMap_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define DenseCellMap_RECURSES
+
+#if !defined DenseCellMap_h
+/** Prevents repeated inclusion of headers. */
+#define DenseCellMap_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <array>
+#include <vector>
+#include <utility>
+#include <unordered_map>
+#include <type_traits>
+#include <boost/iterator/iterator_facade.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Bits.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/base/ContainerTraits.h"
+#include "DGtal/topology/CCellularGridSpaceND.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class DenseCellMap
+  /**
+   * Description of template class 'DenseCellMap' <p>
+   *
+   * \brief Aim: An associative container mapping cells of a bounded
+   * cellular grid space to data, with O(1) insertion, removal and
+   * search, meant as the cell container of CubicalComplex (and hence
+   * of VoxelComplex or ParDirCollapse) for large complexes.
+   *
+   * The cells with the same topology (i.e. the same parity of their
+   * Khalimsky coordinates) are indexed by their digital coordinates
+   * within the bounds of the space. This box is split into blocks of
+   * at most 64 cells (4x4x4 in 3D, 8x8 in 2D), each block storing a
+   * 64-bit membership word, the Khalimsky coordinates of its first
+   * cell and the data of all its cells: the cells themselves are not
+   * stored but deduced from their index in the block. Only the blocks
+   * that contain cells are allocated, in a hash directory, so that the
+   * memory is proportional to the size of the complex, even for small
+   * complexes of huge spaces, while dense complexes use little more
+   * than sizeof( TData ) bytes per cell (e.g. 4.4 bytes per cell in 3D
+   * with CubicalCellData) instead of a tree node.
+   *
+   * Like std::unordered_map, the cells are not visited in the order
+   * of operator<, and inserting a cell may invalidate iterators
+   * (removing a cell invalidates only the iterators on this cell).
+   * Since the pairs (cell, data) are not stored, an iterator
+   * dereferences to a pair of references, on a cell held by the
+   * iterator and on the data held by the map: a reference on the cell
+   * is thus valid only as long as the iterator is not changed.
+   *
+   * The map refers to the space given at construction, and takes its
+   * bounds whenever it is empty: cells outside these bounds cannot be
+   * inserted.
+   *
+   * @note CubicalComplex is not specialized for this container: its
+   * close() and open() operations still process the cells one by
+   * one (each search being in constant time), instead of combining
+   * the membership words of whole blocks.
+   *
+   * @code
+   * typedef DenseCellMap< KSpace, CubicalCellData > CellContainer;
+   * CubicalComplex< KSpace, CellContainer > complex( K );
+   * @endcode
+   *
+   * @tparam TKSpace any model of concepts::CCellularGridSpaceND.
+   * @tparam TData the type of data associated to each cell, which
+   * must be default constructible and copy assignable.
+   */
+  template < typename TKSpace, typename TData >
+  class DenseCellMap
+  {
+    BOOST_CONCEPT_ASSERT(( concepts::CCellularGridSpaceND< TKSpace > ));
+
+  public:
+    typedef DenseCellMap< TKSpace, TData > Self;
+    typedef TKSpace                        KSpace;
+    typedef typename KSpace::Cell          Cell;
+    typedef typename KSpace::Point         Point;
+    typedef typename KSpace::Integer       Integer;
+
+    // STL associative container types
+    typedef Cell                           key_type;
+    typedef TData                          mapped_type;
+    typedef std::pair< const Cell, TData > value_type;
+    typedef std::pair< const Cell&, TData& >       reference;
+    typedef std::pair< const Cell&, const TData& > const_reference;
+    typedef value_type*                    pointer;
+    typedef const value_type*              const_pointer;
+    typedef std::size_t                    size_type;
+    typedef std::ptrdiff_t                 difference_type;
+
+    /// The dimension of the space.
+    static const Dimension dimension = KSpace::dimension;
+    /// The binary logarithm of the side of the blocks.
+    static const unsigned int BLOCK_BITS = dimension <= 6 ? 6 / dimension : 0;
+    /// The number of cells of a block.
+    static const unsigned int BLOCK_SIZE = 1u << ( BLOCK_BITS * dimension );
+
+    /// The data of the cells of a block and their membership word.
+    struct Block
+    {
+      /// bit i is set iff the i-th cell of the block belongs to the map.
+      DGtal::uint64_t mask;
+      /// the Khalimsky coordinates of the first cell of the block.
+      Point origin;
+      /// the data of the cells of the block.
+      std::array< TData, BLOCK_SIZE > data;
+
+      Block() : mask( 0 ), origin(), data() {}
+    };
+
+    /// The allocated blocks, indexed by their linearized position.
+    typedef std::unordered_map< DGtal::uint64_t, Block > Directory;
+
+    /**
+     * Forward iterator on the pairs (cell, data) of the map, mutable
+     * (data only) when @a IsConst is false. It dereferences to a pair
+     * of references (see DenseCellMap).
+     */
+    template < bool IsConst >
+    class IteratorType
+      : public boost::iterator_facade< IteratorType< IsConst >,
+                                       typename std::conditional< IsConst, const value_type, value_type >::type,
+                                       std::forward_iterator_tag,
+                                       typename std::conditional< IsConst, const_reference, reference >::type >
+    {
+      friend class DenseCellMap;
+      friend class boost::iterator_core_access;
+      template < bool > friend class IteratorType;
+      typedef typename std::conditional< IsConst,
+                                         typename Directory::const_iterator,
+                                         typename Directory::iterator >::type BlockIterator;
+      typedef typename std::conditional< IsConst, const_reference, reference >::type Reference;
+
+    public:
+      /// Default iterator. Invalid.
+      IteratorType() : mySpace( 0 ), myBlock(), myEnd(), myIndex( 0 ) {}
+
+      /// Conversion from a mutable iterator to a constant one.
+      template < bool OtherIsConst,
+                 typename = typename std::enable_if< IsConst || ! OtherIsConst >::type >
+      IteratorType( const IteratorType< OtherIsConst > & other )
+        : mySpace( other.mySpace ), myBlock( other.myBlock ), myEnd( other.myEnd ),
+          myIndex( other.myIndex ) {}
+
+    private:
+      IteratorType( const KSpace * space, BlockIterator block, BlockIterator end,
+                    unsigned int index )
+        : mySpace( space ), myBlock( block ), myEnd( end ), myIndex( index ) {}
+
+      void increment();
+      template < bool OtherIsConst >
+      bool equal( const IteratorType< OtherIsConst > & other ) const
+      {
+        return myBlock == other.myBlock && myIndex == other.myIndex;
+      }
+      Reference dereference() const
+      {
+        myCell = cellOf( *mySpace, myBlock->second, myIndex );
+        return Reference( myCell, myBlock->second.data[ myIndex ] );
+      }
+
+      /// The space of the cells.
+      const KSpace* mySpace;
+      /// The current block, or myEnd.
+      BlockIterator myBlock;
+      /// The end of the directory.
+      BlockIterator myEnd;
+      /// The index of the current cell in the block (0 at the end).
+      unsigned int myIndex;
+      /// The current cell, computed when dereferencing.
+      mutable Cell myCell;
+    };
+
+    typedef IteratorType< false > iterator;
+    typedef IteratorType< true >  const_iterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Default constructor. The map is invalid and cannot receive cells.
+     */
+    DenseCellMap();
+
+    /**
+     * Constructor.
+     * @param K the bounded space in which the cells live, whose
+     * bounds are taken when the first cell is inserted.
+     */
+    DenseCellMap( ConstAlias< KSpace > K );
+
+    // ----------------------- Container services -----------------------------
+  public:
+
+    /// @return the number of cells of the map.
+    size_type size() const;
+    /// @return 'true' iff the map has no cell.
+    bool empty() const;
+    /// @return the maximal number of cells.
+    size_type max_size() const;
+    /// @return an iterator on the first cell.
+    iterator begin();
+    /// @return an iterator after the last cell.
+    iterator end();
+    /// @return an iterator on the first cell.
+    const_iterator begin() const;
+    /// @return an iterator after the last cell.
+    const_iterator end() const;
+
+    /**
+     * Swaps the contents of two maps.
+     * @param other any other map.
+     */
+    void swap( DenseCellMap & other );
+
+    /// Removes all the cells (and frees the blocks).
+    void clear();
+
+    // ----------------------- Associative container services -----------------
+  public:
+
+    /**
+     * Inserts a cell with its data, if it does not belong to the map.
+     * @param value a pair (cell, data).
+     * @return an iterator on the cell and 'true' if it was inserted, or
+     * (end(), false) if the cell is outside the bounds of the space.
+     */
+    std::pair< iterator, bool > insert( const value_type & value );
+
+    /**
+     * Inserts a cell with its data, if it does not belong to the map.
+     * @param hint an iterator, which is not used.
+     * @param value a pair (cell, data).
+     * @return an iterator on the cell.
+     */
+    iterator insert( const_iterator hint, const value_type & value );
+
+    /**
+     * @param key any cell within the bounds of the space.
+     * @return a reference on the data of @a key, which is inserted
+     * with a default data when it does not belong to the map.
+     */
+    mapped_type & operator[]( const key_type & key );
+
+    /// @param key any cell.
+    /// @return an iterator on @a key, or end().
+    iterator find( const key_type & key );
+    /// @param key any cell.
+    /// @return an iterator on @a key, or end().
+    const_iterator find( const key_type & key ) const;
+    /// @param key any cell.
+    /// @return 1 if @a key belongs to the map, 0 otherwise.
+    size_type count( const key_type & key ) const;
+    /// @param key any cell.
+    /// @return the range of the cells equal to @a key.
+    std::pair< iterator, iterator > equal_range( const key_type & key );
+    /// @param key any cell.
+    /// @return the range of the cells equal to @a key.
+    std::pair< const_iterator, const_iterator > equal_range( const key_type & key ) const;
+
+    /// Removes a cell.
+    /// @param key any cell.
+    /// @return the number of removed cells (0 or 1).
+    size_type erase( const key_type & key );
+    /// Removes a cell.
+    /// @param position an iterator on a cell of the map.
+    /// @return an iterator on the next cell.
+    iterator erase( iterator position );
+    /// Removes a range of cells.
+    /// @param first an iterator on a cell of the map.
+    /// @param last an iterator after @a first.
+    void erase( iterator first, iterator last );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The space in which the cells live.
+    const KSpace* mySpace;
+    /// The allocated blocks.
+    Directory myBlocks;
+    /// The number of cells.
+    size_type mySize;
+    /// The first Khalimsky coordinates of the closed (0) and open (1) cells.
+    Point myKFirst[ 2 ];
+    /// The number of closed (0) and open (1) cells along each axis.
+    Point myCount[ 2 ];
+    /// For each topology, the index of its first block then the
+    /// strides of its blocks along each axis.
+    std::vector< DGtal::uint64_t > myStrides;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// Takes the bounds of the space.
+    void initIndexing();
+
+    /**
+     * @param c any cell.
+     * @param[out] block the index of the block of @a c.
+     * @param[out] index the index of @a c within its block.
+     * @return 'true' iff @a c is within the bounds.
+     */
+    bool locate( const Cell & c, DGtal::uint64_t & block, unsigned int & index ) const;
+
+    /**
+     * @param c any cell within the bounds.
+     * @param index the index of @a c within its block.
+     * @return the block of @a c, with no members.
+     */
+    Block makeBlock( const Cell & c, unsigned int index ) const;
+
+    /**
+     * @param K the space of the cells.
+     * @param block any block.
+     * @param index any index within the block.
+     * @return the cell of index @a index in @a block.
+     */
+    static Cell cellOf( const KSpace & K, const Block & block, unsigned int index );
+
+    /// @return an iterator on the first member from @a block on.
+    template < typename BlockIterator >
+    IteratorType< std::is_same< BlockIterator, typename Directory::const_iterator >::value >
+    firstFrom( BlockIterator block, BlockIterator end ) const
+    {
+      typedef IteratorType< std::is_same< BlockIterator,
+                                          typename Directory::const_iterator >::value > It;
+      for ( ; block != end; ++block )
+        if ( block->second.mask != 0 )
+          return It( mySpace, block, end, Bits::leastSignificantBit( block->second.mask ) );
+      return It( mySpace, end, end, 0 );
+    }
+
+  }; // end of class DenseCellMap
+
+  /// Container traits of DenseCellMap: an unordered map.
+  template < typename TKSpace, typename TData >
+  struct ContainerTraits< DenseCellMap< TKSpace, TData > >
+  {
+    typedef UnorderedMapAssociativeCategory Category;
+  };
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'DenseCellMap'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'DenseCellMap' to write.
+   * @return the output stream after the writing.
+   */
+  template < typename TKSpace, typename TData >
+  std::ostream&
+  operator<< ( std::ostream & out, const DenseCellMap< TKSpace, TData > & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/DenseCellMap.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined DenseCellMap_h
+
+#undef DenseCellMap_RECURSES
+#endif // else defined(DenseCellMap_RECURSES)
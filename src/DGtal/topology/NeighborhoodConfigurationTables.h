@@ -0,0 +1,276 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file NeighborhoodConfigurationTables.h
+ * @brief Look up tables of the neighborhood configurations of a digital
+ * topology, loaded once and shared by all the objects.
+ *
+ * @date 2026/10/17
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see NeighborhoodConfigurations.h
+ * @see testNeighborhoodConfigurations.cpp
+ */
+
+#if defined(NeighborhoodConfigurationTables_RECURSES)
+#error Recursive header files inclusion detected in NeighborhoodConfigurationTables.h
+#else // defined(NeighborhoodConfigurationTables_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define NeighborhoodConfigurationTables_RECURSES
+
+#if !defined NeighborhoodConfigurationTables_h
+/** Prevents repeated inclusion of headers. */
+#define NeighborhoodConfigurationTables_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include "boost/dynamic_bitset.hpp"
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Bits.h"
+#include "DGtal/base/CountedPtr.h"
+#include "DGtal/topology/MetricAdjacency.h"
+#include "DGtal/topology/NeighborhoodConfigurations.h"
+#include "DGtal/topology/tables/NeighborhoodTables.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class NeighborhoodTablesTraits
+  /**
+     Description of template class 'NeighborhoodTablesTraits' <p>
+     \brief Aim: the precomputed tables available for a digital
+     topology (see NeighborhoodTables.h).
+
+     @tparam TForegroundAdjacency any model of CAdjacency.
+     @tparam TBackgroundAdjacency any model of CAdjacency.
+     @tparam dim the dimension of the embedding digital space.
+
+     The traits are specialized for the (4,8) and (8,4) adjacencies in
+     2D and (6,18), (18,6), (6,26) and (26,6) adjacencies in 3D, which
+     have a simplicity table. Only (26,6) has isthmus tables.
+   */
+  template <typename TForegroundAdjacency, typename TBackgroundAdjacency, Dimension dim>
+  struct NeighborhoodTablesTraits
+  {
+    static const bool HAS_SIMPLICITY_TABLE = false;
+    static const bool HAS_ISTHMUS_TABLES = false;
+  }; // end of class NeighborhoodTablesTraits
+
+  /**
+     \brief Aim: Specialization of NeighborhoodTablesTraits for topology (4,8).
+  */
+  template <typename TSpace>
+  struct NeighborhoodTablesTraits< MetricAdjacency< TSpace, 1>,
+                                   MetricAdjacency< TSpace, 2>,
+                                   2 >
+  {
+    static const bool HAS_SIMPLICITY_TABLE = true;
+    static const bool HAS_ISTHMUS_TABLES = false;
+    /// Maximal norm 1 of the foreground neighbors.
+    static const Dimension FOREGROUND_NORM1 = 1;
+    static std::string simplicityTable() { return simplicity::tableSimple4_8; }
+  };
+
+  /**
+     \brief Aim: Specialization of NeighborhoodTablesTraits for topology (8,4).
+  */
+  template <typename TSpace>
+  struct NeighborhoodTablesTraits< MetricAdjacency< TSpace, 2>,
+                                   MetricAdjacency< TSpace, 1>,
+                                   2 >
+  {
+    static const bool HAS_SIMPLICITY_TABLE = true;
+    static const bool HAS_ISTHMUS_TABLES = false;
+    /// Maximal norm 1 of the foreground neighbors.
+    static const Dimension FOREGROUND_NORM1 = 2;
+    static std::string simplicityTable() { return simplicity::tableSimple8_4; }
+  };
+
+  /**
+     \brief Aim: Specialization of NeighborhoodTablesTraits for topology (6,18).
+  */
+  template <typename TSpace>
+  struct NeighborhoodTablesTraits< MetricAdjacency< TSpace, 1>,
+                                   MetricAdjacency< TSpace, 2>,
+                                   3 >
+  {
+    static const bool HAS_SIMPLICITY_TABLE = true;
+    static const bool HAS_ISTHMUS_TABLES = false;
+    /// Maximal norm 1 of the foreground neighbors.
+    static const Dimension FOREGROUND_NORM1 = 1;
+    static std::string simplicityTable() { return simplicity::tableSimple6_18; }
+  };
+
+  /**
+     \brief Aim: Specialization of NeighborhoodTablesTraits for topology (18,6).
+  */
+  template <typename TSpace>
+  struct NeighborhoodTablesTraits< MetricAdjacency< TSpace, 2>,
+                                   MetricAdjacency< TSpace, 1>,
+                                   3 >
+  {
+    static const bool HAS_SIMPLICITY_TABLE = true;
+    static const bool HAS_ISTHMUS_TABLES = false;
+    /// Maximal norm 1 of the foreground neighbors.
+    static const Dimension FOREGROUND_NORM1 = 2;
+    static std::string simplicityTable() { return simplicity::tableSimple18_6; }
+  };
+
+  /**
+     \brief Aim: Specialization of NeighborhoodTablesTraits for topology (6,26).
+  */
+  template <typename TSpace>
+  struct NeighborhoodTablesTraits< MetricAdjacency< TSpace, 1>,
+                                   MetricAdjacency< TSpace, 3>,
+                                   3 >
+  {
+    static const bool HAS_SIMPLICITY_TABLE = true;
+    static const bool HAS_ISTHMUS_TABLES = false;
+    /// Maximal norm 1 of the foreground neighbors.
+    static const Dimension FOREGROUND_NORM1 = 1;
+    static std::string simplicityTable() { return simplicity::tableSimple6_26; }
+  };
+
+  /**
+     \brief Aim: Specialization of NeighborhoodTablesTraits for topology (26,6).
+  */
+  template <typename TSpace>
+  struct NeighborhoodTablesTraits< MetricAdjacency< TSpace, 3>,
+                                   MetricAdjacency< TSpace, 1>,
+                                   3 >
+  {
+    static const bool HAS_SIMPLICITY_TABLE = true;
+    static const bool HAS_ISTHMUS_TABLES = true;
+    /// Maximal norm 1 of the foreground neighbors.
+    static const Dimension FOREGROUND_NORM1 = 3;
+    static std::string simplicityTable() { return simplicity::tableSimple26_6; }
+    static std::string isthmusTable() { return isthmusicity::tableIsthmus; }
+    static std::string oneIsthmusTable() { return isthmusicity::tableOneIsthmus; }
+    static std::string twoIsthmusTable() { return isthmusicity::tableTwoIsthmus; }
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class NeighborhoodConfigurationTables
+  /**
+   * Description of template class 'NeighborhoodConfigurationTables' <p>
+   * \brief Aim: Gives the properties (simplicity, isthmus, end point)
+   * of a point from the configuration of its neighborhood (see
+   * functions::mapZeroPointNeighborhoodToConfigurationMask), for a
+   * given digital topology.
+   *
+   * The tables are loaded from the files of NeighborhoodTables.h the
+   * first time they are used, and then shared by all the callers
+   * (loading is thread-safe). All methods are static.
+   *
+   * @code
+   * using Tables = NeighborhoodConfigurationTables< Z3i::DT26_6 >;
+   * Object26_6 object( dt26_6, set );
+   * object.setTable( Tables::simplicityTable() ); // no copy, no reload.
+   * bool simple = Tables::isSimple( cfg );
+   * @endcode
+   *
+   * @tparam TDigitalTopology a DigitalTopology, with a table (see
+   * NeighborhoodTablesTraits). The isthmus tables only exist for
+   * (26,6).
+   */
+  template <typename TDigitalTopology>
+  class NeighborhoodConfigurationTables
+  {
+  public:
+    typedef TDigitalTopology                                DigitalTopology;
+    typedef typename DigitalTopology::ForegroundAdjacency   ForegroundAdjacency;
+    typedef typename DigitalTopology::BackgroundAdjacency   BackgroundAdjacency;
+    typedef typename DigitalTopology::Point                 Point;
+    /// The dimension of the space.
+    static const Dimension dimension = Point::dimension;
+    typedef NeighborhoodTablesTraits< ForegroundAdjacency,
+                                      BackgroundAdjacency,
+                                      dimension >           Traits;
+    /// Table configuration -> bool.
+    typedef boost::dynamic_bitset<>                         Table;
+
+    BOOST_STATIC_ASSERT(( Traits::HAS_SIMPLICITY_TABLE ));
+
+    // ----------------------- Tables -----------------------------------------
+  public:
+
+    /// @return the shared table of simple configurations.
+    static const CountedPtr< Table > & simplicityTable();
+    /// @return the shared table of 1- or 2-isthmus configurations (26,6 only).
+    static const CountedPtr< Table > & isthmusTable();
+    /// @return the shared table of 1-isthmus configurations (26,6 only).
+    static const CountedPtr< Table > & oneIsthmusTable();
+    /// @return the shared table of 2-isthmus configurations (26,6 only).
+    static const CountedPtr< Table > & twoIsthmusTable();
+
+    /**
+     * @return the bits of the configuration corresponding to the
+     * neighbors of the center for the foreground adjacency.
+     */
+    static NeighborhoodConfiguration foregroundMask();
+
+    // ----------------------- Predicates -------------------------------------
+  public:
+
+    /// @param cfg a neighborhood configuration.
+    /// @return 'true' iff the center is simple.
+    static bool isSimple( NeighborhoodConfiguration cfg );
+    /// @param cfg a neighborhood configuration.
+    /// @return 'true' iff the center is a 1- or 2-isthmus (26,6 only).
+    static bool isIsthmus( NeighborhoodConfiguration cfg );
+    /// @param cfg a neighborhood configuration.
+    /// @return 'true' iff the center is a 1-isthmus (26,6 only).
+    static bool isOneIsthmus( NeighborhoodConfiguration cfg );
+    /// @param cfg a neighborhood configuration.
+    /// @return 'true' iff the center is a 2-isthmus (26,6 only).
+    static bool isTwoIsthmus( NeighborhoodConfiguration cfg );
+    /// @param cfg a neighborhood configuration.
+    /// @return 'true' iff the center has exactly one foreground neighbor.
+    static bool isEnd( NeighborhoodConfiguration cfg );
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @param filename a table file.
+     * @return the table loaded from @a filename.
+     */
+    static CountedPtr< Table > load( const std::string & filename );
+
+  }; // end of class NeighborhoodConfigurationTables
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/NeighborhoodConfigurationTables.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined NeighborhoodConfigurationTables_h
+
+#undef NeighborhoodConfigurationTables_RECURSES
+#endif // else defined(NeighborhoodConfigurationTables_RECURSES)
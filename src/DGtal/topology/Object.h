@@ -60,6 +60,7 @@
 #include <boost/graph/properties.hpp>
 #include <boost/dynamic_bitset.hpp>
 #include <unordered_map>
+#include <type_traits>
 #include <DGtal/topology/helpers/NeighborhoodConfigurationsHelper.h>
 //////////////////////////////////////////////////////////////////////////////
 
@@ -601,6 +602,11 @@ objects[ 0 ].writeComponents( it ); // it points in same container as this.
      * careful, such a definition is valid only for Jordan couples in
      * dimension 2 and 3.
      *
+     * If no table was set with @ref Object::setTable, the shared table
+     * of NeighborhoodConfigurationTables is used when the topology has
+     * one (see NeighborhoodTablesTraits) and its file can be loaded.
+     * Otherwise the geodesic neighborhoods are computed.
+     *
      * @return 'true' if this point is simple.
      */
     bool isSimple( const Point & v ) const;
@@ -624,6 +630,16 @@ objects[ 0 ].writeComponents( it ); // it points in same container as this.
         const boost::dynamic_bitset<> & input_table,
 	const std::unordered_map< Point,
 	  NeighborhoodConfiguration > & mapZeroNeighborhoodToMask) const;
+
+    /**
+     * Checks the simplicity of a point by computing the connected
+     * components of its geodesic neighborhoods (see isSimple), without
+     * any table.
+     *
+     * @param v point to check simplicity.
+     * @return 'true' if this point is simple.
+     */
+    bool isSimpleFromGeodesicNeighborhoods( const Point & v ) const;
     // ----------------------- Interface --------------------------------------
   public:
 
@@ -674,6 +690,26 @@ objects[ 0 ].writeComponents( it ); // it points in same container as this.
      */
     bool myTableIsLoaded;
 
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Checks the simplicity of a point with the shared table of
+     * NeighborhoodConfigurationTables, or with its geodesic
+     * neighborhoods if the table file cannot be loaded.
+     * @param v any point.
+     * @return 'true' if this point is simple.
+     */
+    bool isSimpleFromSharedTable( const Point & v, std::true_type ) const;
+
+    /**
+     * Checks the simplicity of a point with its geodesic
+     * neighborhoods, since the topology has no table.
+     * @param v any point.
+     * @return 'true' if this point is simple.
+     */
+    bool isSimpleFromSharedTable( const Point & v, std::false_type ) const;
+
     // --------------- CDrawableWithBoard2D realization ------------------
   public:
     /**
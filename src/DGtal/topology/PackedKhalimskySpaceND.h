@@ -0,0 +1,885 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file PackedKhalimskySpaceND.h
+ * @brief A bounded Khalimsky space whose cells are packed in 64-bit codes.
+ *
+ * @date 2026/10/16
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see KhalimskySpaceND.h
+ */
+
+#if defined(PackedKhalimskySpaceND_RECURSES)
+#error Recursive header files inclusion detected in PackedKhalimskySpaceND.h
+#else // defined(PackedKhalimskySpaceND_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define PackedKhalimskySpaceND_RECURSES
+
+#if !defined PackedKhalimskySpaceND_h
+/** Prevents repeated inclusion of headers. */
+#define PackedKhalimskySpaceND_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <set>
+#include <map>
+#include <array>
+#include <functional>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/CInteger.h"
+#include "DGtal/kernel/PointVector.h"
+#include "DGtal/kernel/SpaceND.h"
+#include "DGtal/topology/KhalimskyPreSpaceND.h"
+#include "DGtal/topology/KhalimskySpaceND.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  /////////////////////////////////////////////////////////////////////////////
+  // Pre-declaration
+  template <
+      Dimension dim,
+      typename TInteger = DGtal::int32_t
+  >
+  class PackedKhalimskySpaceND;
+
+  /////////////////////////////////////////////////////////////////////////////
+  /**
+   * @brief Represents an (unsigned) cell of a PackedKhalimskySpaceND
+   * by a 64-bit code of its Khalimsky coordinates.
+   *
+   * The code is only meaningful for the space that created the cell.
+   *
+   * @tparam dim the dimension of the digital space.
+   * @tparam TInteger the Integer class used to specify the arithmetic computations (default type = int32).
+   */
+  template < Dimension dim,
+             typename TInteger = DGtal::int32_t >
+  struct PackedKhalimskyCell
+  {
+    // Aliases
+  public:
+    using Integer = TInteger;
+    using Code    = DGtal::uint64_t;
+    using PreCell = KhalimskyPreCell< dim, Integer >;
+    using CellularGridSpace = PackedKhalimskySpaceND< dim, TInteger >;
+    using PreCellularGridSpace = KhalimskyPreSpaceND< dim, TInteger >;
+    using Self    = PackedKhalimskyCell< dim, Integer >;
+
+    // Friendship
+    friend class PackedKhalimskySpaceND< dim, TInteger >;
+
+  private:
+    /// The packed Khalimsky coordinates.
+    Code myCode;
+
+  public:
+    /** @brief
+     * Default constructor.
+     */
+    explicit PackedKhalimskyCell( Integer dummy = 0 );
+
+    /// @return the code of the cell.
+    Code code() const;
+
+    /** @brief
+     * Equality operator.
+     * @param other any other cell.
+     */
+    bool operator==( const PackedKhalimskyCell & other ) const;
+
+    /** @brief
+     * Difference operator.
+     * @param other any other cell.
+     */
+    bool operator!=( const PackedKhalimskyCell & other ) const;
+
+    /** @brief
+     * Inferior operator (order of the codes, i.e. lexicographic order
+     * starting from the last coordinate).
+     * @param other any other cell.
+     */
+    bool operator<( const PackedKhalimskyCell & other ) const;
+
+    /** @brief Return the style name used for drawing this object.
+     * @return the style name used for drawing this object.
+     */
+    std::string className() const;
+  };
+
+  template < Dimension dim,
+             typename TInteger >
+  std::ostream &
+  operator<<( std::ostream & out,
+              const PackedKhalimskyCell< dim, TInteger > & object );
+
+  /////////////////////////////////////////////////////////////////////////////
+  /**
+   * @brief Represents a signed cell of a PackedKhalimskySpaceND by a
+   * 64-bit code of its Khalimsky coordinates and of its sign.
+   *
+   * The code is only meaningful for the space that created the cell.
+   *
+   * @tparam dim the dimension of the digital space.
+   * @tparam TInteger the Integer class used to specify the arithmetic computations (default type = int32).
+   */
+  template < Dimension dim,
+             typename TInteger = DGtal::int32_t >
+  struct SignedPackedKhalimskyCell
+  {
+    // Aliases
+  public:
+    using Integer = TInteger;
+    using Code    = DGtal::uint64_t;
+    using SPreCell = SignedKhalimskyPreCell< dim, Integer >;
+    using CellularGridSpace = PackedKhalimskySpaceND< dim, TInteger >;
+    using PreCellularGridSpace = KhalimskyPreSpaceND< dim, TInteger >;
+    using Self    = SignedPackedKhalimskyCell< dim, Integer >;
+
+    // Friendship
+    friend class PackedKhalimskySpaceND< dim, TInteger >;
+
+  private:
+    /// The packed Khalimsky coordinates, the sign being the highest bit.
+    Code myCode;
+
+  public:
+    /** @brief
+     * Default constructor.
+     */
+    explicit SignedPackedKhalimskyCell( Integer dummy = 0 );
+
+    /// @return the code of the cell.
+    Code code() const;
+
+    /** @brief
+     * Equality operator.
+     * @param other any other cell.
+     */
+    bool operator==( const SignedPackedKhalimskyCell & other ) const;
+
+    /** @brief
+     * Difference operator.
+     * @param other any other cell.
+     */
+    bool operator!=( const SignedPackedKhalimskyCell & other ) const;
+
+    /** @brief
+     * Inferior operator (order of the codes).
+     * @param other any other cell.
+     */
+    bool operator<( const SignedPackedKhalimskyCell & other ) const;
+
+    /** @brief Return the style name used for drawing this object.
+     * @return the style name used for drawing this object.
+     */
+    std::string className() const;
+  };
+
+  template < Dimension dim,
+             typename TInteger >
+  std::ostream &
+  operator<<( std::ostream & out,
+              const SignedPackedKhalimskyCell< dim, TInteger > & object );
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class PackedKhalimskySpaceND
+  /**
+   * Description of template class 'PackedKhalimskySpaceND' <p>
+   *
+   * \brief Aim: This class is a model of CCellularGridSpaceND with
+   * the same cells and the same services as KhalimskySpaceND, but
+   * whose cells are stored in a single 64-bit integer instead of an
+   * array of integers.
+   *
+   * The Khalimsky coordinate along axis \c k, translated by
+   * `2*lower[k]-2` so that it is positive with the same parity, is
+   * stored in the bits `[k*B, (k+1)*B)` of the code, with `B = 63 /
+   * dim` (31 bits in 2D, 21 bits in 3D), and the highest bit is the
+   * sign of signed cells. Hence the topology of a cell is given by the
+   * bits `k*B`, and the incident and adjacent cells are obtained by
+   * adding or subtracting a constant to the code: uDim(),
+   * uIncident(), sDirect(), sDirectIncident(), sAdjacent(), etc. are a
+   * few bit operations. Cells are 8 bytes instead of 16 (2D) or 32
+   * (3D) bytes for KhalimskySpaceND< 3, int32_t >, and they are
+   * compared and hashed as integers.
+   *
+   * The space must be bounded with at most `2^(B-1) - 3` digital
+   * points along each axis (about one million in 3D), closed or open
+   * along each axis, but not periodic: otherwise init() returns \c
+   * false. The less frequent services (e.g. neighborhoods, faces,
+   * scanning) are delegated to the equivalent KhalimskySpaceND, see
+   * unpackedSpace().
+   *
+   * The order of cells is the order of their codes, and not the
+   * lexicographic order of KhalimskySpaceND.
+   *
+   * @tparam dim the dimension of the digital space.
+   * @tparam TInteger the Integer class used to specify the arithmetic computations (default type = int32).
+   *
+   * @see KhalimskySpaceND
+   */
+  template <
+      Dimension dim,
+      typename TInteger
+  >
+  class PackedKhalimskySpaceND
+  {
+    /// Integer must be signed to characterize a ring.
+    BOOST_CONCEPT_ASSERT(( concepts::CInteger<TInteger> ) );
+    /// At least two coordinates, so that each one fits in the Integer type.
+    BOOST_STATIC_ASSERT(( dim >= 2 ));
+
+  public:
+    /// Arithmetic ring induced by (+,-,*) and Integer numbers.
+    typedef TInteger Integer;
+
+    /// Type used to represent sizes in the digital space.
+    typedef typename NumberTraits<Integer>::UnsignedVersion Size;
+
+    /// Type of the codes of the cells.
+    typedef DGtal::uint64_t Code;
+
+    // Spaces
+    typedef SpaceND<dim, Integer> Space;
+    typedef PackedKhalimskySpaceND<dim, Integer> CellularGridSpace;
+    typedef KhalimskyPreSpaceND<dim, Integer> PreCellularGridSpace;
+    /// The equivalent space with unpacked cells.
+    typedef KhalimskySpaceND<dim, Integer> UnpackedSpace;
+
+    // Cells
+    typedef PackedKhalimskyCell< dim, Integer > Cell;
+    typedef KhalimskyPreCell< dim, Integer > PreCell;
+    typedef SignedPackedKhalimskyCell< dim, Integer > SCell;
+    typedef SignedKhalimskyPreCell< dim, Integer > SPreCell;
+    typedef typename UnpackedSpace::Cell UnpackedCell;
+    typedef typename UnpackedSpace::SCell UnpackedSCell;
+
+    typedef SCell Surfel;
+    typedef bool Sign;
+    using DirIterator = typename PreCellularGridSpace::DirIterator;
+
+    // Points and Vectors
+    typedef PointVector< dim, Integer > Point;
+    typedef PointVector< dim, Integer > Vector;
+
+    // static constants
+    static const constexpr Dimension dimension = dim;
+    static const constexpr Dimension DIM = dim;
+    static const constexpr Sign POS = true;
+    static const constexpr Sign NEG = false;
+    /// Number of bits per coordinate in the codes.
+    static const constexpr unsigned int BITS = 63 / dim;
+
+    template < typename CellType >
+    using AnyCellCollection = typename PreCellularGridSpace::template AnyCellCollection< CellType >;
+
+    // Neighborhoods, Incident cells, Faces and Cofaces
+    typedef AnyCellCollection<Cell> Cells;
+    typedef AnyCellCollection<SCell> SCells;
+
+    // Sets, Maps
+    /// Preferred type for defining a set of Cell(s).
+    typedef std::set<Cell> CellSet;
+
+    /// Preferred type for defining a set of SCell(s).
+    typedef std::set<SCell> SCellSet;
+
+    /// Preferred type for defining a set of surfels (always signed cells).
+    typedef std::set<SCell> SurfelSet;
+
+    /// Template rebinding for defining the type that is a mapping
+    /// Cell -> Value.
+    template <typename Value> struct CellMap {
+        typedef std::map<Cell,Value> Type;
+    };
+
+    /// Template rebinding for defining the type that is a mapping
+    /// SCell -> Value.
+    template <typename Value> struct SCellMap {
+        typedef std::map<SCell,Value> Type;
+    };
+
+    /// Template rebinding for defining the type that is a mapping
+    /// SCell -> Value.
+    template <typename Value> struct SurfelMap {
+        typedef std::map<SCell,Value> Type;
+    };
+
+    /// Boundaries closure type
+    typedef typename UnpackedSpace::Closure Closure;
+    static const constexpr Closure CLOSED = UnpackedSpace::CLOSED;
+    static const constexpr Closure OPEN = UnpackedSpace::OPEN;
+    static const constexpr Closure PERIODIC = UnpackedSpace::PERIODIC;
+
+    // ----------------------- Standard services ------------------------------
+    /** @name Standard services
+     * @{
+     */
+  public:
+
+    /// Default constructor: the largest centered space that can be packed.
+    PackedKhalimskySpaceND();
+
+    /** Constructor from bounds.
+     * @param lower the lowest point in this space (digital coords)
+     * @param upper the upper point in this space (digital coords)
+     * @param isClosed 'true' if this space is closed, 'false' if open.
+     * @see init
+     */
+    PackedKhalimskySpaceND( const Point & lower, const Point & upper,
+                            bool isClosed = true );
+
+    /** Specifies the upper and lower bounds for the maximal cells in this space.
+     *
+     * @param lower the lowest point in this space (digital coords)
+     * @param upper the upper point in this space (digital coords)
+     * @param isClosed 'true' if this space is closed, 'false' if open.
+     * @return true if the initialization was valid (ie, such bounds
+     * can be packed in the codes).
+     */
+    bool init( const Point & lower, const Point & upper, bool isClosed );
+
+    /** Specifies the upper and lower bounds for the maximal cells in
+     * this space, and the closure of each dimension.
+     *
+     * @param lower the lowest point in this space (digital coords)
+     * @param upper the upper point in this space (digital coords)
+     * @param closure the closure of each dimension, CLOSED or OPEN.
+     * @return true if the initialization was valid (ie, such bounds
+     * can be packed in the codes and no dimension is periodic).
+     */
+    bool init( const Point & lower, const Point & upper,
+               const std::array<Closure, dim> & closure );
+
+    /// @return the equivalent space with unpacked cells.
+    const UnpackedSpace & unpackedSpace() const;
+
+    /** @} */
+
+    // ------------------------- Conversions ----------------------------------
+    /** @name Conversions from and to unpacked cells
+     * @{
+     */
+  public:
+
+    /// @param c any cell of this space.
+    /// @return the same cell in unpackedSpace().
+    UnpackedCell unpack( const Cell & c ) const;
+
+    /// @param c any signed cell of this space.
+    /// @return the same signed cell in unpackedSpace().
+    UnpackedSCell unpack( const SCell & c ) const;
+
+    /// @param c any cell of unpackedSpace().
+    /// @return the same cell in this space.
+    Cell pack( const UnpackedCell & c ) const;
+
+    /// @param c any signed cell of unpackedSpace().
+    /// @return the same signed cell in this space.
+    SCell pack( const UnpackedSCell & c ) const;
+
+    /** @} */
+
+    // ------------------------- Basic services ------------------------------
+    /** @name Basic services
+     * @{
+     */
+  public:
+
+    /// @param k a coordinate (from 0 to 'dim()-1').
+    /// @return the width of the space in the @a k-dimension.
+    Size size( Dimension k ) const;
+
+    /// @param k a coordinate (from 0 to 'dim()-1').
+    /// @return the minimal digital coordinate in the @a k-dimension.
+    Integer min( Dimension k ) const;
+
+    /// @param k a coordinate (from 0 to 'dim()-1').
+    /// @return the maximal digital coordinate in the @a k-dimension.
+    Integer max( Dimension k ) const;
+
+    /// @return the lower bound for digital points in this space.
+    const Point & lowerBound() const;
+
+    /// @return the upper bound for digital points in this space.
+    const Point & upperBound() const;
+
+    /// @return the lower bound for cells in this space.
+    const Cell & lowerCell() const;
+
+    /// @return the upper bound for cells in this space.
+    const Cell & upperCell() const;
+
+    /// @return 'true' iff the cell @a c is within the bounds along the axis @a k.
+    bool uIsValid( const Cell & c, Dimension k ) const;
+    /// @return 'true' iff the cell @a c is within the bounds of the space.
+    bool uIsValid( const Cell & c ) const;
+    /// @return 'true' iff the signed cell @a c is within the bounds along the axis @a k.
+    bool sIsValid( const SCell & c, Dimension k ) const;
+    /// @return 'true' iff the signed cell @a c is within the bounds of the space.
+    bool sIsValid( const SCell & c ) const;
+    /// @return 'true' iff the Khalimsky point @a p is within the bounds along the axis @a k.
+    bool cIsValid( const Point & p, Dimension k ) const;
+    /// @return 'true' iff the Khalimsky point @a p is within the bounds of the space.
+    bool cIsValid( const Point & p ) const;
+
+    /** @} */
+
+    // ----------------------- Closure type query --------------------------
+    /** @name Closure type query
+     * @{
+     */
+  public:
+
+    /// @return 'true' iff the space is closed along every dimension.
+    bool isSpaceClosed() const;
+    /// @return 'true' iff the space is closed along dimension @a k.
+    bool isSpaceClosed( Dimension k ) const;
+    /// @return 'false', a packed space is never periodic.
+    bool isSpacePeriodic() const;
+    /// @return 'false', a packed space is never periodic.
+    bool isSpacePeriodic( Dimension k ) const;
+    /// @return 'false', a packed space is never periodic.
+    bool isAnyDimensionPeriodic() const;
+    /// @return the closure type along dimension @a k.
+    Closure getClosure( Dimension k ) const;
+
+    /** @} */
+
+    // ----------------------- Cell creation services --------------------------
+    /** @name Cell creation services
+     * @{
+     */
+  public:
+
+    /// @param c a pre-cell within the bounds.
+    /// @return the cell with the same Khalimsky coordinates.
+    Cell uCell( const PreCell & c ) const;
+    /// @param kp an integer point (Khalimsky coordinates of cell).
+    /// @return the unsigned cell with these Khalimsky coordinates.
+    Cell uCell( const Point & kp ) const;
+    /// @param p an integer point (digital coordinates of cell).
+    /// @param c another cell defining the topology.
+    /// @return the cell having the topology of @a c and the given digital coordinates @a p.
+    Cell uCell( Point p, const Cell & c ) const;
+    /// @param c a signed pre-cell within the bounds.
+    /// @return the signed cell with the same Khalimsky coordinates and sign.
+    SCell sCell( const SPreCell & c ) const;
+    /// @param kp an integer point (Khalimsky coordinates of cell).
+    /// @param sign the sign of the cell (either POS or NEG).
+    /// @return the signed cell with these Khalimsky coordinates and sign.
+    SCell sCell( const Point & kp, Sign sign = POS ) const;
+    /// @param p an integer point (digital coordinates of cell).
+    /// @param c another cell defining the topology and sign.
+    /// @return the cell having the topology and sign of @a c and the given digital coordinates @a p.
+    SCell sCell( Point p, const SCell & c ) const;
+    /// @param p an integer point (digital coordinates of cell).
+    /// @return the spel with the given digital coordinates @a p.
+    Cell uSpel( Point p ) const;
+    /// @param p an integer point (digital coordinates of cell).
+    /// @param sign the sign of the cell (either POS or NEG).
+    /// @return the signed spel with the given digital coordinates @a p.
+    SCell sSpel( Point p, Sign sign = POS ) const;
+    /// @param p an integer point (digital coordinates of cell).
+    /// @return the pointel with the given digital coordinates @a p.
+    Cell uPointel( Point p ) const;
+    /// @param p an integer point (digital coordinates of cell).
+    /// @param sign the sign of the cell (either POS or NEG).
+    /// @return the signed pointel with the given digital coordinates @a p.
+    SCell sPointel( Point p, Sign sign = POS ) const;
+
+    /** @} */
+
+    // ----------------------- Read accessors to cells ------------------------
+    /** @name Read accessors to cells
+     * @{
+     */
+  public:
+
+    /// @return its Khalimsky coordinate along @a k.
+    Integer uKCoord( const Cell & c, Dimension k ) const;
+    /// @return its digital coordinate along @a k.
+    Integer uCoord( const Cell & c, Dimension k ) const;
+    /// @return its Khalimsky coordinates.
+    Point uKCoords( const Cell & c ) const;
+    /// @return its digital coordinates.
+    Point uCoords( const Cell & c ) const;
+    /// @return its Khalimsky coordinate along @a k.
+    Integer sKCoord( const SCell & c, Dimension k ) const;
+    /// @return its digital coordinate along @a k.
+    Integer sCoord( const SCell & c, Dimension k ) const;
+    /// @return its Khalimsky coordinates.
+    Point sKCoords( const SCell & c ) const;
+    /// @return its digital coordinates.
+    Point sCoords( const SCell & c ) const;
+    /// @return its sign.
+    Sign sSign( const SCell & c ) const;
+
+    /** @} */
+
+    // ----------------------- Write accessors to cells ------------------------
+    /** @name Write accessors to cells
+     * @{
+     */
+  public:
+
+    /// Sets the @a k-th Khalimsky coordinate of @a c to @a i.
+    void uSetKCoord( Cell & c, Dimension k, Integer i ) const;
+    /// Sets the @a k-th Khalimsky coordinate of @a c to @a i.
+    void sSetKCoord( SCell & c, Dimension k, Integer i ) const;
+    /// Sets the @a k-th digital coordinate of @a c to @a i.
+    void uSetCoord( Cell & c, Dimension k, Integer i ) const;
+    /// Sets the @a k-th digital coordinate of @a c to @a i.
+    void sSetCoord( SCell & c, Dimension k, Integer i ) const;
+    /// Sets the Khalimsky coordinates of @a c to @a kp.
+    void uSetKCoords( Cell & c, const Point & kp ) const;
+    /// Sets the Khalimsky coordinates of @a c to @a kp.
+    void sSetKCoords( SCell & c, const Point & kp ) const;
+    /// Sets the digital coordinates of @a c to @a kp.
+    void uSetCoords( Cell & c, const Point & kp ) const;
+    /// Sets the digital coordinates of @a c to @a kp.
+    void sSetCoords( SCell & c, const Point & kp ) const;
+    /// Sets the sign of the cell @a c to @a s.
+    void sSetSign( SCell & c, Sign s ) const;
+
+    /** @} */
+
+    // -------------------- Conversion signed/unsigned ------------------------
+    /** @name Conversion signed/unsigned
+     * @{
+     */
+  public:
+
+    /// @return the signed cell with the same coordinates as @a p and the sign @a s.
+    SCell signs( const Cell & p, Sign s ) const;
+    /// @return the unsigned cell with the same coordinates as @a p.
+    Cell unsigns( const SCell & p ) const;
+    /// @return the cell with the same coordinates as @a p and the opposite sign.
+    SCell sOpp( const SCell & p ) const;
+
+    /** @} */
+
+    // ------------------------- Cell topology services -----------------------
+    /** @name Cell topology services
+     * @{
+     */
+  public:
+
+    /// @return the topology word of @a p (bit k is set iff it is open along k).
+    Integer uTopology( const Cell & p ) const;
+    /// @return the topology word of @a p (bit k is set iff it is open along k).
+    Integer sTopology( const SCell & p ) const;
+    /// @return the dimension of the cell @a p.
+    Dimension uDim( const Cell & p ) const;
+    /// @return the dimension of the cell @a p.
+    Dimension sDim( const SCell & p ) const;
+    /// @return 'true' if @a b is a surfel (spans all but one coordinate).
+    bool uIsSurfel( const Cell & b ) const;
+    /// @return 'true' if @a b is a surfel (spans all but one coordinate).
+    bool sIsSurfel( const SCell & b ) const;
+    /// @return 'true' iff the cell @a p is open along the direction @a k.
+    bool uIsOpen( const Cell & p, Dimension k ) const;
+    /// @return 'true' iff the cell @a p is open along the direction @a k.
+    bool sIsOpen( const SCell & p, Dimension k ) const;
+
+    /** @} */
+
+    // -------------------- Iterator services for cells ------------------------
+    /** @name Iterator services for cells
+     * @{
+     */
+  public:
+
+    /// @return an iterator over the directions along which @a p is open.
+    DirIterator uDirs( const Cell & p ) const;
+    /// @return an iterator over the directions along which @a p is open.
+    DirIterator sDirs( const SCell & p ) const;
+    /// @return an iterator over the directions along which @a p is closed.
+    DirIterator uOrthDirs( const Cell & p ) const;
+    /// @return an iterator over the directions along which @a p is closed.
+    DirIterator sOrthDirs( const SCell & p ) const;
+    /// @pre @a s is a surfel.
+    /// @return the orthogonal direction to the surfel @a s.
+    Dimension uOrthDir( const Cell & s ) const;
+    /// @pre @a s is a surfel.
+    /// @return the orthogonal direction to the surfel @a s.
+    Dimension sOrthDir( const SCell & s ) const;
+
+    /** @} */
+
+    // -------------------- Unsigned cell geometry services --------------------
+    /** @name Unsigned cell geometry services
+     * @see KhalimskySpaceND for their semantics.
+     * @{
+     */
+  public:
+
+    Integer uFirst( const PreCell & p, Dimension k ) const;
+    Cell uFirst( const PreCell & p ) const;
+    Cell uFirst( const Cell & p ) const;
+    Integer uLast( const PreCell & p, Dimension k ) const;
+    Cell uLast( const PreCell & p ) const;
+    Cell uLast( const Cell & p ) const;
+    Cell uGetIncr( const Cell & p, Dimension k ) const;
+    bool uIsMax( const Cell & p, Dimension k ) const;
+    bool uIsInside( const PreCell & p, Dimension k ) const;
+    bool uIsInside( const PreCell & p ) const;
+    bool uIsInside( const Cell & p, Dimension k ) const;
+    bool uIsInside( const Cell & p ) const;
+    bool cIsInside( const Point & p, Dimension k ) const;
+    bool cIsInside( const Point & p ) const;
+    Cell uGetMax( Cell p, Dimension k ) const;
+    Cell uGetDecr( const Cell & p, Dimension k ) const;
+    bool uIsMin( const Cell & p, Dimension k ) const;
+    Cell uGetMin( Cell p, Dimension k ) const;
+    Cell uGetAdd( const Cell & p, Dimension k, Integer x ) const;
+    Cell uGetSub( const Cell & p, Dimension k, Integer x ) const;
+    Integer uDistanceToMax( const Cell & p, Dimension k ) const;
+    Integer uDistanceToMin( const Cell & p, Dimension k ) const;
+    Cell uTranslation( const Cell & p, const Vector & vec ) const;
+    Cell uProjection( const Cell & p, const Cell & bound, Dimension k ) const;
+    void uProject( Cell & p, const Cell & bound, Dimension k ) const;
+    bool uNext( Cell & p, const Cell & lower, const Cell & upper ) const;
+
+    /** @} */
+
+    // -------------------- Signed cell geometry services --------------------
+    /** @name Signed cell geometry services
+     * @see KhalimskySpaceND for their semantics.
+     * @{
+     */
+  public:
+
+    Integer sFirst( const SPreCell & p, Dimension k ) const;
+    SCell sFirst( const SPreCell & p ) const;
+    SCell sFirst( const SCell & p ) const;
+    Integer sLast( const SPreCell & p, Dimension k ) const;
+    SCell sLast( const SPreCell & p ) const;
+    SCell sLast( const SCell & p ) const;
+    SCell sGetIncr( const SCell & p, Dimension k ) const;
+    bool sIsMax( const SCell & p, Dimension k ) const;
+    bool sIsInside( const SPreCell & p, Dimension k ) const;
+    bool sIsInside( const SPreCell & p ) const;
+    bool sIsInside( const SCell & p, Dimension k ) const;
+    bool sIsInside( const SCell & p ) const;
+    SCell sGetMax( SCell p, Dimension k ) const;
+    SCell sGetDecr( const SCell & p, Dimension k ) const;
+    bool sIsMin( const SCell & p, Dimension k ) const;
+    SCell sGetMin( SCell p, Dimension k ) const;
+    SCell sGetAdd( const SCell & p, Dimension k, Integer x ) const;
+    SCell sGetSub( const SCell & p, Dimension k, Integer x ) const;
+    Integer sDistanceToMax( const SCell & p, Dimension k ) const;
+    Integer sDistanceToMin( const SCell & p, Dimension k ) const;
+    SCell sTranslation( const SCell & p, const Vector & vec ) const;
+    SCell sProjection( const SCell & p, const SCell & bound, Dimension k ) const;
+    void sProject( SCell & p, const SCell & bound, Dimension k ) const;
+    bool sNext( SCell & p, const SCell & lower, const SCell & upper ) const;
+
+    /** @} */
+
+    // ----------------------- Neighborhood services --------------------------
+    /** @name Neighborhood services
+     * @see KhalimskySpaceND for their semantics.
+     * @{
+     */
+  public:
+
+    Cells uNeighborhood( const Cell & cell ) const;
+    SCells sNeighborhood( const SCell & cell ) const;
+    Cells uProperNeighborhood( const Cell & cell ) const;
+    SCells sProperNeighborhood( const SCell & cell ) const;
+    Cell uAdjacent( const Cell & p, Dimension k, bool up ) const;
+    SCell sAdjacent( const SCell & p, Dimension k, bool up ) const;
+
+    /** @} */
+
+    // ----------------------- Incidence services --------------------------
+    /** @name Incidence services
+     * @see KhalimskySpaceND for their semantics.
+     * @{
+     */
+  public:
+
+    Cell uIncident( const Cell & c, Dimension k, bool up ) const;
+    SCell sIncident( const SCell & c, Dimension k, bool up ) const;
+    Cells uLowerIncident( const Cell & c ) const;
+    Cells uUpperIncident( const Cell & c ) const;
+    SCells sLowerIncident( const SCell & c ) const;
+    SCells sUpperIncident( const SCell & c ) const;
+    Cells uFaces( const Cell & c ) const;
+    Cells uCoFaces( const Cell & c ) const;
+    bool sDirect( const SCell & p, Dimension k ) const;
+    SCell sDirectIncident( const SCell & p, Dimension k ) const;
+    SCell sIndirectIncident( const SCell & p, Dimension k ) const;
+    Point interiorVoxel( const SCell & c ) const;
+    Point exteriorVoxel( const SCell & c ) const;
+
+    /** @} */
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The equivalent space with unpacked cells.
+    UnpackedSpace myKSpace;
+    /// The Khalimsky coordinates of the code 0, i.e. 2*lower-2.
+    Point myKOrigin;
+    /// Lower bound for cells.
+    Cell myCellLower;
+    /// Upper bound for cells.
+    Cell myCellUpper;
+
+    /// The mask of one coordinate of a code.
+    static const constexpr Code FIELD_MASK = ( Code( 1 ) << BITS ) - 1;
+    /// The sign bit of a code.
+    static const constexpr Code SIGN_BIT = Code( 1 ) << 63;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// @return the code of the unit Khalimsky vector along @a k.
+    static Code unit( Dimension k );
+    /// @return the mask of the lowest bit of every coordinate.
+    static Code topologyMask();
+    /// @return the mask of the lowest bit of the coordinates 0 to @a k.
+    static Code topologyMask( Dimension k );
+    /// @return the @a k-th translated Khalimsky coordinate of the code @a c.
+    static Code field( Code c, Dimension k );
+    /// @return the number of set bits of @a c.
+    static unsigned int popCount( Code c );
+    /// @return the code of the Khalimsky coordinates @a kp.
+    Code encode( const Point & kp ) const;
+    /// @return the Khalimsky coordinates of the code @a c.
+    Point decode( Code c ) const;
+    /// @return the code of the cell @a c after a move along @a k.
+    static Code move( Code c, Dimension k, bool up, Code steps = 1 );
+    /// @return the parity of the number of open coordinates of @a c up to @a k.
+    static bool openParity( Code c, Dimension k );
+    /// @return the cell with code @a c.
+    static Cell makeCell( Code c );
+    /// @return the signed cell with code @a c.
+    static SCell makeSCell( Code c );
+    /// @return the packed version of a collection of unpacked cells.
+    template < typename CellType, typename UnpackedCells >
+    AnyCellCollection< CellType > packAll( const UnpackedCells & cells ) const;
+
+  }; // end of class PackedKhalimskySpaceND
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'PackedKhalimskySpaceND'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'PackedKhalimskySpaceND' to write.
+   * @return the output stream after the writing.
+   */
+  template < Dimension dim, typename TInteger >
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const PackedKhalimskySpaceND< dim, TInteger > & object );
+
+} // namespace DGtal
+
+namespace std {
+  /** @brief
+   * Extend std namespace to define a std::hash function on
+   * DGtal::PackedKhalimskyCell.
+   */
+  template < DGtal::Dimension dim,
+             typename TInteger >
+  struct hash< DGtal::PackedKhalimskyCell< dim, TInteger > >
+  {
+    size_t operator()(const DGtal::PackedKhalimskyCell< dim, TInteger > & c) const
+    {
+      return std::hash< DGtal::uint64_t >()( c.code() );
+    }
+  };
+
+  /** @brief
+   * Extend std namespace to define a std::hash function on
+   * DGtal::SignedPackedKhalimskyCell.
+   */
+  template < DGtal::Dimension dim,
+             typename TInteger >
+  struct hash< DGtal::SignedPackedKhalimskyCell< dim, TInteger > >
+  {
+    size_t operator()(const DGtal::SignedPackedKhalimskyCell< dim, TInteger > & c) const
+    {
+      return std::hash< DGtal::uint64_t >()( c.code() );
+    }
+  };
+}
+
+namespace boost {
+  /** @brief
+   * Extend boost namespace to define a boost::hash function on
+   * DGtal::PackedKhalimskyCell.
+   */
+  template < DGtal::Dimension dim,
+             typename TInteger >
+  struct hash< DGtal::PackedKhalimskyCell< dim, TInteger > >
+  {
+    size_t operator()(const DGtal::PackedKhalimskyCell< dim, TInteger > & c) const
+    {
+      return boost::hash< DGtal::uint64_t >()( c.code() );
+    }
+  };
+
+  /** @brief
+   * Extend boost namespace to define a boost::hash function on
+   * DGtal::SignedPackedKhalimskyCell.
+   */
+  template < DGtal::Dimension dim,
+             typename TInteger >
+  struct hash< DGtal::SignedPackedKhalimskyCell< dim, TInteger > >
+  {
+    size_t operator()(const DGtal::SignedPackedKhalimskyCell< dim, TInteger > & c) const
+    {
+      return boost::hash< DGtal::uint64_t >()( c.code() );
+    }
+  };
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/PackedKhalimskySpaceND.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined PackedKhalimskySpaceND_h
+
+#undef PackedKhalimskySpaceND_RECURSES
+#endif // else defined(PackedKhalimskySpaceND_RECURSES)
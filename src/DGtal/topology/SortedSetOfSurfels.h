@@ -0,0 +1,458 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file SortedSetOfSurfels.h
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module SortedSetOfSurfels.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(SortedSetOfSurfels_RECURSES)
+#error Recursive header files inclusion detected in SortedSetOfSurfels.h
+#else // defined(SortedSetOfSurfels_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define SortedSetOfSurfels_RECURSES
+
+#if !defined SortedSetOfSurfels_h
+/** Prevents repeated inclusion of headers. */
+#define SortedSetOfSurfels_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <limits>
+#include <atomic>
+#include <mutex>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/topology/Topology.h"
+#include "DGtal/topology/SurfelAdjacency.h"
+#include "DGtal/topology/SurfelNeighborhood.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class SortedSetOfSurfels
+  /**
+     Description of template class 'SortedSetOfSurfels' <p> \brief
+     Aim: A model of CDigitalSurfaceContainer which stores an
+     arbitrary set of surfels in a sorted vector, together with the
+     indices of the adjacent surfels of each surfel.
+
+     It represents the same surface as SetOfSurfels, but the surfels
+     are stored contiguously, without the nodes of a std::set or of a
+     std::unordered_set, and the tracker moves are array lookups
+     instead of searches in the set. Membership is a binary search
+     in the sorted surfels. The surfels are iterated in increasing
+     order, as with KSpace::SCellSet.
+
+     The adjacent surfels are computed once, for the given surfel
+     adjacency, in parallel with WorkStealingScheduler, when they are
+     first needed (by a tracker or adjacentIndex). They take
+     NB_ADJACENT indices and move codes per surfel (20 bytes in 3D,
+     as much as a 3D surfel with 32-bit coordinates), so that a
+     container only used for membership tests and iteration keeps
+     only the sorted surfels. The set of surfels is not modifiable:
+     build a new container to change it.
+
+     @tparam TKSpace a model of CCellularGridSpaceND: the type chosen
+     for the cellular grid space.
+
+     @see SetOfSurfels
+   */
+  template < typename TKSpace >
+  class SortedSetOfSurfels
+  {
+  public:
+    typedef SortedSetOfSurfels<TKSpace> Self;
+    /// Model of cellular grid space.
+    typedef TKSpace KSpace;
+    /// Type for surfels.
+    typedef typename KSpace::SCell Surfel;
+    /// Type for sizes (unsigned integral type).
+    typedef typename KSpace::Size Size;
+    /// Type for the index of a surfel in the container.
+    typedef DGtal::uint32_t Index;
+    /// The index of no surfel.
+    static const Index INVALID_INDEX = std::numeric_limits<Index>::max();
+
+    /**
+       A model of CDigitalSurfaceTracker for SortedSetOfSurfels. It
+       knows the index of the current surfel, so that moves to
+       adjacent surfels do not search the container.
+    */
+    class Tracker
+    {
+    public:
+      // -------------------- associated types --------------------
+      typedef Tracker Self;
+      typedef SortedSetOfSurfels<TKSpace> DigitalSurfaceContainer;
+      typedef typename TKSpace::SCell Surfel;
+
+      // -------------------- inner types --------------------
+      typedef TKSpace KSpace;
+      typedef typename DigitalSurfaceContainer::Index Index;
+
+    public:
+      /**
+         Constructor from surface container and surfel.
+         @param aSurface the container describing the surface.
+         @param s the surfel on which the tracker is initialized.
+         @pre 'aSurface.isInside( s )'
+      */
+      Tracker( ConstAlias<DigitalSurfaceContainer> aSurface,
+               const Surfel & s );
+
+      /**
+         Copy constructor.
+         @param other the object to clone.
+      */
+      Tracker( const Tracker & other );
+
+      /**
+       * Destructor.
+       */
+      ~Tracker();
+
+      /// @return the surface container that the Tracker is tracking.
+      const DigitalSurfaceContainer & surface() const;
+      /// @return the current surfel on which the tracker is.
+      const Surfel & current() const;
+      /// @return the index of the current surfel in the container.
+      Index currentIndex() const;
+      /// @return the orthogonal direction to the current surfel.
+      Dimension orthDir() const;
+
+      /**
+         Moves the tracker to the given valid surfel. The move is
+         O(1) when @a s is the last surfel returned by adjacent,
+         otherwise @a s is searched in the container.
+
+         @pre 'surface().isInside( s )'
+         @param s the surfel on which the tracker is moved.
+      */
+      void move( const Surfel & s );
+
+      /**
+         Computes the surfel adjacent to 'current()' in the direction
+         [d] along orientation [pos].
+
+         @param s (modified) set to the adjacent surfel in the specified
+         direction @a d and orientation @a pos if it exists. Otherwise
+         unchanged (method returns 0 in this case).
+
+         @param d any direction different from 'orthDir()'.
+
+         @param pos when 'true' look in positive direction along
+         [track_dir] axis, 'false' look in negative direction.
+
+         @return the move code (n=0-3). When 0: no adjacent surfel,
+         otherwise 1-3: adjacent surfel is n-th follower.
+      */
+      uint8_t adjacent( Surfel & s, Dimension d, bool pos ) const;
+
+    private:
+      /// a reference to the digital surface container on which is the
+      /// tracker.
+      const DigitalSurfaceContainer & mySurface;
+      /// the index of the current surfel.
+      Index myIndex;
+      /// the index of the last surfel returned by adjacent.
+      mutable Index myAdjacentIndex;
+
+    };
+
+    /**
+       A model of concepts::CSurfelPredicate, true on the surfels of a
+       SortedSetOfSurfels.
+    */
+    class SurfelPredicate
+    {
+    public:
+      typedef typename TKSpace::SCell Surfel;
+      /**
+         Constructor.
+         @param aSurface the container of the surfels.
+      */
+      SurfelPredicate( ConstAlias<SortedSetOfSurfels> aSurface )
+        : mySurface( &aSurface ) {}
+      /**
+         @param s any surfel.
+         @return 'true' if @a s belongs to the container.
+      */
+      bool operator()( const Surfel & s ) const
+      { return mySurface->isInside( s ); }
+    private:
+      /// the container of the surfels.
+      const SortedSetOfSurfels* mySurface;
+    };
+
+    // ----------------------- associated types ------------------------------
+  public:
+    // -------------------- specific types ------------------------------
+    typedef std::vector<Surfel> SurfelStorage;
+    typedef typename SurfelStorage::const_iterator SurfelConstIterator;
+    typedef typename KSpace::Space Space;
+    typedef typename KSpace::Point Point;
+    typedef Tracker DigitalSurfaceTracker;
+
+    // ----------------------- other types ------------------------------
+  public:
+    typedef SurfelAdjacency<KSpace::dimension> Adjacency;
+    typedef typename KSpace::Cell Cell;
+    typedef typename KSpace::SCell SCell;
+    typedef typename KSpace::CellSet CellSet;
+    typedef typename KSpace::SCellSet SCellSet;
+
+    /// The number of adjacent surfels stored for each surfel.
+    static const Dimension NB_ADJACENT = 2 * ( KSpace::dimension - 1 );
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~SortedSetOfSurfels();
+
+    /**
+       Copy constructor.
+       @param other the object to clone.
+     */
+    SortedSetOfSurfels ( const SortedSetOfSurfels & other );
+
+    /**
+       Constructor from a vector of surfels. The surfels are sorted
+       and duplicates are removed. NB: O(n log n).
+
+       @param aKSpace a cellular grid space (referenced).
+
+       @param adj the surfel adjacency (for instance Adjacency( true )
+       is interior to exterior adjacency ).
+
+       @param someSurfels the surfels, which are moved into this
+       object. It may be the output of Surfaces::sMakeBoundaryParallel.
+      */
+    SortedSetOfSurfels( ConstAlias<KSpace> aKSpace,
+                        const Adjacency & adj,
+                        SurfelStorage someSurfels );
+
+    /**
+       Constructor from a range of surfels.
+
+       @tparam SurfelConstIterator any model of forward iterator on
+       surfels (e.g. the iterators of a SetOfSurfels).
+
+       @param aKSpace a cellular grid space (referenced).
+       @param adj the surfel adjacency.
+       @param itb an iterator on the first surfel.
+       @param ite an iterator after the last surfel.
+    */
+    template <typename TSurfelConstIterator>
+    SortedSetOfSurfels( ConstAlias<KSpace> aKSpace,
+                        const Adjacency & adj,
+                        TSurfelConstIterator itb,
+                        TSurfelConstIterator ite );
+
+    /// accessor to the sorted surfels.
+    const SurfelStorage & surfels() const;
+    /// accessor to surfel adjacency.
+    const Adjacency & surfelAdjacency() const;
+    /// @return a model of concepts::CSurfelPredicate for the surfels.
+    SurfelPredicate surfelPredicate() const;
+
+    /**
+       @param s any surfel of the space.
+       @return the index of @a s in 'surfels()', or INVALID_INDEX if
+       it does not belong to this digital surface. NB: O(log n).
+    */
+    Index index( const Surfel & s ) const;
+
+    /**
+       @param i the index of a surfel.
+       @return the surfel of index @a i.
+    */
+    const Surfel & surfel( Index i ) const;
+
+    /**
+       @param i the index of a surfel.
+       @param d any direction different from the orthogonal direction
+       of the surfel.
+       @param pos when 'true' look in positive direction along
+       [d] axis, 'false' look in negative direction.
+
+       @return the index of the surfel adjacent to the surfel of index
+       @a i in direction @a d along orientation @a pos, or
+       INVALID_INDEX if there is none. NB: O(1), once the adjacent
+       surfels are computed.
+    */
+    Index adjacentIndex( Index i, Dimension d, bool pos ) const;
+
+    /**
+       Computes the adjacent surfels of each surfel, if not already
+       done. This is done automatically on first use, and may be
+       called beforehand to control when the cost is paid. It is
+       safe to call it concurrently.
+    */
+    void computeAdjacentSurfels() const;
+
+    /// @return 'true' if the adjacent surfels are computed.
+    bool hasAdjacentSurfels() const;
+
+    // --------- CDigitalSurfaceContainer realization -------------------------
+  public:
+
+    /// @return the cellular space in which lives the surface.
+    const KSpace & space() const;
+    /**
+       @param s any surfel of the space.
+       @return 'true' if @a s belongs to this digital surface.
+       NB: O(log n).
+    */
+    bool isInside( const Surfel & s ) const;
+
+    /// @return an iterator pointing on the first surfel of the digital surface
+    /// (increasing order).
+    SurfelConstIterator begin() const;
+
+    /// @return an iterator after the last surfel of the digital surface
+    /// (increasing order).
+    SurfelConstIterator end() const;
+
+    /// @return the number of surfels of this digital surface. NB:
+    /// O(1)
+    Size nbSurfels() const;
+
+    /// @return 'true' is the surface has no surfels, 'false'
+    /// otherwise. NB: O(1) operation.
+    bool empty() const;
+
+    /**
+       @param s any surfel of the space.
+       @pre 'isInside( s )'
+       @return a dyn. alloc. pointer on a tracker positionned at @a s.
+    */
+    DigitalSurfaceTracker* newTracker( const Surfel & s ) const;
+
+     /**
+        @return the connectedness of this surface. Either CONNECTED,
+        DISCONNECTED, or UNKNOWN.
+       */
+    Connectedness connectedness() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// a reference to the cellular space.
+    const KSpace & myKSpace;
+    /// the surfel adjacency used to determine neighbors.
+    Adjacency mySurfelAdjacency;
+    /// the surfels, sorted in increasing order.
+    SurfelStorage mySurfels;
+    /// the NB_ADJACENT indices of the adjacent surfels of each surfel,
+    /// or INVALID_INDEX (empty until computed).
+    mutable std::vector<Index> myAdjacentIndices;
+    /// the NB_ADJACENT move codes (0-3) to the adjacent surfels of
+    /// each surfel (empty until computed).
+    mutable std::vector<DGtal::uint8_t> myMoveCodes;
+    /// 'true' once the adjacent surfels are computed.
+    mutable std::atomic<bool> myHasAdjacentSurfels;
+    /// protects the computation of the adjacent surfels.
+    mutable std::mutex myAdjacencyMutex;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    SortedSetOfSurfels & operator= ( const SortedSetOfSurfels & other );
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+       @param i the index of a surfel.
+       @param d any direction different from the orthogonal direction
+       of the surfel.
+       @param pos the orientation along [d].
+       @return the position of the adjacent surfel of the surfel of
+       index @a i in myAdjacentIndices and myMoveCodes.
+    */
+    std::size_t slot( Index i, Dimension d, bool pos ) const;
+
+    /**
+       Sorts the surfels and removes duplicates.
+    */
+    void init();
+
+  }; // end of class SortedSetOfSurfels
+
+
+  /**
+     Overloads 'operator<<' for displaying objects of class 'SortedSetOfSurfels'.
+     @param out the output stream where the object is written.
+     @param object the object of class 'SortedSetOfSurfels' to write.
+     @return the output stream after the writing.
+
+     @tparam TKSpace a model of CCellularGridSpaceND: the type chosen
+     for the cellular grid space.
+   */
+  template <typename TKSpace>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const SortedSetOfSurfels<TKSpace> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/SortedSetOfSurfels.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined SortedSetOfSurfels_h
+
+#undef SortedSetOfSurfels_RECURSES
+#endif // else defined(SortedSetOfSurfels_RECURSES)
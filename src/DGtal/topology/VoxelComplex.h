@@ -263,6 +263,16 @@ class VoxelComplex : public CubicalComplex<TKSpace, TCellContainer> {
     void insertVoxelPoint(const Point &dig_point, const bool &close_it = true,
                           const Data &data = Data());
 
+    /**
+     * Erase cell (voxel) from the khalimsky space.
+     * This is the reverse of @ref insertVoxelCell: the faces of the voxel
+     * that are not faces of another voxel of the complex are erased too.
+     *
+     * @param kcell input voxel
+     * @param clean_it if true, erase the faces that are no longer shared.
+     */
+    void eraseVoxelCell(const Cell &kcell, const bool &clean_it = true);
+
     /**
      * Dump the voxels (kcell with dimension 3) into a input container.
      *
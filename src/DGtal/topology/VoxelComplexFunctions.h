@@ -43,6 +43,7 @@
 // Inclusions
 #include <iostream>
 #include "DGtal/base/Common.h"
+#include "DGtal/base/WorkStealingScheduler.h"
 #include "DGtal/topology/VoxelComplex.h"
 //////////////////////////////////////////////////////////////////////////////
 namespace DGtal
@@ -81,6 +82,51 @@ namespace DGtal
        uint32_t persistence,
        bool verbose = false
     );
+
+    /**
+     * Parallel thinning of a voxel complex (26/6 topology) by subfields.
+     *
+     * The voxels are split into 2^3 subfields by the parity of their
+     * coordinates. Two voxels of the same subfield are not 26-adjacent,
+     * hence the simplicity of one does not depend on the others: all the
+     * simple voxels of a subfield are detected concurrently (using the
+     * simplicity table of @a vc if loaded, see VoxelComplex::isSimple)
+     * and removed together without changing the topology. Each generation
+     * runs over the 8 subfields, until no voxel is removed.
+     *
+     * At the start of each generation, the border voxels (having at least
+     * one missing 6-neighbor) that satisfy @a Skel are added to a
+     * constraint set, and never removed. Interior voxels are not simple,
+     * hence @a Skel is evaluated when they reach the border.
+     *
+     * Both the simplicity and the @a Skel tests run on the threads of
+     * WorkStealingScheduler, hence @a Skel must be safe to call
+     * concurrently on a constant complex (it is the case of
+     * skelUltimate, skelEnd, skelSimple, oneIsthmus, twoIsthmus and
+     * skelIsthmus).
+     *
+     * @note Unlike asymetricThinningScheme, no clique is selected: the
+     * result depends on the order of the subfields, not on a Select
+     * function.
+     *
+     * @tparam TComplex VoxelComplex (3D).
+     * @param vc input voxel complex.
+     * @param Skel predicate of the voxels to preserve.
+     * @param verbose print the number of voxels at each generation.
+     *
+     * @return the thinned voxel complex.
+     */
+    template < typename TComplex >
+    TComplex
+    subfieldThinningScheme(
+       TComplex & vc ,
+       std::function<
+       bool(
+         const TComplex & ,
+         const typename TComplex::Cell & )
+       > Skel,
+       bool verbose = false
+    );
 //////////////////////////////////////////////////////////////////////////////
 // Select Functions
     /**
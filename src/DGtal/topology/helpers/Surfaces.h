@@ -776,7 +776,108 @@ namespace DGtal
                          const PointPredicate & pp,
                          const Point & aLowerBound, 
                          const Point & aUpperBound  );
-    
+
+    /**
+       Parallel version of sMakeBoundary, which returns the same
+       signed surfels as a sorted vector.
+
+       The box [aLowerBound,aUpperBound] is cut into slabs along the
+       last axis, which are scanned by the threads of
+       WorkStealingScheduler: the predicate is evaluated once per
+       point, layer by layer, and the bels found at the transitions
+       between points in and out of the shape are written into a
+       buffer per thread. The buffers are then merged and sorted.
+
+       @tparam PointPredicate a model of concepts::CPointPredicate
+       describing the inside of a digital shape, which may be called
+       concurrently by several threads (e.g. an image).
+
+       @param aBoundary (modified) the signed surfels, sorted in
+       increasing order.
+
+       @param aKSpace any space.
+       @param pp an instance of a model of concepts::CPointPredicate.
+
+       @param aLowerBound and @param aUpperBound points giving the
+       bounds of the extracted boundary.
+    */
+    template <typename PointPredicate >
+    static
+    void sMakeBoundaryParallel( std::vector<SCell> & aBoundary,
+                                const KSpace & aKSpace,
+                                const PointPredicate & pp,
+                                const Point & aLowerBound,
+                                const Point & aUpperBound  );
+
+    /**
+       Extracts in parallel all the boundary components of a digital
+       shape, i.e. the connected components of the surfels of
+       sMakeBoundaryParallel for the given surfel adjacency.
+
+       The adjacent surfels of each bel are computed in parallel as in
+       trackBoundary, and the components are labelled by a concurrent
+       union-find. Each component is sorted and the components are
+       given in the order of their smallest surfel, which is thus the
+       first surfel of the component not yet visited when iterating
+       over the sorted boundary.
+
+       @tparam PointPredicate a model of concepts::CPointPredicate
+       describing the inside of a digital shape, which may be called
+       concurrently by several threads.
+
+       @param aComponents (modified) the sorted surfels of each component.
+
+       @param aKSpace any space.
+       @param aSurfelAdj the surfel adjacency chosen for the tracking.
+       @param pp an instance of a model of concepts::CPointPredicate.
+
+       @param aLowerBound and @param aUpperBound points giving the
+       bounds of the extracted boundary.
+    */
+    template <typename PointPredicate >
+    static
+    void sMakeBoundaryComponents( std::vector< std::vector<SCell> > & aComponents,
+                                  const KSpace & aKSpace,
+                                  const SurfelAdjacency<KSpace::dimension> & aSurfelAdj,
+                                  const PointPredicate & pp,
+                                  const Point & aLowerBound,
+                                  const Point & aUpperBound  );
+
+    /**
+       Parallel version of trackBoundary, which extracts the same
+       surfels: all the bels of the space are extracted by
+       sMakeBoundaryParallel and labelled as in
+       sMakeBoundaryComponents, then the component of @a start_surfel
+       is inserted into @a surface. It is also the output of
+       trackClosedBoundary when the shape is included in the space.
+
+       The whole space is scanned, so this function is worth it when
+       the tracked component is a large part of the boundary.
+
+       @tparam SCellSet a model of a set of SCell (e.g., std::set<SCell>).
+
+       @tparam PointPredicate a model of concepts::CPointPredicate
+       describing the inside of a digital shape, which may be called
+       concurrently by several threads.
+
+       @param surface (modified) a set of cells (which are all surfels),
+       the boundary component of [spelset] which touches [start_surfel].
+
+       @param K any space.
+       @param surfel_adj the surfel adjacency chosen for the tracking.
+       @param pp an instance of a model of concepts::CPointPredicate.
+
+       @param start_surfel a signed surfel which should be between an
+       element of [shape] and an element not in [shape].
+    */
+    template <typename SCellSet, typename PointPredicate >
+    static
+    void trackBoundaryParallel( SCellSet & surface,
+                                const KSpace & K,
+                                const SurfelAdjacency<KSpace::dimension> & surfel_adj,
+                                const PointPredicate & pp,
+                                const SCell & start_surfel );
+
 
     
 
@@ -914,6 +1015,26 @@ namespace DGtal
     // ------------------------- Internals ------------------------------------
   private:
 
+    /**
+       Labels in parallel the connected components of a sorted range
+       of bels: each bel is linked to its adjacent bels (computed as in
+       trackBoundary) that belong to the range.
+
+       @param[out] aLabels for each bel, the index of the smallest bel
+       of its component.
+       @param aBels the bels, sorted in increasing order.
+       @param K any space.
+       @param surfel_adj the surfel adjacency.
+       @param pp the point predicate whose boundary contains the bels.
+    */
+    template <typename PointPredicate >
+    static
+    void labelBoundaryComponents( std::vector<std::size_t> & aLabels,
+                                  const std::vector<SCell> & aBels,
+                                  const KSpace & K,
+                                  const SurfelAdjacency<KSpace::dimension> & surfel_adj,
+                                  const PointPredicate & pp );
+
   }; // end of class Surfaces
 
 
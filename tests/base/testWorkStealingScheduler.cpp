@@ -0,0 +1,155 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testWorkStealingScheduler.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/16
+ *
+ * This file is part of the DGtal library
+ */
+
+/**
+ * Description of testWorkStealingScheduler' <p>
+ * Aim: simple tests of module \ref WorkStealingScheduler.h with Catch unit test framework.
+ */
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include "DGtal/base/Common.h"
+#include "DGtal/base/WorkStealingScheduler.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
+#include "DGtal/geometry/volumes/distance/VoronoiMap.h"
+
+#include "DGtalCatch.h"
+
+using namespace DGtal;
+using namespace std;
+
+
+TEST_CASE( "WorkStealingScheduler settings", "[scheduler]" )
+{
+  REQUIRE( WorkStealingScheduler::numberOfThreads()
+           == WorkStealingScheduler::defaultNumberOfThreads() );
+#ifdef WITH_OPENMP
+  REQUIRE( WorkStealingScheduler::defaultNumberOfThreads()
+           == WorkStealingScheduler::hardwareConcurrency() );
+#else
+  REQUIRE( WorkStealingScheduler::defaultNumberOfThreads() == 1 );
+#endif
+  REQUIRE( WorkStealingScheduler::hardwareConcurrency() >= 1 );
+  WorkStealingScheduler::setNumberOfThreads( 3 );
+  REQUIRE( WorkStealingScheduler::numberOfThreads() == 3 );
+  WorkStealingScheduler::setNumberOfThreads( 0 );
+  REQUIRE( WorkStealingScheduler::numberOfThreads()
+           == WorkStealingScheduler::defaultNumberOfThreads() );
+}
+
+TEST_CASE( "WorkStealingScheduler forEach", "[scheduler]" )
+{
+  SECTION( "Each item is processed exactly once, with irregular costs" )
+    {
+      const std::size_t n = 10007;
+      std::vector< std::atomic<int> > counts( n );
+      for ( auto & c : counts ) c = 0;
+      std::atomic<unsigned int> maxThread( 0 );
+
+      WorkStealingScheduler::forEach( n, 7,
+        [&] ( std::size_t first, std::size_t last, unsigned int thread )
+        {
+          unsigned int m = maxThread.load();
+          while ( thread > m && ! maxThread.compare_exchange_weak( m, thread ) ) {}
+          for ( std::size_t i = first; i < last; ++i )
+            {
+              // Unbalanced work: the first items are much more expensive.
+              volatile double acc = 0.0;
+              for ( std::size_t k = 0; k < ( i < 500 ? 2000u : 1u ); ++k )
+                acc = acc + 1.0;
+              counts[ i ]++;
+            }
+        } );
+
+      bool allOnce = true;
+      for ( auto const & c : counts )
+        allOnce = allOnce && c == 1;
+      REQUIRE( allOnce );
+      REQUIRE( maxThread.load() < 7 );
+    }
+
+  SECTION( "Fewer items than threads and empty ranges" )
+    {
+      std::atomic<int> sum( 0 );
+      WorkStealingScheduler::forEach( 3, 8,
+        [&] ( std::size_t first, std::size_t last, unsigned int )
+        {
+          for ( std::size_t i = first; i < last; ++i )
+            sum += static_cast<int>( i ) + 1;
+        } );
+      REQUIRE( sum == 6 );
+
+      bool called = false;
+      WorkStealingScheduler::forEach( 0, 4,
+        [&] ( std::size_t, std::size_t, unsigned int ) { called = true; } );
+      REQUIRE( ! called );
+    }
+
+  SECTION( "Exceptions are forwarded to the caller" )
+    {
+      REQUIRE_THROWS_AS( WorkStealingScheduler::forEach( 1000, 4,
+        [&] ( std::size_t first, std::size_t last, unsigned int )
+        {
+          for ( std::size_t i = first; i < last; ++i )
+            if ( i == 555 )
+              throw std::runtime_error( "error" );
+        } ), std::runtime_error );
+    }
+}
+
+TEST_CASE( "VoronoiMap does not depend on the number of threads", "[scheduler][voronoi]" )
+{
+  typedef ExactPredicateLpSeparableMetric<Z3i::Space, 2> L2Metric;
+  typedef ExactPredicateLpSeparableMetric<Z3i::Space, 3> L3Metric;
+  Z3i::Domain domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 20, 17, 23 ) );
+  Z3i::DigitalSet set( domain );
+  for ( auto const & pt : domain )
+    if ( ( pt[0] * 7 + pt[1] * 13 + pt[2] * 31 ) % 97 != 0 )
+      set.insertNew( pt );
+
+  L2Metric l2;
+  L3Metric l3;
+  VoronoiMap<Z3i::Space, Z3i::DigitalSet, L2Metric>::PeriodicitySpec periodicity = { { true, false, false } };
+
+  WorkStealingScheduler::setNumberOfThreads( 1 );
+  VoronoiMap<Z3i::Space, Z3i::DigitalSet, L2Metric> voro2( domain, set, l2, periodicity );
+  VoronoiMap<Z3i::Space, Z3i::DigitalSet, L3Metric> voro3( domain, set, l3 );
+  WorkStealingScheduler::setNumberOfThreads( 4 );
+  VoronoiMap<Z3i::Space, Z3i::DigitalSet, L2Metric> voro2par( domain, set, l2, periodicity );
+  VoronoiMap<Z3i::Space, Z3i::DigitalSet, L3Metric> voro3par( domain, set, l3 );
+  WorkStealingScheduler::setNumberOfThreads( 0 );
+
+  unsigned int nbErrors = 0;
+  for ( auto const & pt : domain )
+    {
+      if ( voro2( pt ) != voro2par( pt ) ) ++nbErrors;
+      if ( voro3( pt ) != voro3par( pt ) ) ++nbErrors;
+    }
+  REQUIRE( nbErrors == 0 );
+}
+
+/** @ingroup Tests **/
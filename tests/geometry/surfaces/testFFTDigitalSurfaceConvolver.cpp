@@ -0,0 +1,168 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testFFTDigitalSurfaceConvolver.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/16
+ *
+ * This file is part of the DGtal library
+ */
+
+/**
+ * Description of testFFTDigitalSurfaceConvolver' <p>
+ * Aim: simple tests of \ref FFTDigitalSurfaceConvolver.h, against
+ * \ref PrefixSumConvolver.h, with Catch unit test framework.
+ */
+#include <vector>
+
+#include "DGtal/base/Common.h"
+#include "DGtal/base/WorkStealingScheduler.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/helpers/Shortcuts.h"
+#include "DGtal/helpers/ShortcutsGeometry.h"
+#include "DGtal/shapes/implicit/ImplicitBall.h"
+#include "DGtal/shapes/implicit/ImplicitRoundedHyperCube.h"
+#include "DGtal/shapes/GaussDigitizer.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+#include "DGtal/topology/LightImplicitDigitalSurface.h"
+#include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/geometry/surfaces/PrefixSumConvolver.h"
+#include "DGtal/geometry/surfaces/FFTDigitalSurfaceConvolver.h"
+
+#include "DGtalCatch.h"
+
+using namespace DGtal;
+using namespace std;
+
+typedef ImplicitBall< Z3i::Space >                         Ball;
+typedef GaussDigitizer< Z3i::Space, Ball >                 DigitalBall;
+typedef ImplicitRoundedHyperCube< Z3i::Space >             Cube;
+typedef GaussDigitizer< Z3i::Space, Cube >                 DigitalCube;
+typedef LightImplicitDigitalSurface< Z3i::KSpace, DigitalCube > SurfaceContainer;
+typedef DigitalSurface< SurfaceContainer >                 Surface;
+typedef Z3i::KSpace::Surfel                                Surfel;
+typedef FFTDigitalSurfaceConvolver< Z3i::KSpace, DigitalCube > Convolver;
+typedef Shortcuts< Z3i::KSpace >                           SH3;
+typedef ShortcutsGeometry< Z3i::KSpace >                   SHG3;
+
+TEST_CASE( "FFTDigitalSurfaceConvolver on the boundary of a rounded cube", "[fft][estimator]" )
+{
+  const double h = 0.5;
+  Cube cube( Z3i::RealPoint( 0.0, 0.0, 0.0 ), 6.0, 3.0 );
+  DigitalCube dcube;
+  dcube.attach( cube );
+  dcube.init( Z3i::RealPoint( -8.0, -8.0, -8.0 ), Z3i::RealPoint( 8.0, 8.0, 8.0 ), h );
+  Z3i::KSpace K;
+  REQUIRE( K.init( dcube.getLowerBound(), dcube.getUpperBound(), true ) );
+  Surfel bel = Surfaces< Z3i::KSpace >::findABel( K, dcube, 100000 );
+  Surface surface( new SurfaceContainer( K, dcube, SurfelAdjacency< 3 >( true ), bel ) );
+  const std::vector< Surfel > surfels( surface.begin(), surface.end() );
+  REQUIRE( surfels.size() > 1000 );
+
+  // Kernels of radii 2 and 3.5 (in the grid of step h).
+  std::vector< double > radii = { 2.0, 3.5 };
+  std::vector< Ball > balls;
+  std::vector< DigitalBall > kernels( radii.size() );
+  for ( auto r : radii )
+    balls.push_back( Ball( Z3i::RealPoint( 0.0, 0.0, 0.0 ), r ) );
+  for ( std::size_t i = 0; i < radii.size(); ++i )
+    {
+      kernels[ i ].attach( balls[ i ] );
+      kernels[ i ].init( Z3i::RealPoint( -radii[ i ], -radii[ i ], -radii[ i ] ),
+                         Z3i::RealPoint( radii[ i ], radii[ i ], radii[ i ] ), 1.0 );
+    }
+  WorkStealingScheduler::setNumberOfThreads( 4 );
+
+  SECTION( "Volumes are those of PrefixSumConvolver, for any block size" )
+    {
+      for ( auto blockSize : { 4, 16, 64 } )
+        {
+          Convolver convolver( K, dcube, false, blockSize );
+          for ( auto const & kernel : kernels )
+            convolver.addKernel( kernel );
+          REQUIRE( convolver.isValid() );
+          REQUIRE( convolver.nbKernels() == radii.size() );
+          std::vector< std::vector< double > > volumes;
+          convolver.volumes( surfels.begin(), surfels.end(), volumes );
+          REQUIRE( volumes.size() == radii.size() );
+          for ( std::size_t k = 0; k < kernels.size(); ++k )
+            {
+              PrefixSumConvolver< Z3i::KSpace, DigitalCube > prefix( K, dcube, false );
+              prefix.init( kernels[ k ] );
+              REQUIRE( volumes[ k ].size() == surfels.size() );
+              std::size_t nbOk = 0;
+              for ( std::size_t i = 0; i < surfels.size(); ++i )
+                if ( volumes[ k ][ i ] == prefix.eval( surfels.begin() + i ) ) ++nbOk;
+              REQUIRE( nbOk == surfels.size() );
+            }
+        }
+    }
+
+  SECTION( "Covariance matrices are those of PrefixSumConvolver" )
+    {
+      Convolver convolver( K, dcube, true, 16 );
+      for ( auto const & kernel : kernels )
+        convolver.addKernel( kernel );
+      REQUIRE( convolver.hasMoments() );
+      std::vector< std::vector< Convolver::CovarianceMatrix > > matrices;
+      convolver.covarianceMatrices( surfels.begin(), surfels.end(), matrices );
+      for ( std::size_t k = 0; k < kernels.size(); ++k )
+        {
+          PrefixSumConvolver< Z3i::KSpace, DigitalCube > prefix( K, dcube, true );
+          prefix.init( kernels[ k ] );
+          std::size_t nbOk = 0;
+          for ( std::size_t i = 0; i < surfels.size(); ++i )
+            if ( matrices[ k ][ i ] == prefix.evalCovarianceMatrix( surfels.begin() + i ) )
+              ++nbOk;
+          REQUIRE( nbOk == surfels.size() );
+        }
+    }
+  WorkStealingScheduler::setNumberOfThreads( 0 );
+}
+
+TEST_CASE( "Multi-radius integral invariant shortcuts", "[fft][shortcuts]" )
+{
+  auto params = SH3::defaultParameters() | SHG3::defaultParameters()
+    | SHG3::parametersGeometryEstimation();
+  params( "polynomial", "goursat" )( "gridstep", 1.0 )( "verbose", 0 );
+  auto implicit_shape  = SH3::makeImplicitShape3D( params );
+  auto digitized_shape = SH3::makeDigitizedImplicitShape3D( implicit_shape, params );
+  auto binary_image    = SH3::makeBinaryImage( digitized_shape, params );
+  auto K               = SH3::getKSpace( params );
+  auto surface         = SH3::makeLightDigitalSurface( binary_image, K, params );
+  auto surfels         = SH3::getSurfelRange( surface, params );
+  const SHG3::Scalars radii = { 2.0, 3.0 };
+  auto H = SHG3::getIIMeanCurvaturesAtScales( binary_image, surfels, radii, params );
+  auto T = SHG3::getIIPrincipalCurvaturesAndDirectionsAtScales( binary_image, surfels, radii, params );
+  REQUIRE( H.size() == radii.size() );
+  REQUIRE( T.size() == radii.size() );
+  params( "ii-prefix-sums", 1 );
+  for ( std::size_t i = 0; i < radii.size(); ++i )
+    {
+      params( "r-radius", radii[ i ] );
+      auto Hi = SHG3::getIIMeanCurvatures( binary_image, surfels, params );
+      auto Ti = SHG3::getIIPrincipalCurvaturesAndDirections( binary_image, surfels, params );
+      REQUIRE( H[ i ] == Hi );
+      REQUIRE( T[ i ].size() == Ti.size() );
+      for ( std::size_t j = 0; j < Ti.size(); ++j )
+        {
+          REQUIRE( std::get<0>( T[ i ][ j ] ) == Approx( std::get<0>( Ti[ j ] ) ) );
+          REQUIRE( std::get<1>( T[ i ][ j ] ) == Approx( std::get<1>( Ti[ j ] ) ) );
+        }
+    }
+}
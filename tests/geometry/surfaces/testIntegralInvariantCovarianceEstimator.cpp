@@ -33,6 +33,7 @@
 #include <tuple>
 
 #include "DGtal/base/Common.h"
+#include "DGtal/base/WorkStealingScheduler.h"
 
  /// Shape
 #include "DGtal/shapes/implicit/ImplicitBall.h"
@@ -275,13 +276,93 @@ bool testPrincipalCurvatures3d( double h )
   return true;
 }
 
+bool testPrefixSums3d( double h )
+{
+  typedef ImplicitBall<Z3i::Space> ImplicitShape;
+  typedef GaussDigitizer<Z3i::Space, ImplicitShape> DigitalShape;
+  typedef LightImplicitDigitalSurface<Z3i::KSpace,DigitalShape> Boundary;
+  typedef DigitalSurface< Boundary > MyDigitalSurface;
+
+  typedef functors::IIPrincipalCurvatures3DFunctor<Z3i::Space> MyIICurvatureFunctor;
+  typedef IntegralInvariantCovarianceEstimator< Z3i::KSpace, DigitalShape, MyIICurvatureFunctor > MyIICurvatureEstimator;
+  typedef MyIICurvatureFunctor::Value Value;
+
+  double re = 3.0;
+  double radius = 5.0;
+
+  trace.beginBlock( "Comparing masks and prefix sums ..." );
+
+  ImplicitShape ishape( Z3i::RealPoint( 0, 0, 0 ), radius );
+  DigitalShape dshape;
+  dshape.attach( ishape );
+  dshape.init( Z3i::RealPoint( -6.0, -6.0, -6.0 ), Z3i::RealPoint( 6.0, 6.0, 6.0 ), h );
+
+  Z3i::KSpace K;
+  if ( !K.init( dshape.getLowerBound(), dshape.getUpperBound(), true ) )
+  {
+    trace.error() << "Problem with Khalimsky space" << std::endl;
+    trace.endBlock();
+    return false;
+  }
+
+  Z3i::KSpace::Surfel bel = Surfaces<Z3i::KSpace>::findABel( K, dshape, 10000 );
+  Boundary boundary( K, dshape, SurfelAdjacency<Z3i::KSpace::dimension>( true ), bel );
+  MyDigitalSurface surf ( boundary );
+  std::vector< Z3i::KSpace::Surfel > surfels( surf.begin(), surf.end() );
+
+  MyIICurvatureFunctor curvatureFunctor;
+  curvatureFunctor.init( h, re );
+
+  MyIICurvatureEstimator masks( curvatureFunctor );
+  masks.attach( K, dshape );
+  masks.setParams( re/h );
+  masks.init( h, surfels.begin(), surfels.end() );
+
+  MyIICurvatureEstimator table( curvatureFunctor );
+  table.attach( K, dshape );
+  table.setParams( re/h, true );
+  table.init( h, surfels.begin(), surfels.end() );
+
+  std::vector< Value > results_masks, results_table;
+  masks.eval( surfels.begin(), surfels.end(), std::back_inserter( results_masks ) );
+  table.eval( surfels.begin(), surfels.end(), std::back_inserter( results_table ) );
+
+  // The moments are summed in a different order: equal up to rounding.
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  double max_error = 0.0;
+  for ( std::size_t i = 0; i < results_masks.size(); ++i )
+    {
+      max_error = std::max( max_error, std::abs( results_masks[ i ].first - results_table[ i ].first ) );
+      max_error = std::max( max_error, std::abs( results_masks[ i ].second - results_table[ i ].second ) );
+    }
+  ++nb; nbok += ( results_masks.size() == results_table.size() ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "as many results as surfels: " << surfels.size() << std::endl;
+  ++nb; nbok += ( max_error < 1e-6 ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same principal curvatures, max error = " << max_error << std::endl;
+
+  // The functor has mutable members: each thread must use its own copy.
+  std::vector< Value > results_threads;
+  WorkStealingScheduler::setNumberOfThreads( 4 );
+  table.eval( surfels.begin(), surfels.end(), std::back_inserter( results_threads ) );
+  WorkStealingScheduler::setNumberOfThreads( 0 );
+  ++nb; nbok += ( results_threads == results_table ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same prefix sums results with 1 or 4 threads" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
 int main( int /*argc*/, char** /*argv*/ )
 {
   trace.beginBlock ( "Testing class IntegralInvariantCovarianceEstimator and 3d functors" );
-    bool res = testGaussianCurvature3d( 0.6, 0.007 ) && testPrincipalCurvatures3d( 0.6 );
+    bool res = testGaussianCurvature3d( 0.6, 0.007 ) && testPrincipalCurvatures3d( 0.6 )
+      && testPrefixSums3d( 0.5 );
     trace.emphase() << ( res ? "Passed." : "Error." ) << std::endl;
   trace.endBlock();
   return res ? 0 : 1;
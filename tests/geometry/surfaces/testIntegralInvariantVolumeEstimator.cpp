@@ -261,13 +261,78 @@ bool testMeanCurvature3d( double h, double delta )
   return true;
 }
 
+bool testPrefixSums3d( double h )
+{
+  typedef ImplicitBall<Z3i::Space> ImplicitShape;
+  typedef GaussDigitizer<Z3i::Space, ImplicitShape> DigitalShape;
+  typedef LightImplicitDigitalSurface<Z3i::KSpace,DigitalShape> Boundary;
+  typedef DigitalSurface< Boundary > MyDigitalSurface;
+
+  typedef functors::IIMeanCurvature3DFunctor<Z3i::Space> MyIICurvatureFunctor;
+  typedef IntegralInvariantVolumeEstimator< Z3i::KSpace, DigitalShape, MyIICurvatureFunctor > MyIICurvatureEstimator;
+  typedef MyIICurvatureFunctor::Value Value;
+
+  double re = 3;
+  double radius = 5;
+
+  trace.beginBlock( "Comparing masks and prefix sums ..." );
+
+  ImplicitShape ishape( Z3i::RealPoint( 0, 0, 0 ), radius );
+  DigitalShape dshape;
+  dshape.attach( ishape );
+  dshape.init( Z3i::RealPoint( -6.0, -6.0, -6.0 ), Z3i::RealPoint( 6.0, 6.0, 6.0 ), h );
+
+  Z3i::KSpace K;
+  if ( !K.init( dshape.getLowerBound(), dshape.getUpperBound(), true ) )
+  {
+    trace.error() << "Problem with Khalimsky space" << std::endl;
+    trace.endBlock();
+    return false;
+  }
+
+  // The kernel is cut by the domain near its border.
+  Z3i::KSpace::Surfel bel = Surfaces<Z3i::KSpace>::findABel( K, dshape, 10000 );
+  Boundary boundary( K, dshape, SurfelAdjacency<Z3i::KSpace::dimension>( true ), bel );
+  MyDigitalSurface surf ( boundary );
+  std::vector< Z3i::KSpace::Surfel > surfels( surf.begin(), surf.end() );
+
+  MyIICurvatureFunctor curvatureFunctor;
+  curvatureFunctor.init( h, re );
+
+  MyIICurvatureEstimator masks( curvatureFunctor );
+  masks.attach( K, dshape );
+  masks.setParams( re/h );
+  masks.init( h, surfels.begin(), surfels.end() );
+
+  MyIICurvatureEstimator table( curvatureFunctor );
+  table.attach( K, dshape );
+  table.setParams( re/h, true );
+  table.init( h, surfels.begin(), surfels.end() );
+
+  std::vector< Value > results_masks, results_table;
+  masks.eval( surfels.begin(), surfels.end(), std::back_inserter( results_masks ) );
+  table.eval( surfels.begin(), surfels.end(), std::back_inserter( results_table ) );
+
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  ++nb; nbok += ( results_masks == results_table ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same mean curvatures on " << surfels.size() << " surfels" << std::endl;
+  ++nb; nbok += ( table.eval( surfels.begin() ) == results_masks[ 0 ] ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same mean curvature on one surfel" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
 int main( int /*argc*/, char** /*argv*/ )
 {
   trace.beginBlock ( "Testing class IntegralInvariantVolumeEstimator and 2d/3d mean curvature functors" );
-    bool res = testCurvature2d( 0.05, 0.002 ) && testMeanCurvature3d( 0.6, 0.008 );
+    bool res = testCurvature2d( 0.05, 0.002 ) && testMeanCurvature3d( 0.6, 0.008 )
+      && testPrefixSums3d( 0.5 );
     trace.emphase() << ( res ? "Passed." : "Error." ) << std::endl;
   trace.endBlock();
   return res ? 0 : 1;
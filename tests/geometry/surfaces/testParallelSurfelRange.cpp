@@ -0,0 +1,193 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testParallelSurfelRange.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/16
+ *
+ * This file is part of the DGtal library
+ */
+
+/**
+ * Description of testParallelSurfelRange' <p>
+ * Aim: simple tests of \ref ParallelSurfelRange.h and of the parallel
+ * evaluation of surfel ranges by the estimators, with Catch unit test
+ * framework.
+ */
+#include <algorithm>
+#include <vector>
+
+#include "DGtal/base/Common.h"
+#include "DGtal/base/WorkStealingScheduler.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/shapes/implicit/ImplicitBall.h"
+#include "DGtal/shapes/GaussDigitizer.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+#include "DGtal/topology/LightImplicitDigitalSurface.h"
+#include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/topology/CanonicSCellEmbedder.h"
+#include "DGtal/geometry/volumes/distance/LpMetric.h"
+#include "DGtal/geometry/surfaces/estimation/ParallelSurfelRange.h"
+#include "DGtal/geometry/surfaces/estimation/IIGeometricFunctors.h"
+#include "DGtal/geometry/surfaces/estimation/IntegralInvariantVolumeEstimator.h"
+#include "DGtal/geometry/surfaces/estimation/IntegralInvariantCovarianceEstimator.h"
+#include "DGtal/geometry/surfaces/estimation/LocalEstimatorFromSurfelFunctorAdapter.h"
+#include "DGtal/geometry/surfaces/estimation/estimationFunctors/ElementaryConvolutionNormalVectorEstimator.h"
+
+#include "DGtalCatch.h"
+
+using namespace DGtal;
+using namespace std;
+
+typedef ImplicitBall< Z3i::Space >                         Ball;
+typedef GaussDigitizer< Z3i::Space, Ball >                 DigitalBall;
+typedef LightImplicitDigitalSurface< Z3i::KSpace, DigitalBall > SurfaceContainer;
+typedef DigitalSurface< SurfaceContainer >                 Surface;
+typedef Z3i::KSpace::Surfel                                Surfel;
+
+TEST_CASE( "ParallelSurfelRange on the boundary of a ball", "[parallel][estimator]" )
+{
+  const double h = 0.5;
+  Ball ball( Z3i::RealPoint( 0.0, 0.0, 0.0 ), 5.0 );
+  DigitalBall dball;
+  dball.attach( ball );
+  dball.init( Z3i::RealPoint( -7.0, -7.0, -7.0 ), Z3i::RealPoint( 7.0, 7.0, 7.0 ), h );
+  Z3i::KSpace K;
+  REQUIRE( K.init( dball.getLowerBound(), dball.getUpperBound(), true ) );
+  Surfel bel = Surfaces< Z3i::KSpace >::findABel( K, dball, 10000 );
+  Surface surface( new SurfaceContainer( K, dball, SurfelAdjacency< 3 >( true ), bel ) );
+  const std::vector< Surfel > surfels( surface.begin(), surface.end() );
+  REQUIRE( surfels.size() > 1000 );
+  WorkStealingScheduler::setNumberOfThreads( 4 );
+
+  SECTION( "The surfels are a permutation of the range, and the order is kept" )
+    {
+      ParallelSurfelRange< Z3i::KSpace > range( K, surfels.begin(), surfels.end() );
+      REQUIRE( range.isValid() );
+      REQUIRE( range.size() == surfels.size() );
+      std::vector< std::size_t > indices = range.indices();
+      std::sort( indices.begin(), indices.end() );
+      for ( std::size_t i = 0; i < indices.size(); ++i )
+        REQUIRE( indices[ i ] == i );
+      for ( std::size_t i = 0; i < range.size(); ++i )
+        REQUIRE( range.surfels()[ i ] == surfels[ range.indices()[ i ] ] );
+
+      std::vector< Surfel > output;
+      range.eval< Surfel >
+        ( [] ( ParallelSurfelRange< Z3i::KSpace >::ConstIterator itb,
+               ParallelSurfelRange< Z3i::KSpace >::ConstIterator ite,
+               std::vector< Surfel >::iterator out, unsigned int )
+          { std::copy( itb, ite, out ); },
+          std::back_inserter( output ) );
+      REQUIRE( output == surfels );
+    }
+
+  SECTION( "Consecutive surfels in Morton order are mostly close" )
+    {
+      ParallelSurfelRange< Z3i::KSpace > range( K, surfels.begin(), surfels.end() );
+      std::size_t nbClose = 0;
+      for ( std::size_t i = 1; i < range.size(); ++i )
+        {
+          const Z3i::Point d = K.sKCoords( range.surfels()[ i ] )
+            - K.sKCoords( range.surfels()[ i - 1 ] );
+          if ( d.norm( Z3i::Point::L_infty ) <= 2 ) ++nbClose;
+        }
+      REQUIRE( 2 * nbClose > range.size() );
+    }
+
+  SECTION( "Integral invariant estimators give the same results with 1 or 4 threads" )
+    {
+      typedef functors::IIMeanCurvature3DFunctor< Z3i::Space > MeanFunctor;
+      typedef IntegralInvariantVolumeEstimator< Z3i::KSpace, DigitalBall, MeanFunctor > MeanEstimator;
+      typedef functors::IIPrincipalCurvatures3DFunctor< Z3i::Space > CurvFunctor;
+      typedef IntegralInvariantCovarianceEstimator< Z3i::KSpace, DigitalBall, CurvFunctor > CurvEstimator;
+      const double re = 2.0;
+
+      MeanFunctor mean_functor;
+      mean_functor.init( h, re );
+      MeanEstimator mean_estimator( mean_functor );
+      mean_estimator.attach( K, dball );
+      mean_estimator.setParams( re / h );
+      mean_estimator.init( h, surfels.begin(), surfels.end() );
+      CurvFunctor curv_functor;
+      curv_functor.init( h, re );
+      CurvEstimator curv_estimator( curv_functor );
+      curv_estimator.attach( K, dball );
+      curv_estimator.setParams( re / h );
+      curv_estimator.init( h, surfels.begin(), surfels.end() );
+
+      std::vector< MeanFunctor::Quantity > mean1, mean4;
+      std::vector< CurvFunctor::Quantity > curv1, curv4;
+      WorkStealingScheduler::setNumberOfThreads( 1 );
+      mean_estimator.eval( surfels.begin(), surfels.end(), std::back_inserter( mean1 ) );
+      curv_estimator.eval( surfels.begin(), surfels.end(), std::back_inserter( curv1 ) );
+      WorkStealingScheduler::setNumberOfThreads( 4 );
+      mean_estimator.eval( surfels.begin(), surfels.end(), std::back_inserter( mean4 ) );
+      curv_estimator.eval( surfels.begin(), surfels.end(), std::back_inserter( curv4 ) );
+      REQUIRE( mean1.size() == surfels.size() );
+      REQUIRE( mean1 == mean4 );
+      REQUIRE( curv1.size() == curv4.size() );
+      double max_error = 0.0;
+      for ( std::size_t i = 0; i < curv1.size(); ++i )
+        max_error = std::max( { max_error,
+                std::abs( curv1[ i ].first - curv4[ i ].first ),
+                std::abs( curv1[ i ].second - curv4[ i ].second ) } );
+      REQUIRE( max_error < 1e-6 );
+      // Same results as a sequential surfel by surfel evaluation.
+      for ( std::size_t i = 0; i < surfels.size(); i += 97 )
+        REQUIRE( mean_estimator.eval( surfels.begin() + i ) == mean4[ i ] );
+      max_error = 0.0;
+      for ( std::size_t i = 0; i < surfels.size(); ++i )
+        {
+          const CurvFunctor::Quantity k = curv_estimator.eval( surfels.begin() + i );
+          max_error = std::max( { max_error,
+                  std::abs( k.first - curv4[ i ].first ),
+                  std::abs( k.second - curv4[ i ].second ) } );
+        }
+      REQUIRE( max_error < 1e-6 );
+    }
+
+  SECTION( "Estimators from surfel functors give the same results with 1 or 4 threads" )
+    {
+      typedef CanonicSCellEmbedder< Z3i::KSpace > Embedder;
+      typedef functors::ElementaryConvolutionNormalVectorEstimator< Surfel, Embedder > Functor;
+      typedef functors::ConstValue< double > ConvFunctor;
+      typedef LocalEstimatorFromSurfelFunctorAdapter
+        < SurfaceContainer, LpMetric< Z3i::Space >, Functor, ConvFunctor > Estimator;
+
+      LpMetric< Z3i::Space > l2( 2.0 );
+      Embedder embedder( surface.container().space() );
+      Functor functor( embedder, 1.0 );
+      ConvFunctor conv( 1.0 );
+      Estimator estimator;
+      estimator.attach( surface );
+      estimator.setParams( l2, functor, conv, 3.0 );
+      estimator.init( 1.0, surfels.begin(), surfels.end() );
+
+      std::vector< Functor::Quantity > normals1, normals4;
+      WorkStealingScheduler::setNumberOfThreads( 1 );
+      estimator.eval( surfels.begin(), surfels.end(), std::back_inserter( normals1 ) );
+      WorkStealingScheduler::setNumberOfThreads( 4 );
+      estimator.eval( surfels.begin(), surfels.end(), std::back_inserter( normals4 ) );
+      REQUIRE( normals1.size() == surfels.size() );
+      REQUIRE( normals1 == normals4 );
+      for ( std::size_t i = 0; i < surfels.size(); i += 97 )
+        REQUIRE( estimator.eval( surfels.begin() + i ) == normals4[ i ] );
+    }
+  WorkStealingScheduler::setNumberOfThreads( 0 );
+}
@@ -622,6 +622,71 @@ bool testCompareExactInexact(unsigned int size, unsigned int nb)
   return true;
 }
 
+/**
+ * Checks the raw distances computed in the last step against the
+ * distance transformation, with full and compact Voronoi maps.
+ */
+bool testRawDistances()
+{
+  trace.beginBlock("Checking fused raw distances");
+  typedef ExactPredicateLpSeparableMetric<Z3i::Space, 2> L2Metric;
+  typedef functors::NotPointPredicate<Z3i::DigitalSet> NegPredicate;
+  typedef ImageContainerBySTLVector<Z3i::Domain, DGtal::uint32_t> IndexImage;
+  typedef DistanceTransformation<Z3i::Space, NegPredicate, L2Metric> DT;
+  typedef DistanceTransformation<Z3i::Space, NegPredicate, L2Metric, IndexImage> CompactDT;
+
+  Z3i::Domain domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 20, 15, 18 ) );
+  Z3i::DigitalSet set( domain );
+  for ( unsigned int i = 0; i < 30; ++i )
+    set.insert( Z3i::Point( rand() % 21, rand() % 16, rand() % 19 ) );
+  NegPredicate negPred( set );
+  L2Metric l2;
+
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  // The last dimension being periodic or not, the raw distances are
+  // computed from the Voronoi map or slab by slab.
+  const std::vector<DT::PeriodicitySpec> periodicities =
+    { { { true, false, true } }, { { false, false, false } }, { { true, true, false } } };
+  for ( auto const & periodicity : periodicities )
+    {
+      WorkStealingScheduler::setNumberOfThreads( nb % 2 == 0 ? 1 : 4 );
+      DT dt( domain, negPred, l2, periodicity );
+      CompactDT compactDT( domain, negPred, l2, periodicity );
+      ImageContainerBySTLVector<Z3i::Domain, DGtal::uint32_t> squared( domain );
+      ImageContainerBySTLVector<Z3i::Domain, float> squaredFloat( domain );
+      DT::computeRawDistances( domain, negPred, l2, periodicity, squared );
+      CompactDT::computeRawDistances( domain, negPred, l2, periodicity, squaredFloat );
+
+      bool same = true;
+      for ( auto const & pt : domain )
+        {
+          const double d = dt( pt );
+          same = same && compactDT( pt ) == d
+            && compactDT.getVoronoiSite( pt ) == dt.getVoronoiSite( pt )
+            && squared( pt ) == l2.rawDistance( pt, dt.getVoronoiSite( pt ) )
+            && squaredFloat( pt ) == static_cast<float>( squared( pt ) );
+        }
+      nbok += same ? 1 : 0;
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+                   << "raw distances and compact map match the distance transformation" << std::endl;
+    }
+  WorkStealingScheduler::setNumberOfThreads( 0 );
+
+  // Without site, raw distances are the maximal value.
+  Z3i::DigitalSet emptySet( domain );
+  NegPredicate emptyPred( emptySet );
+  ImageContainerBySTLVector<Z3i::Domain, DGtal::uint32_t> squared( domain );
+  DT::computeRawDistances( domain, emptyPred, l2, squared );
+  nbok += squared( Z3i::Point( 3, 4, 5 ) ) == std::numeric_limits<DGtal::uint32_t>::max() ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << "empty site set" << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -643,6 +708,7 @@ int main ( int argc, char** argv ){
     && testCompareExactInexact<Z3i::Space, 2>(50, 50)
     && testCompareExactInexact<Z2i::Space, 4>(50, 50)
     && testCompareExactInexact<Z3i::Space, 4>(50, 50)
+    && testRawDistances()
     ;
   //&& ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
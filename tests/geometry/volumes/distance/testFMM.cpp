@@ -48,6 +48,8 @@
 
 //FMM
 #include "DGtal/geometry/volumes/distance/FMM.h"
+#include "DGtal/geometry/volumes/distance/BucketFMM.h"
+#include "DGtal/geometry/volumes/distance/FastIterativeMethod.h"
 
 //Display
 #include "DGtal/io/colormaps/HueShadeColorMap.h"
@@ -652,6 +654,162 @@ bool testComparison(int size, int area, double dist)
 }
 
 
+/**
+ * Comparison of BucketFMM and FastIterativeMethod with FMM
+ * (l_1 local distance, from one point)
+ *
+ */
+template<Dimension dim>
+bool testBucketAndIterativeL1(int size, double dist)
+{
+
+  static const DGtal::Dimension dimension = dim; 
+
+  //Domain
+  typedef HyperRectDomain< SpaceND<dimension, int> > Domain; 
+  typedef typename Domain::Point Point; 
+  Domain d(Point::diagonal(-size), Point::diagonal(size)); 
+  DomainPredicate<Domain> dp(d);
+
+  typedef ImageContainerBySTLVector<Domain, long> Image;
+  typedef DigitalSetBySTLSet<Domain> Set; 
+  typedef L1LocalDistance<Image, Set> Distance; 
+  const Point seed = Point::diagonal(1); 
+
+  trace.beginBlock ( " Comparison of BucketFMM and FastIterativeMethod with FMM (l_1) " ); 
+
+  Image map( d ); 
+  Set set( d );
+  FMM<Image, Set, DomainPredicate<Domain>, Distance>::initFromPointsRange( &seed, &seed+1, map, set, 0 ); 
+  Distance distance(map, set); 
+  FMM<Image, Set, DomainPredicate<Domain>, Distance> fmm( map, set, dp, d.size()+1, dist, distance ); 
+  fmm.compute(); 
+  trace.info() << fmm << std::endl; 
+
+  Image map2( d ); 
+  Set set2( d );
+  BucketFMM<Image, Set, DomainPredicate<Domain>, Distance>::initFromPointsRange( &seed, &seed+1, map2, set2, 0 ); 
+  Distance distance2(map2, set2); 
+  BucketFMM<Image, Set, DomainPredicate<Domain>, Distance> bfmm( map2, set2, dp, d.size()+1, dist, distance2 ); 
+  bfmm.compute(); 
+  trace.info() << bfmm << std::endl; 
+
+  //narrow buckets: the ring of buckets has to grow
+  Image map4( d ); 
+  Set set4( d );
+  BucketFMM<Image, Set, DomainPredicate<Domain>, Distance>::initFromPointsRange( &seed, &seed+1, map4, set4, 0 ); 
+  Distance distance4(map4, set4); 
+  BucketFMM<Image, Set, DomainPredicate<Domain>, Distance> bfmm4( map4, set4, dp, d.size()+1, dist, distance4, 1.0/64 ); 
+  bfmm4.compute(); 
+  trace.info() << bfmm4 << std::endl; 
+
+  Image map3( d ); 
+  Set set3( d );
+  FastIterativeMethod<Image, Set, DomainPredicate<Domain>, Distance>::initFromPointsRange( &seed, &seed+1, map3, set3, 0 ); 
+  Distance distance3(map3, set3); 
+  FastIterativeMethod<Image, Set, DomainPredicate<Domain>, Distance> fim( map3, set3, dp, dist, distance3 ); 
+  fim.compute(); 
+  trace.info() << fim << std::endl; 
+
+  bool flagIsOk = ( set.size() == set2.size() ) && ( set.size() == set3.size() )
+    && ( set.size() == set4.size() )
+    && bfmm.isValid() && fim.isValid() && bfmm4.isValid()
+    && ( fmm.max() == bfmm.max() ) && ( fmm.max() == fim.max() )
+    && ( fmm.max() == bfmm4.max() ); 
+  for ( typename Set::ConstIterator it = set.begin(); 
+        ( (it != set.end())&&(flagIsOk) ); ++it)
+    {
+      if ( (set2.find(*it) == set2.end()) || (set3.find(*it) == set3.end())
+           || (set4.find(*it) == set4.end()) )
+        flagIsOk = false; 
+      else if ( (map(*it) != map2(*it)) || (map(*it) != map3(*it))
+                || (map(*it) != map4(*it)) )
+        flagIsOk = false; 
+    }
+  trace.info() << "same values: " << flagIsOk << std::endl; 
+  trace.endBlock();
+
+  return flagIsOk; 
+}
+
+/**
+ * Comparison of BucketFMM and FastIterativeMethod with FMM
+ * (l_2 first order local distance, from the boundary of a ball)
+ *
+ */
+bool testBucketAndIterativeFromBels(int size)
+{
+
+  static const DGtal::Dimension dimension = 2; 
+
+  //Domain
+  typedef HyperRectDomain< SpaceND<dimension, int> > Domain; 
+  typedef Domain::Point Point; 
+  Domain d(Point::diagonal(-size), Point::diagonal(size)); 
+
+  //predicate
+  int radius = (size/2);
+  typedef BallPredicate<Point> Predicate; 
+  Predicate predicate( 0, 0, radius ); 
+
+  //Digital circle generation
+  typedef KhalimskySpaceND< dimension, int > KSpace; 
+  KSpace K; K.init( Point::diagonal(-size), Point::diagonal(size), true); 
+  SurfelAdjacency<KSpace::dimension> SAdj( true );
+  KSpace::SCell bel = Surfaces<KSpace>::findABel( K, predicate, 10000 );
+  std::vector<KSpace::SCell> vSCells;
+  Surfaces<KSpace>::track2DBoundary( vSCells, K, SAdj, predicate, bel );
+
+  typedef ImageContainerBySTLVector<Domain, double> Image;
+  typedef DigitalSetBySTLSet<Domain> Set; 
+
+  trace.beginBlock ( " Comparison of BucketFMM and FastIterativeMethod with FMM (l_2) " ); 
+
+  Image map( d ); 
+  Set set( d );
+  FMM<Image, Set, Predicate>::initFromBelsRange( K, vSCells.begin(), vSCells.end(), map, set, 0.5 ); 
+  FMM<Image, Set, Predicate> fmm( map, set, predicate ); 
+  fmm.compute(); 
+  trace.info() << fmm << std::endl; 
+
+  Image map2( d ); 
+  Set set2( d );
+  BucketFMM<Image, Set, Predicate>::initFromBelsRange( K, vSCells.begin(), vSCells.end(), map2, set2, 0.5 ); 
+  BucketFMM<Image, Set, Predicate> bfmm( map2, set2, predicate ); 
+  bfmm.compute(); 
+  trace.info() << bfmm << std::endl; 
+
+  Image map3( d ); 
+  Set set3( d );
+  FastIterativeMethod<Image, Set, Predicate>::initFromBelsRange( K, vSCells.begin(), vSCells.end(), map3, set3, 0.5 ); 
+  FastIterativeMethod<Image, Set, Predicate> fim( map3, set3, predicate ); 
+  WorkStealingScheduler::setNumberOfThreads( 4 ); 
+  fim.compute(); 
+  WorkStealingScheduler::setNumberOfThreads( 0 ); 
+  trace.info() << fim << std::endl; 
+
+  //NB: the initial points outside the ball do not satisfy the predicate
+  bool flagIsOk = ( set.size() == set2.size() ) && ( set.size() == set3.size() ); 
+  double diff2 = 0, diff3 = 0; 
+  for ( Set::ConstIterator it = set.begin(); 
+        ( (it != set.end())&&(flagIsOk) ); ++it)
+    {
+      if ( (set2.find(*it) == set2.end()) || (set3.find(*it) == set3.end()) )
+        flagIsOk = false; 
+      else 
+        {
+          diff2 = std::max( diff2, std::abs( map(*it) - map2(*it) ) ); 
+          diff3 = std::max( diff3, std::abs( map(*it) - map3(*it) ) ); 
+        }
+    }
+  trace.info() << "max diff. with BucketFMM: " << diff2 
+               << ", with FastIterativeMethod: " << diff3 << std::endl; 
+  trace.endBlock();
+
+  //the iterative method is within a few times its tolerance
+  return flagIsOk && ( diff2 < 1e-9 ) && ( diff3 < 10 * fim.tolerance() ); 
+}
+
 
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
@@ -693,6 +851,13 @@ int main ( int argc, char** argv )
     && testComparison<4,1>( size, area, 4*size+1 )
     ;
 
+  //bucket queue and parallel iterative solver
+  res = res
+    && testBucketAndIterativeL1<2>( 30, 40 )
+    && testBucketAndIterativeL1<3>( 10, 1000 )
+    && testBucketAndIterativeFromBels( 50 )
+    ;
+
   //&& ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
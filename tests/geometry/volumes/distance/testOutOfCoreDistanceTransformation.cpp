@@ -0,0 +1,148 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testOutOfCoreDistanceTransformation.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/16
+ *
+ * Functions for testing class OutOfCoreDistanceTransformation.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageFactoryFromImage.h"
+#include "DGtal/images/ImageCachePolicies.h"
+#include "DGtal/images/TiledImage.h"
+#include "DGtal/images/SimpleThresholdForegroundPredicate.h"
+#include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
+#include "DGtal/geometry/volumes/distance/DistanceTransformation.h"
+#include "DGtal/geometry/volumes/distance/OutOfCoreDistanceTransformation.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class OutOfCoreDistanceTransformation.
+///////////////////////////////////////////////////////////////////////////////
+
+typedef ImageContainerBySTLVector<Z3i::Domain, unsigned char> BinaryImage;
+typedef functors::SimpleThresholdForegroundPredicate<BinaryImage> Predicate;
+
+/// Random binary image with a few background points.
+BinaryImage makeImage( const Z3i::Domain & domain )
+{
+  BinaryImage image( domain );
+  srand( 42 );
+  for ( auto const & pt : domain )
+    image.setValue( pt, rand() % 150 == 0 ? 0 : 1 );
+  return image;
+}
+
+TEST_CASE( "Testing OutOfCoreDistanceTransformation" )
+{
+  const Z3i::Domain domain( Z3i::Point( -4, 1, 2 ), Z3i::Point( 20, 17, 23 ) );
+  const BinaryImage image = makeImage( domain );
+  const Predicate predicate( image, 0 );
+
+  typedef ExactPredicateLpSeparableMetric<Z3i::Space, 2> L2Metric;
+  typedef ExactPredicateLpSeparableMetric<Z3i::Space, 3> L3Metric;
+  L2Metric l2;
+  L3Metric l3;
+
+  SECTION( "Slab thickness follows the memory budget" )
+    {
+      OutOfCoreDistanceTransformation<Z3i::Space, Predicate, L2Metric> dt( domain, predicate, l2, 1 );
+      REQUIRE( dt.slabThickness( 0 ) == 1 );
+      REQUIRE( dt.slabThickness( 2 ) == 1 );
+      REQUIRE( dt.slabDimension( 0 ) == 2 );
+      REQUIRE( dt.slabDimension( 2 ) == 1 );
+      dt.setMaxMemory( std::size_t( 1 ) << 30 );
+      REQUIRE( dt.slabThickness( 0 ) == 22 );
+      REQUIRE( dt.slabThickness( 2 ) == 17 );
+    }
+
+  SECTION( "Voronoi map and distances match the in-core computation (l_2)" )
+    {
+      DistanceTransformation<Z3i::Space, Predicate, L2Metric> reference( domain, predicate, l2 );
+
+      // A budget of about three hyperplanes.
+      OutOfCoreDistanceTransformation<Z3i::Space, Predicate, L2Metric>
+        dt( domain, predicate, l2, 3 * 25 * 17 * ( sizeof( Z3i::Point ) + sizeof( int ) ) );
+      REQUIRE( dt.isValid() );
+      REQUIRE( dt.slabThickness( 0 ) == 3 );
+
+      ImageContainerBySTLVector<Z3i::Domain, Z3i::Vector> voronoi( domain );
+      ImageContainerBySTLVector<Z3i::Domain, double> distances( domain );
+      dt.compute( voronoi );
+      dt.compute( distances );
+
+      unsigned int nbErrors = 0;
+      for ( auto const & pt : domain )
+        {
+          if ( voronoi( pt ) != reference.getVoronoiSite( pt ) ) ++nbErrors;
+          if ( distances( pt ) != reference( pt ) ) ++nbErrors;
+        }
+      REQUIRE( nbErrors == 0 );
+    }
+
+  SECTION( "Generic metric (l_3)" )
+    {
+      DistanceTransformation<Z3i::Space, Predicate, L3Metric> reference( domain, predicate, l3 );
+      OutOfCoreDistanceTransformation<Z3i::Space, Predicate, L3Metric> dt( domain, predicate, l3, 1 );
+      ImageContainerBySTLVector<Z3i::Domain, Z3i::Vector> voronoi( domain );
+      dt.compute( voronoi );
+
+      unsigned int nbErrors = 0;
+      for ( auto const & pt : domain )
+        if ( voronoi( pt ) != reference.getVoronoiSite( pt ) ) ++nbErrors;
+      REQUIRE( nbErrors == 0 );
+    }
+
+  SECTION( "Output into a TiledImage" )
+    {
+      typedef ImageContainerBySTLVector<Z3i::Domain, double> DistanceImage;
+      typedef ImageFactoryFromImage<DistanceImage> Factory;
+      typedef ImageCacheReadPolicyFIFO<Factory::OutputImage, Factory> ReadPolicy;
+      typedef ImageCacheWritePolicyWT<Factory::OutputImage, Factory> WritePolicy;
+      typedef TiledImage<DistanceImage, Factory, ReadPolicy, WritePolicy> Tiled;
+
+      DistanceImage storage( domain );
+      Factory factory( storage );
+      ReadPolicy readPolicy( factory, 2 );
+      WritePolicy writePolicy( factory );
+      Tiled tiled( factory, readPolicy, writePolicy, 4 );
+
+      DistanceTransformation<Z3i::Space, Predicate, L2Metric> reference( domain, predicate, l2 );
+      OutOfCoreDistanceTransformation<Z3i::Space, Predicate, L2Metric> dt( domain, predicate, l2, 4096 );
+      dt.compute( tiled );
+
+      unsigned int nbErrors = 0;
+      for ( auto const & pt : domain )
+        if ( storage( pt ) != reference( pt ) ) ++nbErrors;
+      REQUIRE( nbErrors == 0 );
+    }
+}
+
+/** @ingroup Tests **/
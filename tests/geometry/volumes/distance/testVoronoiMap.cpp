@@ -674,6 +674,194 @@ bool testSimple4D()
 }
 
 
+/// Exact l_2 metric hidden from the line-batched engine dispatch.
+struct GenericL2Metric : public ExactPredicateLpSeparableMetric<Z3i::Space,2> {};
+
+/**
+ * Compares the line-batched l_2 engine with the generic line by line
+ * process.
+ */
+bool testLineBatchedL2()
+{
+  typedef ExactPredicateLpSeparableMetric<Z3i::Space,2> L2Metric;
+  typedef VoronoiMap<Z3i::Space, Z3i::DigitalSet, L2Metric> VoroBatch;
+  typedef VoronoiMap<Z3i::Space, Z3i::DigitalSet, GenericL2Metric> VoroGeneric;
+  BOOST_STATIC_ASSERT(( VoroBatch::isLineBatchable ));
+  BOOST_STATIC_ASSERT(( ! VoroGeneric::isLineBatchable ));
+
+  // Extents that are not multiple of the batch size.
+  Z3i::Domain domain( Z3i::Point( -3, 2, -5 ), Z3i::Point( 33, 20, 11 ) );
+  Z3i::DigitalSet set( domain );
+  for ( auto const & pt : domain )
+    if ( rand() % 200 != 0 )
+      set.insertNew( pt );
+
+  L2Metric l2;
+  GenericL2Metric l2generic;
+  bool ok = true;
+  for ( std::size_t i = 0; i < 8; ++i )
+    {
+      auto const periodicity = getPeriodicityFromInteger<3>(i);
+      trace.beginBlock( "Line-batched l_2 with periodicity " + formatPeriodicity(periodicity) );
+      VoroBatch   voro( domain, set, l2, periodicity );
+      VoroGeneric voroRef( domain, set, l2generic, periodicity );
+      unsigned int nbErrors = 0;
+      for ( auto const & pt : domain )
+        if ( voro( pt ) != voroRef( pt ) )
+          ++nbErrors;
+      trace.info() << "Differences: " << nbErrors << std::endl;
+      ok = ok && nbErrors == 0;
+      trace.endBlock();
+    }
+
+  return ok;
+}
+
+/**
+ * Compares the Voronoi maps stored with linearized site indices
+ * (32-bit and 64-bit) with the default one.
+ */
+bool testCompactSites()
+{
+  typedef ExactPredicateLpSeparableMetric<Z3i::Space,2> L2Metric;
+  typedef ExactPredicateLpSeparableMetric<Z3i::Space,3> L3Metric;
+  typedef ImageContainerBySTLVector<Z3i::Domain, DGtal::uint32_t> Index32Image;
+  typedef ImageContainerBySTLVector<Z3i::Domain, DGtal::uint64_t> Index64Image;
+  typedef VoronoiMap<Z3i::Space, Z3i::DigitalSet, L2Metric> Voro;
+  typedef VoronoiMap<Z3i::Space, Z3i::DigitalSet, L2Metric, Index32Image> Voro32;
+  typedef VoronoiMap<Z3i::Space, Z3i::DigitalSet, L3Metric> Voro3;
+  typedef VoronoiMap<Z3i::Space, Z3i::DigitalSet, L3Metric, Index64Image> Voro3_64;
+  BOOST_STATIC_ASSERT(( Voro32::isCompact && ! Voro::isCompact ));
+
+  Z3i::Domain domain( Z3i::Point( -3, 2, -5 ), Z3i::Point( 17, 20, 11 ) );
+  Z3i::DigitalSet set( domain );
+  for ( auto const & pt : domain )
+    if ( rand() % 200 != 0 )
+      set.insertNew( pt );
+
+  L2Metric l2;
+  L3Metric l3;
+  bool ok = true;
+  for ( std::size_t i = 0; i < 8; ++i )
+    {
+      auto const periodicity = getPeriodicityFromInteger<3>(i);
+      trace.beginBlock( "Compact sites with periodicity " + formatPeriodicity(periodicity) );
+      Voro     voro( domain, set, l2, periodicity );
+      Voro32   voro32( domain, set, l2, periodicity );
+      Voro3    voro3( domain, set, l3, periodicity );
+      Voro3_64 voro3_64( domain, set, l3, periodicity );
+      unsigned int nbErrors = 0;
+      for ( auto const & pt : domain )
+        {
+          if ( voro( pt ) != voro32( pt ) ) ++nbErrors;
+          if ( voro3( pt ) != voro3_64( pt ) ) ++nbErrors;
+        }
+      auto it = voro32.constRange().begin();
+      for ( auto const & pt : domain )
+        if ( *it++ != voro( pt ) ) ++nbErrors;
+      trace.info() << "Differences: " << nbErrors << std::endl;
+      ok = ok && nbErrors == 0;
+      trace.endBlock();
+    }
+
+  // 8-bit indices cannot index the domain: the construction fails.
+  typedef ImageContainerBySTLVector<Z3i::Domain, DGtal::uint8_t> Index8Image;
+  typedef VoronoiMap<Z3i::Space, Z3i::DigitalSet, L2Metric, Index8Image> Voro8;
+  trace.beginBlock( "Compact sites with a too small index type" );
+  bool thrown = false;
+  try
+    {
+      Voro8 voro8( domain, set, l2 );
+    }
+  catch ( InputException & )
+    {
+      thrown = true;
+    }
+  trace.info() << "Exception thrown: " << thrown << std::endl;
+  ok = ok && thrown;
+  trace.endBlock();
+
+  return ok;
+}
+
+/**
+ * Compares the incremental update of a Voronoi map after local edits
+ * with a full recomputation.
+ */
+template <typename Metric, typename Image = ImageContainerBySTLVector<Z3i::Domain, Z3i::Vector> >
+bool testIncrementalUpdate( const Metric & metric, const std::string & name )
+{
+  typedef VoronoiMap<Z3i::Space, Z3i::DigitalSet, Metric, Image> Voro;
+
+  Z3i::Domain domain( Z3i::Point( -3, 2, -5 ), Z3i::Point( 30, 27, 20 ) );
+  Z3i::DigitalSet set( domain );
+  for ( auto const & pt : domain )
+    if ( rand() % 40 != 0 )
+      set.insertNew( pt );
+
+  trace.beginBlock( "Incremental update (" + name + ")" );
+  Voro voro( domain, set, metric );
+  bool ok = true;
+  for ( unsigned int round = 0; round < 4; ++round )
+    {
+      // A painted ball (new sites), an erased ball (removed sites)
+      // and a few scattered edits.
+      std::vector<Z3i::Point> inserted, removed;
+      const Z3i::Point paintCenter( rand() % 34 - 3, rand() % 26 + 2, rand() % 26 - 5 );
+      const Z3i::Point eraseCenter( rand() % 34 - 3, rand() % 26 + 2, rand() % 26 - 5 );
+      for ( auto const & pt : domain )
+        {
+          if ( ( pt - paintCenter ).squaredNorm() <= 4 && set( pt ) )
+            {
+              set.erase( pt );
+              inserted.push_back( pt );
+            }
+          else if ( ( pt - eraseCenter ).squaredNorm() <= 9 && ! set( pt ) )
+            {
+              set.insert( pt );
+              removed.push_back( pt );
+            }
+        }
+      for ( unsigned int i = 0; i < 5; ++i )
+        {
+          const Z3i::Point pt( rand() % 34 - 3, rand() % 26 + 2, rand() % 26 - 5 );
+          if ( set( pt ) )
+            {
+              set.erase( pt );
+              inserted.push_back( pt );
+            }
+          else
+            {
+              set.insert( pt );
+              removed.push_back( pt );
+            }
+        }
+      if ( round == 3 )
+        {
+          // Removing all the sites.
+          inserted.clear();
+          for ( auto const & pt : domain )
+            if ( ! set( pt ) )
+              {
+                set.insert( pt );
+                removed.push_back( pt );
+              }
+        }
+
+      voro.update( inserted, removed );
+      Voro reference( domain, set, metric );
+      unsigned int nbErrors = 0;
+      for ( auto const & pt : domain )
+        if ( voro( pt ) != reference( pt ) )
+          ++nbErrors;
+      trace.info() << inserted.size() << " inserted and " << removed.size()
+                   << " removed sites, differences: " << nbErrors << std::endl;
+      ok = ok && nbErrors == 0;
+    }
+  trace.endBlock();
+  return ok;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -695,6 +883,15 @@ int main( int argc, char** argv )
     && testSimple3D()
     && testSimpleRandom3D()
     && testSimple4D()
+    && testLineBatchedL2()
+    && testCompactSites()
+    && testIncrementalUpdate( ExactPredicateLpSeparableMetric<Z3i::Space,2>(),
+                              "l_2" )
+    && testIncrementalUpdate<ExactPredicateLpSeparableMetric<Z3i::Space,1>,
+                             ImageContainerBySTLVector<Z3i::Domain, DGtal::uint32_t> >
+                            ( ExactPredicateLpSeparableMetric<Z3i::Space,1>(), "l_1, compact" )
+    && testIncrementalUpdate( ExactPredicateLpSeparableMetric<Z3i::Space,3>(),
+                              "l_3" )
     ; // && ... other tests
 
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
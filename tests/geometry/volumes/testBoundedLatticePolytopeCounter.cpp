@@ -31,7 +31,9 @@
 #include <iostream>
 #include <vector>
 #include <algorithm>
+#include <set>
 #include "DGtal/base/Common.h"
+#include "DGtal/base/WorkStealingScheduler.h"
 #include "DGtal/kernel/SpaceND.h"
 #include "DGtal/geometry/volumes/BoundedLatticePolytope.h"
 #include "DGtal/geometry/volumes/BoundedLatticePolytopeCounter.h"
@@ -123,3 +125,67 @@ SCENARIO( "BoundedLatticePolytope< Z3 > unit tests", "[lattice_polytope][3d]" )
       }
   }
 }
+
+SCENARIO( "BoundedLatticePolytopeCounter< Z3 > row kernels", "[lattice_polytope][3d]" )
+{
+  typedef SpaceND<3,int>                   Space;
+  typedef Space::Point                     Point;
+  typedef BoundedLatticePolytope< Space >  Polytope;
+  typedef BoundedLatticePolytopeCounter< Space > Counter;
+
+  // Forces several threads, even on a single core machine.
+  WorkStealingScheduler::setNumberOfThreads( 4 );
+  GIVEN( "Small and large simplices, closed or half-open" ) {
+    std::vector< Polytope > polytopes;
+    polytopes.push_back( Polytope { Point( 0, 0, 0 ), Point( 6, 3, 0 ),
+                                    Point( 0, 5, -10 ), Point( -6, 4, 8 ) } );
+    // 81x81 rows along the longest axis: computed on several threads.
+    polytopes.push_back( Polytope { Point( 0, 0, 0 ), Point( 100, 7, 3 ),
+                                    Point( 11, 80, -2 ), Point( -3, 17, 80 ) } );
+    polytopes.push_back( polytopes[ 1 ].interiorPolytope() );
+    Polytope Q = polytopes[ 0 ];
+    Q += Polytope::LeftStrictUnitSegment( 1 );
+    polytopes.push_back( Q );
+    THEN( "The counts, points and lattice sets are the same as by scanning" ) {
+      for ( const auto& P : polytopes )
+        {
+          Counter C( P );
+          const int nb     = P.countByScanning();
+          const int nb_int = P.countInteriorByScanning();
+          REQUIRE( P.count() == nb );
+          REQUIRE( P.countInterior() == nb_int );
+          for ( Dimension a = 0; a < 3; a++ )
+            {
+              REQUIRE( C.countAlongAxis( a ) == nb );
+              REQUIRE( C.countInteriorAlongAxis( a ) == nb_int );
+            }
+          std::vector< Point > expected, result, expected_int, result_int;
+          P.getPointsByScanning( expected );
+          P.getPoints( result );
+          P.getInteriorPointsByScanning( expected_int );
+          P.getInteriorPoints( result_int );
+          std::sort( expected.begin(), expected.end() );
+          std::sort( result.begin(), result.end() );
+          std::sort( expected_int.begin(), expected_int.end() );
+          std::sort( result_int.begin(), result_int.end() );
+          REQUIRE( result == expected );
+          REQUIRE( result_int == expected_int );
+          std::set< Point > S;
+          P.insertPoints( S );
+          REQUIRE( S.size() == expected.size() );
+          REQUIRE( std::equal( S.cbegin(), S.cend(), expected.cbegin() ) );
+          const auto L      = P.getLatticeSet();
+          const auto L_int  = P.getInteriorLatticeSet();
+          const Dimension a = C.longestAxis();
+          REQUIRE( L.size() == expected.size() );
+          REQUIRE( L.equals( Polytope::LatticeSet( expected.cbegin(), expected.cend(), a ) ) );
+          REQUIRE( L_int.size() == expected_int.size() );
+          REQUIRE( L_int.equals( Polytope::LatticeSet( expected_int.cbegin(),
+                                                       expected_int.cend(), a ) ) );
+        }
+    }
+  }
+  WorkStealingScheduler::setNumberOfThreads( 0 );
+}
+
+
@@ -0,0 +1,144 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testFrontierBreadthFirstVisitor.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing class FrontierBreadthFirstVisitor.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <limits>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/WorkStealingScheduler.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/graph/BreadthFirstVisitor.h"
+#include "DGtal/graph/FrontierBreadthFirstVisitor.h"
+#include "DGtal/topology/DigitalSetBoundary.h"
+#include "DGtal/topology/IndexedDigitalSurface.h"
+#include "DGtal/shapes/Shapes.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace Z3i;
+
+typedef DigitalSetBoundary< KSpace, DigitalSet >        SurfaceContainer;
+typedef IndexedDigitalSurface< SurfaceContainer >       Surface;
+typedef FrontierBreadthFirstVisitor< Surface >          Visitor;
+typedef std::vector< std::size_t >                      Distances;
+
+static const std::size_t UNREACHED = std::numeric_limits< std::size_t >::max();
+
+/// Distances given by BreadthFirstVisitor.
+template <typename VertexPredicate>
+Distances referenceDistances( const Surface & surface, Surface::Vertex p,
+                              const VertexPredicate & pred )
+{
+  Distances d( surface.size(), UNREACHED );
+  BreadthFirstVisitor< Surface > visitor( surface, p );
+  while ( ! visitor.finished() )
+    {
+      d[ visitor.current().first ] = visitor.current().second;
+      visitor.expand( pred );
+    }
+  return d;
+}
+
+/// Distances given by FrontierBreadthFirstVisitor.
+template <typename VertexPredicate>
+Distances frontierDistances( Visitor & visitor, const VertexPredicate & pred,
+                             bool & sorted )
+{
+  Distances d( visitor.graph().size(), UNREACHED );
+  sorted = true;
+  while ( ! visitor.finished() )
+    {
+      const auto & layer = visitor.currentLayer();
+      sorted = sorted && std::is_sorted( layer.begin(), layer.end() );
+      for ( auto v : layer ) d[ v ] = visitor.distance();
+      visitor.expandLayer( pred );
+    }
+  return d;
+}
+
+TEST_CASE( "FrontierBreadthFirstVisitor on an IndexedDigitalSurface" )
+{
+  Point p1( -12, -12, -12 );
+  Point p2(  12,  12,  12 );
+  KSpace K;
+  K.init( p1, p2, true );
+  DigitalSet aSet( Domain( p1, p2 ) );
+  Shapes<Domain>::addNorm2Ball( aSet, Point( 0, 0, 0 ), 9 );
+  Shapes<Domain>::addNorm2Ball( aSet, Point( 6, 0, 0 ), 5 );
+  Surface surface;
+  REQUIRE( surface.build( new SurfaceContainer( K, aSet ) ) );
+
+  auto all  = [] ( Surface::Vertex ) { return true; };
+  auto half = [ &surface, &K ] ( Surface::Vertex v )
+    { return K.sKCoord( surface.surfel( v ), 2 ) >= -3; };
+
+  for ( unsigned int nbThreads : { 1u, 4u } )
+    for ( auto mode : { Visitor::PUSH, Visitor::PULL, Visitor::AUTO } )
+      {
+        CAPTURE( nbThreads );
+        CAPTURE( int( mode ) );
+        WorkStealingScheduler::setNumberOfThreads( nbThreads );
+        bool sorted;
+        {
+          Visitor visitor( surface, 17, mode );
+          const Distances d = frontierDistances( visitor, all, sorted );
+          CHECK( sorted );
+          CHECK( d == referenceDistances( surface, 17, all ) );
+          CHECK( visitor.nbMarked() == surface.size() );
+          if ( mode == Visitor::PUSH ) CHECK( visitor.nbPullLayers() == 0 );
+          else                         CHECK( visitor.nbPullLayers() > 0 );
+        }
+        {
+          Visitor visitor( surface, 17, mode );
+          const Distances d = frontierDistances( visitor, half, sorted );
+          CHECK( sorted );
+          CHECK( d == referenceDistances( surface, 17, half ) );
+          CHECK( visitor.nbMarked() < surface.size() );
+        }
+      }
+  WorkStealingScheduler::setNumberOfThreads( 0 );
+
+  SECTION( "Several seeds" )
+    {
+      std::vector< Surface::Vertex > seeds = { 3, 100, 3, 250 };
+      Visitor visitor( surface, seeds.begin(), seeds.end() );
+      CHECK( visitor.currentLayer().size() == 3 );
+      bool sorted;
+      const Distances d = frontierDistances( visitor, all, sorted );
+      const Distances d3   = referenceDistances( surface, 3, all );
+      const Distances d100 = referenceDistances( surface, 100, all );
+      const Distances d250 = referenceDistances( surface, 250, all );
+      bool ok = true;
+      for ( Surface::Vertex v = 0; v < surface.size(); ++v )
+        ok = ok && d[ v ] == std::min( { d3[ v ], d100[ v ], d250[ v ] } );
+      CHECK( ok );
+    }
+}
+
+/** @ingroup Tests **/
@@ -36,6 +36,8 @@
 #include "DGtal/kernel/SpaceND.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
 #include "DGtal/images/ImageSelector.h"
+#include "DGtal/images/ImageContainerByBricks.h"
+#include "DGtal/images/ImageRowSpans.h"
 
 #include "DGtal/helpers/StdDefs.h"
 #include <map>
@@ -163,6 +165,225 @@ BENCHMARK_TEMPLATE(BM_DomainScan, ImageVector2)->Range(1<<3 , 1 << 10);
 BENCHMARK_TEMPLATE(BM_DomainScan, ImageMap2)->Range(1<<3 , 1 << 10);
 
 
+/////// 3D neighborhood kernels
+
+typedef DGtal::ImageContainerBySTLVector< Z3i::Domain, float> ImageVector3;
+typedef DGtal::ImageContainerByBricks< Z3i::Domain, float> ImageBricks3;
+
+template<typename Q>
+static void BM_Stencil3D(benchmark::State& state)
+{
+  typename Q::Domain dom(typename Q::Point().diagonal(0),
+                         typename Q::Point().diagonal(state.range(0)));
+  Q image( dom );
+  for(typename Q::Domain::ConstIterator it = dom.begin(), itend = dom.end(); it != itend; ++it)
+    image.setValue( *it, float( rand() % 256 ) );
+  typename Q::Domain inner(typename Q::Point().diagonal(1),
+                           typename Q::Point().diagonal(state.range(0)-1));
+  const Z3i::Point e[3] = { Z3i::Point(1,0,0), Z3i::Point(0,1,0), Z3i::Point(0,0,1) };
+  float sum = 0;
+  while (state.KeepRunning())
+    {
+      for(typename Q::Domain::ConstIterator it = inner.begin(), itend = inner.end(); it != itend; ++it)
+        {
+          float s = -6 * image( *it );
+          for ( unsigned int k = 0; k < 3; ++k )
+            s += image( *it + e[ k ] ) + image( *it - e[ k ] );
+          benchmark::DoNotOptimize( sum += s );
+        }
+    }
+  state.SetItemsProcessed(state.iterations() * inner.size());
+}
+BENCHMARK_TEMPLATE(BM_Stencil3D, ImageVector3)->Range(1<<5 , 1 << 8);
+BENCHMARK_TEMPLATE(BM_Stencil3D, ImageBricks3)->Range(1<<5 , 1 << 8);
+
+/// Same kernel in the order of the storage, with the neighbors given
+/// by linear offsets.
+static void BM_Stencil3DStorageVector(benchmark::State& state)
+{
+  Z3i::Domain dom(Z3i::Point::diagonal(0), Z3i::Point::diagonal(state.range(0)));
+  ImageVector3 image( dom );
+  for(auto & v : image) v = float( rand() % 256 );
+  const std::ptrdiff_t n = state.range(0) + 1;
+  const std::ptrdiff_t offsets[3] = { 1, n, n * n };
+  float sum = 0;
+  while (state.KeepRunning())
+    {
+      for(std::ptrdiff_t z = 1; z < n-1; ++z)
+        for(std::ptrdiff_t y = 1; y < n-1; ++y)
+          for(std::ptrdiff_t i = z*n*n + y*n + 1, iE = i + n - 2; i < iE; ++i)
+            {
+              float s = -6 * image[ i ];
+              for ( unsigned int k = 0; k < 3; ++k )
+                s += image[ i + offsets[ k ] ] + image[ i - offsets[ k ] ];
+              benchmark::DoNotOptimize( sum += s );
+            }
+    }
+  state.SetItemsProcessed(state.iterations() * (n-2) * (n-2) * (n-2));
+}
+BENCHMARK(BM_Stencil3DStorageVector)->Range(1<<5 , 1 << 8);
+
+/// Same kernel in the order of the storage, with the neighbors given
+/// by ImageContainerByBricks::indexIncr and indexDecr.
+static void BM_Stencil3DStorageBricks(benchmark::State& state)
+{
+  Z3i::Domain dom(Z3i::Point::diagonal(0), Z3i::Point::diagonal(state.range(0)));
+  ImageBricks3 image( dom );
+  for(auto it = image.storageBegin(), itend = image.storageEnd(); it != itend; ++it)
+    *it = float( rand() % 256 );
+  const ImageBricks3::Index size = image.storageSize();
+  std::vector<char> interior( size );
+  for(ImageBricks3::Index i = 0; i < size; ++i)
+    {
+      const Z3i::Point p = image.point( i );
+      interior[ i ] = p.inf( Z3i::Point::diagonal(1) ) == Z3i::Point::diagonal(1)
+        && p.sup( Z3i::Point::diagonal(state.range(0)-1) ) == Z3i::Point::diagonal(state.range(0)-1);
+    }
+  float sum = 0;
+  while (state.KeepRunning())
+    {
+      for(ImageBricks3::Index i = 0; i < size; ++i)
+        {
+          if ( ! interior[ i ] ) continue;
+          float s = -6 * image[ i ];
+          for ( unsigned int k = 0; k < 3; ++k )
+            s += image[ image.indexIncr( i, k ) ] + image[ image.indexDecr( i, k ) ];
+          benchmark::DoNotOptimize( sum += s );
+        }
+    }
+  state.SetItemsProcessed(state.iterations() * (state.range(0)-1) * (state.range(0)-1) * (state.range(0)-1));
+}
+BENCHMARK(BM_Stencil3DStorageBricks)->Range(1<<5 , 1 << 8);
+
+/// Sum of the values in a ball around random points, as in integral
+/// invariants computed at the surfels of a shape.
+template<typename Q>
+static void BM_BallKernel3D(benchmark::State& state)
+{
+  const int n = int( state.range(0) );
+  const int r = 5;
+  typename Q::Domain dom(typename Q::Point().diagonal(0),
+                         typename Q::Point().diagonal(n));
+  Q image( dom );
+  for(typename Q::Domain::ConstIterator it = dom.begin(), itend = dom.end(); it != itend; ++it)
+    image.setValue( *it, float( rand() % 256 ) );
+  std::vector<Z3i::Point> ball;
+  for(int z = -r; z <= r; ++z) for(int y = -r; y <= r; ++y) for(int x = -r; x <= r; ++x)
+    if ( x*x + y*y + z*z <= r*r ) ball.push_back( Z3i::Point( x, y, z ) );
+  std::vector<Z3i::Point> centers( 10000 );
+  for(auto & c : centers)
+    c = Z3i::Point( r + rand() % (n-2*r), r + rand() % (n-2*r), r + rand() % (n-2*r) );
+  float sum = 0;
+  while (state.KeepRunning())
+    for(const auto & c : centers)
+      {
+        float s = 0;
+        for(const auto & d : ball) s += image( c + d );
+        benchmark::DoNotOptimize( sum += s );
+      }
+  state.SetItemsProcessed(state.iterations() * centers.size());
+}
+BENCHMARK_TEMPLATE(BM_BallKernel3D, ImageVector3)->Range(1<<6 , 1 << 9);
+BENCHMARK_TEMPLATE(BM_BallKernel3D, ImageBricks3)->Range(1<<6 , 1 << 9);
+
+
+/////// Bulk kernels on the storage (see ImageRowSpans.h)
+
+typedef DGtal::ImageContainerBySTLVector< Z3i::Domain, unsigned char> ImageVectorUChar3;
+
+static ImageVectorUChar3 RandomImage3(int n)
+{
+  ImageVectorUChar3 image( Z3i::Domain(Z3i::Point::diagonal(0), Z3i::Point::diagonal(n)) );
+  for(auto & v : image) v = (unsigned char)( rand() % 256 );
+  return image;
+}
+
+/// Thresholding with the domain iterator and image( p ).
+static void BM_ThresholdDomain(benchmark::State& state)
+{
+  const ImageVectorUChar3 image = RandomImage3( int( state.range(0) ) );
+  ImageVectorUChar3 output( image.domain() );
+  while (state.KeepRunning())
+    {
+      for(auto const& p : image.domain())
+        output.setValue( p, image( p ) >= 128 ? 255 : 0 );
+      benchmark::ClobberMemory();
+    }
+  state.SetItemsProcessed(state.iterations() * image.size());
+}
+BENCHMARK(BM_ThresholdDomain)->Range(1<<5 , 1 << 8);
+
+/// Thresholding with functions::transformImage.
+static void BM_ThresholdTransform(benchmark::State& state)
+{
+  const ImageVectorUChar3 image = RandomImage3( int( state.range(0) ) );
+  ImageVectorUChar3 output( image.domain() );
+  while (state.KeepRunning())
+    {
+      functions::transformImage( image, output, [] ( unsigned char v )
+                                 { return (unsigned char)( v >= 128 ? 255 : 0 ); } );
+      benchmark::ClobberMemory();
+    }
+  state.SetItemsProcessed(state.iterations() * image.size());
+}
+BENCHMARK(BM_ThresholdTransform)->Range(1<<5 , 1 << 8);
+
+/// Counting with the constant range.
+static void BM_CountRange(benchmark::State& state)
+{
+  const ImageVectorUChar3 image = RandomImage3( int( state.range(0) ) );
+  while (state.KeepRunning())
+    {
+      std::size_t nb = 0;
+      for(auto v : image.constRange())
+        nb += v >= 128 ? 1 : 0;
+      benchmark::DoNotOptimize( nb );
+    }
+  state.SetItemsProcessed(state.iterations() * image.size());
+}
+BENCHMARK(BM_CountRange)->Range(1<<5 , 1 << 8);
+
+/// Counting with functions::countIf.
+static void BM_CountIf(benchmark::State& state)
+{
+  const ImageVectorUChar3 image = RandomImage3( int( state.range(0) ) );
+  while (state.KeepRunning())
+    {
+      std::size_t nb = functions::countIf( image, [] ( unsigned char v ) { return v >= 128; } );
+      benchmark::DoNotOptimize( nb );
+    }
+  state.SetItemsProcessed(state.iterations() * image.size());
+}
+BENCHMARK(BM_CountIf)->Range(1<<5 , 1 << 8);
+
+/// Bit mask built bit by bit with the constant range.
+static void BM_BitmaskRange(benchmark::State& state)
+{
+  const ImageVectorUChar3 image = RandomImage3( int( state.range(0) ) );
+  while (state.KeepRunning())
+    {
+      boost::dynamic_bitset< std::uint64_t > mask( image.size() );
+      std::size_t i = 0;
+      for(auto v : image.constRange())
+        mask[ i++ ] = v >= 128;
+      benchmark::DoNotOptimize( mask );
+    }
+  state.SetItemsProcessed(state.iterations() * image.size());
+}
+BENCHMARK(BM_BitmaskRange)->Range(1<<5 , 1 << 8);
+
+/// Bit mask built by blocks with functions::bitmaskFromImage.
+static void BM_Bitmask(benchmark::State& state)
+{
+  const ImageVectorUChar3 image = RandomImage3( int( state.range(0) ) );
+  while (state.KeepRunning())
+    {
+      auto mask = functions::bitmaskFromImage( image, [] ( unsigned char v ) { return v >= 128; } );
+      benchmark::DoNotOptimize( mask );
+    }
+  state.SetItemsProcessed(state.iterations() * image.size());
+}
+BENCHMARK(BM_Bitmask)->Range(1<<5 , 1 << 8);
 
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,148 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testImageContainerByBricks.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing class ImageContainerByBricks.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageContainerByBricks.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ImageContainerByBricks.
+///////////////////////////////////////////////////////////////////////////////
+
+/// Compares an image by bricks with an ImageContainerBySTLVector.
+template < typename TImage >
+void checkImage( const typename TImage::Domain & domain )
+{
+  typedef typename TImage::Domain Domain;
+  typedef typename TImage::Point  Point;
+  typedef typename TImage::Index  Index;
+  const typename Domain::Dimension dim = Domain::dimension;
+
+  TImage image( domain, -1 );
+  REQUIRE( image.isValid() );
+  ImageContainerBySTLVector< Domain, int > reference( domain );
+  int n = 0;
+  for ( const auto & p : domain )
+    {
+      reference.setValue( p, n );
+      image.setValue( p, n++ );
+    }
+
+  // Values in the order of the domain.
+  CHECK( std::equal( reference.begin(), reference.end(),
+                     image.constRange().begin() ) );
+
+  // Indices are distinct, and the points are recovered.
+  std::vector< char > used( image.storageSize(), 0 );
+  bool ok_index = true;
+  bool ok_point = true;
+  for ( const auto & p : domain )
+    {
+      const Index i = image.index( p );
+      ok_index = ok_index && i < image.storageSize() && ! used[ i ];
+      used[ i ] = 1;
+      ok_point = ok_point && image.point( i ) == p && image[ i ] == reference( p );
+    }
+  CHECK( ok_index );
+  CHECK( ok_point );
+
+  // Storage order visits each point of the domain once.
+  std::size_t nb_inside = 0;
+  bool ok_storage = true;
+  Index i = 0;
+  for ( auto it = image.storageBegin(), itE = image.storageEnd(); it != itE; ++it, ++i )
+    {
+      const Point p = image.point( i );
+      if ( domain.isInside( p ) )
+        {
+          ++nb_inside;
+          ok_storage = ok_storage && *it == reference( p );
+        }
+      else
+        ok_storage = ok_storage && *it == -1;
+    }
+  CHECK( ok_storage );
+  CHECK( nb_inside == domain.size() );
+
+  // Neighbors along each axis.
+  bool ok_neighbors = true;
+  for ( const auto & p : domain )
+    for ( typename Domain::Dimension k = 0; k < dim; ++k )
+      {
+        const Point e = Point::base( k );
+        if ( domain.isInside( p + e ) )
+          ok_neighbors = ok_neighbors
+            && image.indexIncr( image.index( p ), k ) == image.index( p + e );
+        if ( domain.isInside( p - e ) )
+          ok_neighbors = ok_neighbors
+            && image.indexDecr( image.index( p ), k ) == image.index( p - e );
+      }
+  CHECK( ok_neighbors );
+}
+
+TEST_CASE( "ImageContainerByBricks" )
+{
+  typedef ImageContainerByBricks< Z2i::Domain, int >    Image2;
+  typedef ImageContainerByBricks< Z3i::Domain, int >    Image3;
+  typedef ImageContainerByBricks< Z3i::Domain, int, 2 > Image3Small;
+  typedef ImageContainerByBricks< Z3i::Domain, int, 5 > Image3Morton;
+  BOOST_CONCEPT_ASSERT(( concepts::CImage< Image2 > ));
+  BOOST_CONCEPT_ASSERT(( concepts::CImage< Image3 > ));
+
+  SECTION( "2D, domain not a multiple of the bricks" )
+    {
+      checkImage< Image2 >( Z2i::Domain( Z2i::Point( -5, 3 ), Z2i::Point( 14, 25 ) ) );
+    }
+  SECTION( "3D" )
+    {
+      const Z3i::Domain domain( Z3i::Point( -3, -7, 2 ), Z3i::Point( 17, 9, 12 ) );
+      checkImage< Image3 >( domain );
+      checkImage< Image3Small >( domain );
+    }
+  SECTION( "3D, a single brick (Morton order)" )
+    {
+      const Z3i::Domain domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 19, 13, 7 ) );
+      checkImage< Image3Morton >( domain );
+      Image3Morton image( domain );
+      CHECK( image.index( Z3i::Point( 1, 0, 0 ) ) == 1 );
+      CHECK( image.index( Z3i::Point( 0, 1, 0 ) ) == 2 );
+      CHECK( image.index( Z3i::Point( 0, 0, 1 ) ) == 4 );
+      CHECK( image.index( Z3i::Point( 1, 1, 1 ) ) == 7 );
+      CHECK( image.index( Z3i::Point( 2, 0, 0 ) ) == 8 );
+    }
+}
+
+/** @ingroup Tests **/
@@ -0,0 +1,158 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testImageRowSpans.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing the row traversals and bulk kernels of
+ * ImageRowSpans.h.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageRowSpans.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing ImageRowSpans.h
+///////////////////////////////////////////////////////////////////////////////
+
+TEMPLATE_TEST_CASE( "forEachRow visits the points in the domain order",
+                    "[row_spans]", Z2i::Domain, Z3i::Domain )
+{
+  typedef TestType                Domain;
+  typedef typename Domain::Point  Point;
+  const Point lo = Point::diagonal( -3 );
+  Point up = Point::diagonal( 4 );
+  up[ 0 ] = 7;
+  const Domain domain( lo, up );
+  std::vector< Point > points;
+  std::size_t nbRows = 0;
+  functions::forEachRow( domain, [&] ( const Point & first, std::size_t length )
+    {
+      nbRows++;
+      REQUIRE( length == 11 );
+      REQUIRE( first[ 0 ] == lo[ 0 ] );
+      Point p = first;
+      for ( std::size_t i = 0; i < length; ++i, ++p[ 0 ] )
+        points.push_back( p );
+    } );
+  REQUIRE( nbRows * 11 == domain.size() );
+  REQUIRE( std::equal( points.begin(), points.end(), domain.begin() ) );
+  REQUIRE( points.size() == domain.size() );
+
+  std::size_t nbEmpty = 0;
+  functions::forEachRow( Domain( lo, lo - Point::diagonal( 1 ) ),
+                         [&] ( const Point &, std::size_t ) { nbEmpty++; } );
+  REQUIRE( nbEmpty == 0 );
+}
+
+SCENARIO( "Row spans and bulk kernels on ImageContainerBySTLVector", "[row_spans]" )
+{
+  typedef Z3i::Domain                                Domain;
+  typedef Z3i::Point                                 Point;
+  typedef ImageContainerBySTLVector< Domain, int >   Image;
+  typedef ImageContainerBySTLVector< Domain, float > FloatImage;
+
+  // 13 values per row, so that blocks of 64 overlap rows.
+  const Domain domain( Point( -6, -2, 0 ), Point( 6, 5, 4 ) );
+  Image image( domain );
+  srand( 0 );
+  for ( auto p : domain )
+    image.setValue( p, rand() % 256 );
+
+  WHEN( "Visiting the spans of the whole image" ) {
+    std::size_t nb_ok = 0, nb = 0;
+    functions::forEachRowSpan( static_cast< const Image & >( image ),
+      [&] ( const int * data, std::size_t length, const Point & first )
+      {
+        Point p = first;
+        for ( std::size_t i = 0; i < length; ++i, ++p[ 0 ], ++nb )
+          nb_ok += data[ i ] == image( p ) ? 1 : 0;
+      } );
+    THEN( "The values are the ones of the points" ) {
+      REQUIRE( nb == domain.size() );
+      REQUIRE( nb_ok == nb );
+    }
+  }
+  WHEN( "Filling a sub-domain" ) {
+    const Domain sub( Point( -2, 0, 1 ), Point( 3, 4, 2 ) );
+    Image other( image );
+    functions::fillImage( other, sub, 1000 );
+    std::size_t nb_ok = 0;
+    for ( auto p : domain )
+      nb_ok += other( p ) == ( sub.isInside( p ) ? 1000 : image( p ) ) ? 1 : 0;
+    THEN( "Only the sub-domain is changed" ) {
+      REQUIRE( nb_ok == domain.size() );
+    }
+  }
+  WHEN( "Computing reductions" ) {
+    std::size_t nb  = 0;
+    long        sum = 0;
+    for ( auto p : domain )
+      {
+        nb  += image( p ) >= 128 ? 1 : 0;
+        sum += image( p );
+      }
+    THEN( "They are the same as with the domain iterator" ) {
+      REQUIRE( functions::countIf( image, [] ( int v ) { return v >= 128; } ) == nb );
+      REQUIRE( functions::sumImage( image, 0L ) == sum );
+    }
+  }
+  WHEN( "Computing a bit mask" ) {
+    const auto mask = functions::bitmaskFromImage
+      ( image, [] ( int v ) { return v % 3 == 0; } );
+    std::size_t nb_ok = 0;
+    for ( auto p : domain )
+      nb_ok += mask[ image.linearized( p ) ] == ( image( p ) % 3 == 0 ) ? 1 : 0;
+    THEN( "Bit i is the predicate on the i-th value" ) {
+      REQUIRE( mask.size() == domain.size() );
+      REQUIRE( nb_ok == domain.size() );
+      REQUIRE( mask.count()
+               == functions::countIf( image, [] ( int v ) { return v % 3 == 0; } ) );
+    }
+  }
+  WHEN( "Transforming values" ) {
+    FloatImage output( domain );
+    functions::transformImage( image, output, [] ( int v ) { return 0.5f * v; } );
+    Image other( image );
+    functions::transformImage( other, [] ( int v ) { return 255 - v; } );
+    std::size_t nb_ok = 0;
+    for ( auto p : domain )
+      nb_ok += ( output( p ) == 0.5f * image( p ) && other( p ) == 255 - image( p ) )
+        ? 1 : 0;
+    THEN( "Each value is transformed" ) {
+      REQUIRE( nb_ok == domain.size() );
+    }
+  }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
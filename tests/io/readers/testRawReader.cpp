@@ -117,6 +117,9 @@ void testRawReaderOnRef()
   INFO( "Reading file with importRaw" << fileName );
   Image imageRaw = RawReader<Image>::template importRaw< unsigned int >( fileName, extent );
   testImageOnRef( imageRaw );
+
+  INFO( "Mapping file with mapRaw" << fileName );
+  testImageOnRef( RawReader<Image>::template mapRaw< unsigned int >( fileName, extent ) );
 }
 
 /** Compares an image to a generated data.
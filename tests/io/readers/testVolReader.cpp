@@ -166,6 +166,62 @@ bool testConsistence()
   return true;
 }
 
+bool testMapVol()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  
+  trace.beginBlock ( "Testing VolReader::mapVol ..." );
+
+  typedef SpaceND<3> Space4Type;
+  typedef HyperRectDomain<Space4Type> TDomain;
+  typedef ImageSelector<TDomain, unsigned char>::Type Image;
+  typedef MemoryMappedImage<TDomain, unsigned char> MappedImage;
+
+  //compressed file
+  std::string filename = testPath + "samples/cat10.vol";
+  Image image = VolReader<Image>::importVol( filename );
+  MappedImage mapped = VolReader<Image>::mapVol( filename );
+  trace.info() << mapped << endl;
+
+  bool allFine = image.domain().lowerBound() == mapped.domain().lowerBound()
+    && image.domain().upperBound() == mapped.domain().upperBound();
+  for ( auto const & p : image.domain() )
+    allFine &= image( p ) == mapped( p );
+  nbok += allFine ? 1 : 0; 
+  nb++;
+
+  //uncompressed file
+  VolWriter<Image>::exportVol( "catenoid-export-raw.vol", image, false );
+  Image image2 = VolReader<Image>::importVol( "catenoid-export-raw.vol" );
+  MappedImage mapped2 = VolReader<Image>::mapVol( "catenoid-export-raw.vol" );
+  trace.info() << mapped2 << endl;
+
+  allFine = image.domain().lowerBound() == mapped2.domain().lowerBound()
+    && image.domain().upperBound() == mapped2.domain().upperBound();
+  unsigned int nbval = 0;
+  MappedImage::ConstRange r = mapped2.constRange();
+  for ( MappedImage::ConstRange::ConstIterator it = r.begin(), itend = r.end(); it != itend; ++it )
+    if ( (*it) != 0 )
+      nbval++;
+  for ( auto const & p : image.domain() )
+    allFine &= ( image( p ) == mapped2( p ) ) && ( image( p ) == image2( p ) );
+  nbok += ( allFine && nbval == 8043 ) ? 1 : 0; 
+  nb++;
+
+  //the mapping outlives the copies
+  MappedImage copy = mapped2;
+  mapped2 = MappedImage();
+  nbok += ( copy( Space4Type::Point( 0, 0, 0 ) ) == image( Space4Type::Point( 0, 0, 0 ) ) ) ? 1 : 0;
+  nb++;
+
+  trace.info() << "(" << nbok << "/" << nb << ") "
+         << "mapped values == imported values" << std::endl;
+  trace.endBlock();
+  
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -180,7 +236,8 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testVolReader() && testIOException() && testConsistence(); // && ... other tests
+  bool res = testVolReader() && testIOException() && testConsistence()
+    && testMapVol(); // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
@@ -0,0 +1,275 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testChunkedVol.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/16
+ *
+ * Functions for testing the chunked volume reader, writer and image
+ * factory.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <fstream>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/base/WorkStealingScheduler.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageCachePolicies.h"
+#include "DGtal/images/TiledImage.h"
+#include "DGtal/images/ImageFactoryFromChunkedVol.h"
+#include "DGtal/io/writers/ChunkedVolWriter.h"
+#include "DGtal/io/readers/ChunkedVolReader.h"
+
+///////////////////////////////////////////////////////////////////////////////
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing the chunked volumes.
+///////////////////////////////////////////////////////////////////////////////
+
+template <typename Image>
+void fillImage( Image & image )
+{
+  DGtal::uint64_t v = 1;
+  for ( typename Image::Iterator it = image.begin(), itend = image.end(); it != itend; ++it )
+    {
+      *it = static_cast<typename Image::Value>( v >> 40 );
+      v = v * 0X5851F42D4C957F2Dull + 1;
+    }
+}
+
+template <typename Image>
+bool sameValues( const Image & image, const Image & other )
+{
+  bool allFine = ( other.domain().lowerBound() == image.domain().lowerBound() )
+    && ( other.domain().upperBound() == image.domain().upperBound() );
+  for ( auto const & p : image.domain() )
+    allFine &= other( p ) == image( p );
+  return allFine;
+}
+
+/**
+ * Export and import of whole images and blocks.
+ *
+ */
+bool testChunkedVol()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing chunked volume writer and reader ..." );
+
+  typedef ImageContainerBySTLVector<Z3i::Domain, DGtal::uint16_t> Image;
+  Image image( Z3i::Domain( Z3i::Point( -3, 0, 2 ), Z3i::Point( 20, 17, 29 ) ) );
+  fillImage( image );
+
+  ChunkedVolWriter<Image>::exportChunkedVol( "export-chunked.cvol", image, Z3i::Vector( 8, 5, 8 ) );
+  const ChunkedVolLayout<Z3i::Domain> layout = ChunkedVolReader<Image>::layout( "export-chunked.cvol" );
+  trace.info() << layout << std::endl;
+  nbok += ( layout.isValid() && layout.nbBricks() == 3 * 4 * 4 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "brick index" << std::endl;
+
+  const Image image2 = ChunkedVolReader<Image>::importChunkedVol( "export-chunked.cvol" );
+  nbok += sameValues( image, image2 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "whole image" << std::endl;
+
+  const Z3i::Domain block( Z3i::Point( 4, 3, 9 ), Z3i::Point( 13, 11, 10 ) );
+  const Image image3 = ChunkedVolReader<Image>::importChunkedVol( "export-chunked.cvol", block );
+  bool allFine = image3.domain().lowerBound() == block.lowerBound()
+    && image3.domain().upperBound() == block.upperBound();
+  for ( auto const & p : block )
+    allFine &= image3( p ) == image( p );
+  nbok += allFine ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "block" << std::endl;
+
+  typedef ImageContainerBySTLVector<Z2i::Domain, double> Image2D;
+  Image2D image2D( Z2i::Domain( Z2i::Point( 0, 0 ), Z2i::Point( 99, 70 ) ) );
+  fillImage( image2D );
+  ChunkedVolWriter<Image2D>::exportChunkedVol( "export-chunked-2d.cvol", image2D );
+  nbok += sameValues( image2D, ChunkedVolReader<Image2D>::importChunkedVol( "export-chunked-2d.cvol" ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "2D image" << std::endl;
+
+  bool error = false;
+  try
+    {
+      ChunkedVolReader<ImageContainerBySTLVector<Z3i::Domain, DGtal::uint32_t> >
+        ::importChunkedVol( "export-chunked.cvol" );
+    }
+  catch ( IOException & )
+    {
+      error = true;
+    }
+  nbok += error ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "value size mismatch" << std::endl;
+
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+/**
+ * Bricks paged by a TiledImage through ImageFactoryFromChunkedVol.
+ *
+ */
+bool testImageFactoryFromChunkedVol()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing ImageFactoryFromChunkedVol ..." );
+
+  typedef ImageContainerBySTLVector<Z3i::Domain, unsigned char> Image;
+  typedef ImageFactoryFromChunkedVol<Image> Factory;
+  typedef ImageCacheReadPolicyFIFO<Image, Factory> ReadPolicy;
+  typedef ImageCacheWritePolicyWT<Image, Factory> WritePolicy;
+  typedef TiledImage<Image, Factory, ReadPolicy, WritePolicy> Tiled;
+
+  Image image( Z3i::Domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 31, 31, 31 ) ) );
+  fillImage( image );
+  ChunkedVolWriter<Image>::exportChunkedVol( "export-chunked-tiled.cvol", image, Z3i::Vector::diagonal( 8 ) );
+
+  {
+    Factory factory( "export-chunked-tiled.cvol" );
+    trace.info() << factory << std::endl;
+    ReadPolicy readPolicy( factory, 4 );
+    WritePolicy writePolicy( factory );
+    Tiled tiled( factory, readPolicy, writePolicy, 4 );
+
+    bool allFine = factory.isValid();
+    for ( auto const & p : image.domain() )
+      allFine &= tiled( p ) == image( p );
+    nbok += allFine ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") "
+                 << "read through the tiles" << std::endl;
+
+    for ( auto const & p : Z3i::Domain( Z3i::Point( 5, 6, 7 ), Z3i::Point( 20, 9, 8 ) ) )
+      {
+        image.setValue( p, static_cast<unsigned char>( p[ 0 ] + p[ 1 ] + p[ 2 ] ) );
+        tiled.setValue( p, static_cast<unsigned char>( p[ 0 ] + p[ 1 ] + p[ 2 ] ) );
+      }
+  }
+
+  nbok += sameValues( image, ChunkedVolReader<Image>::importChunkedVol( "export-chunked-tiled.cvol" ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "flushed bricks" << std::endl;
+
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+/**
+ * Rejection of files that are not chunked volumes.
+ *
+ */
+bool testBadChunkedVol()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing bad chunked volumes ..." );
+
+  {
+    std::ofstream out( "export-chunked-bad.cvol", std::ios::out | std::ios::binary );
+    out << "Chunked-Vol: 1\nDimension: 3\nLower: 0 0 0\nUpper: 9 9 9\nBrick: 4 4 4\nValue-Size: 1\n.\n";
+    out << "truncated index";
+  }
+
+  typedef ImageContainerBySTLVector<Z3i::Domain, unsigned char> Image;
+  bool error = false;
+  try
+    {
+      ChunkedVolReader<Image>::importChunkedVol( "export-chunked-bad.cvol" );
+    }
+  catch ( IOException & )
+    {
+      error = true;
+    }
+  nbok += error ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "truncated index" << std::endl;
+
+  // Malformed numeric fields are rejected with an IOException.
+  const std::vector<std::string> badFields =
+    { "Chunked-Vol: one\nDimension: 3", "Chunked-Vol: 1\nDimension: -3",
+      "Chunked-Vol: 1\nDimension: 3x" };
+  for ( auto const & fields : badFields )
+    {
+      {
+        std::ofstream out( "export-chunked-bad.cvol", std::ios::out | std::ios::binary );
+        out << fields << "\nLower: 0 0 0\nUpper: 9 9 9\nBrick: 4 4 4\nValue-Size: 1\n.\n";
+      }
+      error = false;
+      try
+        {
+          ChunkedVolReader<Image>::importChunkedVol( "export-chunked-bad.cvol" );
+        }
+      catch ( IOException & )
+        {
+          error = true;
+        }
+      nbok += error ? 1 : 0;
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+                   << "bad header field" << std::endl;
+    }
+
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing chunked volumes" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  // Several threads, even on a single core machine.
+  WorkStealingScheduler::setNumberOfThreads( 4 );
+  bool res = testChunkedVol() && testImageFactoryFromChunkedVol()
+    && testBadChunkedVol(); // && ... other tests
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -82,6 +82,50 @@ bool testLongvol()
   return nbok == nb;
 }
 
+/**
+ * Memory-mapped import of compressed and uncompressed files.
+ *
+ */
+bool testMapLongvol()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  
+  trace.beginBlock ( "Testing Longvol mapping ..." );
+
+  typedef ImageContainerBySTLVector<Z3i::Domain, DGtal::uint64_t> Image;
+  Image image(Z3i::Domain(Z3i::Point(-3,0,2), Z3i::Point(9,6,11)));
+  DGtal::uint64_t v = 1;
+  for(Image::Iterator it = image.begin(), itend = image.end(); it != itend; ++it)
+    {
+      *it = v;
+      v = v * 0X5851F42D4C957F2Dull + 1;
+    }
+
+  LongvolWriter<Image>::exportLongvol("export-longvol-raw.longvol", image, false);
+  LongvolWriter<Image>::exportLongvol("export-longvol-compressed.longvol", image, true);
+
+  for ( const std::string filename : { "export-longvol-raw.longvol", "export-longvol-compressed.longvol" } )
+    {
+      const MemoryMappedImage<Z3i::Domain, DGtal::uint64_t> mapped
+        = LongvolReader<Image>::mapLongvol( filename );
+      trace.info() << mapped << std::endl;
+
+      bool allFine = ( mapped.domain().lowerBound() == image.domain().lowerBound() )
+        && ( mapped.domain().upperBound() == image.domain().upperBound() );
+      for ( auto const & p : image.domain() )
+        allFine &= mapped( p ) == image( p );
+
+      nbok += allFine ? 1 : 0; 
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+                   << filename << std::endl;
+    }
+  trace.endBlock();
+  
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -93,7 +137,7 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testLongvol(); // && ... other tests
+  bool res = testLongvol() && testMapLongvol(); // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
@@ -39,6 +39,7 @@
 #include "DGtal/kernel/SpaceND.h"
 #include "DGtal/kernel/PointVector.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/images/ImageRowSpans.h"
 
 using namespace DGtal;
 using namespace std;
@@ -122,10 +123,28 @@ BENCHMARK_DEFINE_F(BenchDomain, DomainReverseTraversalSubRange)(benchmark::State
   state.SetItemsProcessed(domain.size() * state.iterations());
 }
 
+BENCHMARK_DEFINE_F(BenchDomain, DomainTraversalRows)(benchmark::State& state)
+{
+  for (auto _ : state)
+    {
+      Point check;
+      functions::forEachRow(domain, [&check] (Point const& first, std::size_t length)
+        {
+          Point pt = first;
+          for (std::size_t i = 0; i < length; ++i, ++pt[0])
+            check += pt;
+        });
+      benchmark::DoNotOptimize(check);
+    }
+
+  state.SetItemsProcessed(domain.size() * state.iterations());
+}
+
 BENCHMARK_REGISTER_F(BenchDomain, DomainTraversal)->Unit(benchmark::kMillisecond);
 BENCHMARK_REGISTER_F(BenchDomain, DomainReverseTraversal)->Unit(benchmark::kMillisecond);
 BENCHMARK_REGISTER_F(BenchDomain, DomainTraversalSubRange)->Unit(benchmark::kMillisecond);
 BENCHMARK_REGISTER_F(BenchDomain, DomainReverseTraversalSubRange)->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(BenchDomain, DomainTraversalRows)->Unit(benchmark::kMillisecond);
 
 int main(int argc, char* argv[])
 {
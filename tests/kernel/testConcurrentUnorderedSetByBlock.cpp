@@ -0,0 +1,197 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testConcurrentUnorderedSetByBlock.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing class ConcurrentUnorderedSetByBlock.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <atomic>
+#include <unordered_set>
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/kernel/sets/CDigitalSet.h"
+#include "DGtal/kernel/ConcurrentUnorderedSetByBlock.h"
+#include "DGtal/base/WorkStealingScheduler.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef Z3i::Point                                             Point;
+typedef ConcurrentUnorderedSetByBlock< Point >                 BlockSet;
+typedef ConcurrentUnorderedSetByBlock< Point, Splitter< Point, uint64_t > > BlockSet64;
+
+BOOST_CONCEPT_ASSERT(( concepts::CDigitalSet< DigitalSetByConcurrentBlocks< Z3i::Domain > > ));
+BOOST_STATIC_ASSERT(( IsConcurrentDigitalSet< DigitalSetByConcurrentBlocks< Z3i::Domain > >::value ));
+BOOST_STATIC_ASSERT(( ! IsConcurrentDigitalSet< Z3i::DigitalSet >::value ));
+
+static Point randomPoint( int S )
+{
+  return Point( rand() % S - S/2, rand() % S - S/2, rand() % S - S/2 );
+}
+
+template < typename Set >
+static std::vector< Point > sorted( const Set & S )
+{
+  std::vector< Point > V( S.begin(), S.end() );
+  std::sort( V.begin(), V.end() );
+  return V;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ConcurrentUnorderedSetByBlock.
+///////////////////////////////////////////////////////////////////////////////
+
+TEMPLATE_TEST_CASE( "ConcurrentUnorderedSetByBlock sequential services",
+                    "[concurrentunorderedsetbyblock]", BlockSet, BlockSet64 )
+{
+  srand( 0 );
+  std::unordered_set< Point > stdSet;
+  TestType blkSet( 8 );
+  for ( unsigned int i = 0; i < 5000; i++ )
+    {
+      const Point p = randomPoint( 40 );
+      const auto res = blkSet.insert( p );
+      REQUIRE( res.second == stdSet.insert( p ).second );
+      REQUIRE( *res.first == p );
+    }
+  REQUIRE( blkSet.shards() == 8 );
+  WHEN( "Inserting identical elements, they contain the same elements" ) {
+    REQUIRE( blkSet.size() == stdSet.size() );
+    REQUIRE( sorted( blkSet ) == sorted( stdSet ) );
+    REQUIRE( blkSet.blocks() < blkSet.size() );
+  }
+  WHEN( "Looking for elements, count and find agree with std::unordered_set" ) {
+    unsigned int nb_ok = 0;
+    for ( unsigned int i = 0; i < 2000; i++ )
+      {
+        const Point p = randomPoint( 44 );
+        const bool in = stdSet.count( p ) != 0;
+        const auto it = blkSet.find( p );
+        if ( ( blkSet.count( p ) != 0 ) == in && ( it != blkSet.end() ) == in
+             && ( ! in || *it == p ) )
+          nb_ok++;
+      }
+    REQUIRE( nb_ok == 2000 );
+  }
+  WHEN( "Erasing elements by key, iterator and range" ) {
+    std::vector< Point > V( stdSet.begin(), stdSet.end() );
+    for ( std::size_t i = 0; i < V.size(); i += 2 )
+      {
+        REQUIRE( blkSet.erase( V[ i ] ) == 1 );
+        REQUIRE( blkSet.erase( V[ i ] ) == 0 );
+        stdSet.erase( V[ i ] );
+      }
+    REQUIRE( blkSet.size() == stdSet.size() );
+    REQUIRE( sorted( blkSet ) == sorted( stdSet ) );
+    auto first = blkSet.begin();
+    std::advance( first, 100 );
+    auto last = first;
+    std::advance( last, 500 );
+    for ( auto it = first; it != last; ++it ) stdSet.erase( *it );
+    blkSet.erase( first, last );
+    REQUIRE( blkSet.size() == stdSet.size() );
+    REQUIRE( sorted( blkSet ) == sorted( stdSet ) );
+  }
+  WHEN( "Copying, moving and clearing" ) {
+    TestType other( blkSet );
+    REQUIRE( sorted( other ) == sorted( stdSet ) );
+    TestType moved( std::move( other ) );
+    REQUIRE( moved.size() == stdSet.size() );
+    REQUIRE( other.empty() );
+    moved.clear();
+    REQUIRE( moved.empty() );
+    REQUIRE( moved.begin() == moved.end() );
+  }
+  WHEN( "Inserting whole blocks" ) {
+    TestType S;
+    const auto w = Bits::nbSetBits( typename TestType::Word( -1 ) );
+    REQUIRE( S.insert_block( Point( 0, 1, 2 ), 0x0F ) == 4 );
+    REQUIRE( S.insert_block( Point( 0, 1, 2 ), 0xFF ) == 4 );
+    REQUIRE( S.insert_block( Point( w, 1, 2 ), 0 ) == 0 );
+    REQUIRE( S.size() == 8 );
+    REQUIRE( S.count( Point( 7, 1, 2 ) ) == 1 );
+    REQUIRE( S.count( Point( 8, 1, 2 ) ) == 0 );
+    REQUIRE( S.blocks() == 1 );
+  }
+}
+
+SCENARIO( "ConcurrentUnorderedSetByBlock concurrent insertions", "[concurrentunorderedsetbyblock]" )
+{
+  // Each point is inserted by several threads.
+  const int n = 48;
+  std::vector< Point > V;
+  for ( int z = 0; z < n; ++z )
+    for ( int y = 0; y < n; ++y )
+      for ( int x = -n; x < n; ++x )
+        if ( ( x * 7 + y * 3 + z ) % 5 != 0 )
+          V.push_back( Point( x, y, z ) );
+  const std::size_t nbRepeat = 4;
+  // Several threads, even on a single core machine.
+  WorkStealingScheduler::setNumberOfThreads( 4 );
+  BlockSet S;
+  std::atomic< std::size_t > nbInserted( 0 );
+  WorkStealingScheduler::forEach( V.size() * nbRepeat,
+    [&] ( std::size_t first, std::size_t last, unsigned int )
+    {
+      std::size_t nb = 0;
+      for ( std::size_t i = first; i < last; ++i )
+        nb += S.insert( V[ i % V.size() ] ).second ? 1 : 0;
+      nbInserted += nb;
+    } );
+  THEN( "Each point is inserted exactly once" ) {
+    REQUIRE( nbInserted == V.size() );
+    REQUIRE( S.size() == V.size() );
+    std::sort( V.begin(), V.end() );
+    REQUIRE( sorted( S ) == V );
+  }
+  THEN( "Visiting the blocks in parallel gives all the points" ) {
+    std::vector< std::size_t > counts( WorkStealingScheduler::numberOfThreads(), 0 );
+    S.for_each_block( [&counts] ( const Point &, BlockSet::Word w, unsigned int thread )
+                      { counts[ thread ] += Bits::nbSetBits( w ); } );
+    std::size_t total = 0;
+    for ( auto c : counts ) total += c;
+    REQUIRE( total == V.size() );
+  }
+  THEN( "A digital set can be filled concurrently" ) {
+    const Z3i::Domain domain( Point( -n, 0, 0 ), Point( n, n, n ) );
+    DigitalSetByConcurrentBlocks< Z3i::Domain > D( domain );
+    WorkStealingScheduler::forEach( V.size(),
+      [&] ( std::size_t first, std::size_t last, unsigned int )
+      {
+        for ( std::size_t i = first; i < last; ++i ) D.insert( V[ i ] );
+      } );
+    REQUIRE( D.size() == V.size() );
+    unsigned int nb_ok = 0;
+    for ( auto p : V ) nb_ok += D( p ) ? 1 : 0;
+    REQUIRE( nb_ok == V.size() );
+  }
+  WorkStealingScheduler::setNumberOfThreads( 0 );
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
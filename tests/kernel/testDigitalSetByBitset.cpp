@@ -0,0 +1,266 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testDigitalSetByBitset.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing class DigitalSetByBitset.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <set>
+#include <algorithm>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/SetFunctions.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/kernel/sets/CDigitalSet.h"
+#include "DGtal/kernel/sets/DigitalSetByBitset.h"
+#include "DGtal/kernel/sets/DigitalSetSelector.h"
+#include "DGtal/topology/Object.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef Z3i::Domain                  Domain;
+typedef Z3i::Point                   Point;
+typedef Z3i::Vector                  Vector;
+typedef DigitalSetByBitset< Domain > BitSet;
+
+BOOST_CONCEPT_ASSERT(( concepts::CDigitalSet< BitSet > ));
+BOOST_STATIC_ASSERT(( boost::is_same< DigitalSetSelector< Domain, WHOLE_DS+HIGH_BEL_DS >::Type,
+                                      BitSet >::value ));
+
+static std::set< Point > toSet( const BitSet & S )
+{
+  return std::set< Point >( S.begin(), S.end() );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class DigitalSetByBitset.
+///////////////////////////////////////////////////////////////////////////////
+
+SCENARIO( "DigitalSetByBitset set services", "[digital_set][bitset]" )
+{
+  // Rows of 136 points: two full words and a padded one.
+  const Domain domain( Point( -5, -4, -3 ), Point( 130, 6, 4 ) );
+  srand( 0 );
+  std::set< Point > S;
+  BitSet            B( domain );
+  for ( unsigned int i = 0; i < 3000; i++ )
+    {
+      const Point p( rand() % 136 - 5, rand() % 11 - 4, rand() % 8 - 3 );
+      S.insert( p );
+      B.insert( p );
+    }
+  WHEN( "Inserting random points" ) {
+    THEN( "It contains the same points as std::set< Point >, in the same order" ) {
+      REQUIRE( B.isValid() );
+      REQUIRE( B.size() == S.size() );
+      REQUIRE( toSet( B ) == S );
+      REQUIRE( std::is_sorted( B.begin(), B.end(),
+                               [] ( const Point & p, const Point & q )
+                               { return std::lexicographical_compare
+                                   ( p.rbegin(), p.rend(), q.rbegin(), q.rend() ); } ) );
+      REQUIRE( B.words().size() == 3 * 11 * 8 );
+    }
+    THEN( "Membership and find agree with std::set< Point >" ) {
+      unsigned int nb_ok = 0;
+      for ( auto p : domain )
+        {
+          const bool in = S.count( p ) != 0;
+          if ( B( p ) == in && ( B.find( p ) != B.end() ) == in
+               && ( ! in || *B.find( p ) == p ) )
+            nb_ok++;
+        }
+      REQUIRE( nb_ok == domain.size() );
+      REQUIRE( ! B( Point( 131, 0, 0 ) ) );
+      REQUIRE( B.find( Point( -6, 0, 0 ) ) == B.end() );
+    }
+    THEN( "Iterating from find visits the remaining points" ) {
+      auto it = B.begin();
+      std::advance( it, B.size() / 2 );
+      REQUIRE( std::distance( B.find( *it ), B.end() )
+               == (std::ptrdiff_t) ( B.size() - B.size() / 2 ) );
+    }
+    THEN( "The bounding box is the one of the points" ) {
+      Point lo, up;
+      B.computeBoundingBox( lo, up );
+      Point elo = *S.begin(), eup = *S.begin();
+      for ( auto p : S ) { elo = elo.inf( p ); eup = eup.sup( p ); }
+      REQUIRE( lo == elo );
+      REQUIRE( up == eup );
+    }
+  }
+  WHEN( "Erasing points" ) {
+    std::vector< Point > V( S.begin(), S.end() );
+    for ( std::size_t i = 0; i < V.size(); i += 3 )
+      {
+        S.erase( V[ i ] );
+        REQUIRE( B.erase( V[ i ] ) == 1 );
+        REQUIRE( B.erase( V[ i ] ) == 0 );
+      }
+    B.erase( B.find( V[ 1 ] ) );
+    S.erase( V[ 1 ] );
+    auto first = B.begin();
+    std::advance( first, 10 );
+    auto last = first;
+    std::advance( last, 100 );
+    std::vector< Point > W( first, last );
+    B.erase( first, last );
+    for ( auto p : W ) S.erase( p );
+    THEN( "It contains the same points as std::set< Point >" ) {
+      REQUIRE( B.isValid() );
+      REQUIRE( B.size() == S.size() );
+      REQUIRE( toSet( B ) == S );
+    }
+  }
+  WHEN( "Computing the complement" ) {
+    BitSet C( domain );
+    C.assignFromComplement( B );
+    std::vector< Point > V;
+    auto out = std::back_inserter( V );
+    B.computeComplement( out );
+    THEN( "The complement and the set partition the domain" ) {
+      REQUIRE( C.isValid() );
+      REQUIRE( C.size() + B.size() == domain.size() );
+      REQUIRE( V.size() == C.size() );
+      REQUIRE( toSet( C ) == std::set< Point >( V.begin(), V.end() ) );
+      REQUIRE( functions::makeIntersection( C, B ).empty() );
+    }
+  }
+}
+
+SCENARIO( "DigitalSetByBitset set operations", "[digital_set][bitset]" )
+{
+  using namespace functions::setops;
+  const Domain domain( Point( 0, 0, 0 ), Point( 99, 7, 3 ) );
+  srand( 1 );
+  std::vector< Point > A, B;
+  for ( auto p : domain )
+    {
+      if ( ( p[ 0 ] + 3 * p[ 1 ] ) % 7 < 4 || rand() % 10 == 0 ) A.push_back( p );
+      if ( ( 2 * p[ 0 ] + p[ 2 ] ) % 5 < 3 || rand() % 10 == 0 ) B.push_back( p );
+    }
+  BitSet BA( domain ), BB( domain );
+  BA.insert( A.begin(), A.end() );
+  BB.insert( B.begin(), B.end() );
+  std::set< Point > SA( A.begin(), A.end() ), SB( B.begin(), B.end() );
+  THEN( "Union, intersection, differences are the same as with std::set< Point >" ) {
+    REQUIRE( toSet( BA | BB ) == ( SA | SB ) );
+    REQUIRE( toSet( BA & BB ) == ( SA & SB ) );
+    REQUIRE( toSet( BA - BB ) == ( SA - SB ) );
+    REQUIRE( toSet( BB - BA ) == ( SB - SA ) );
+    REQUIRE( toSet( BA ^ BB ) == ( SA ^ SB ) );
+    REQUIRE( ( BA | BB ).size() == ( SA | SB ).size() );
+    REQUIRE( ( BA ^ BB ).isValid() );
+  }
+  THEN( "Inclusion and equality are consistent" ) {
+    REQUIRE( functions::isSubset( BA & BB, BA ) );
+    REQUIRE( functions::isSubset( BB, BA | BB ) );
+    REQUIRE( ! functions::isSubset( BA, BB ) );
+    REQUIRE( functions::isEqual( ( BA - BB ) | ( BA & BB ), BA ) );
+    REQUIRE( ! functions::isEqual( BA, BB ) );
+  }
+  THEN( "The operations work in place" ) {
+    BitSet C( BA );
+    C += BB;
+    REQUIRE( functions::isEqual( C, BA | BB ) );
+    C -= BB;
+    REQUIRE( functions::isEqual( C, BA - BB ) );
+    C ^= BA;
+    REQUIRE( functions::isEqual( C, BA & BB ) );
+    C &= BB;
+    REQUIRE( functions::isEqual( C, BA & BB ) );
+    C ^= C;
+    REQUIRE( C.empty() );
+  }
+}
+
+SCENARIO( "DigitalSetByBitset morphology", "[digital_set][bitset]" )
+{
+  const Domain domain( Point( -70, -3, -2 ), Point( 80, 4, 2 ) );
+  srand( 2 );
+  BitSet X( domain );
+  for ( auto p : domain )
+    if ( rand() % 4 == 0 ) X.insert( p );
+  // Shifts within a word, by whole words and across words.
+  const std::vector< Vector > SE =
+    { Vector( 0, 0, 0 ), Vector( 1, 0, 0 ), Vector( -3, 1, 0 ),
+      Vector( 64, 0, 1 ), Vector( -70, -2, 0 ), Vector( 129, 0, -1 ) };
+  THEN( "Dilation is the union of the translated sets" ) {
+    const BitSet D = X.dilation( SE );
+    BitSet E( domain );
+    for ( auto p : X )
+      for ( auto v : SE )
+        if ( domain.isInside( p + v ) ) E.insert( p + v );
+    REQUIRE( D.isValid() );
+    REQUIRE( functions::isEqual( D, E ) );
+  }
+  THEN( "Erosion keeps the points whose translates all belong to the set" ) {
+    const BitSet D = X.dilation( SE );
+    const std::vector< Vector > ball = { Vector( 0, 0, 0 ), Vector( 1, 0, 0 ), Vector( -1, 0, 0 ),
+                                         Vector( 0, 1, 0 ), Vector( 0, -1, 0 ) };
+    const BitSet R = D.erosion( ball );
+    BitSet E( domain );
+    for ( auto p : domain )
+      {
+        bool in = true;
+        for ( auto v : ball ) in = in && D( p + v );
+        if ( in ) E.insert( p );
+      }
+    REQUIRE( R.isValid() );
+    REQUIRE( functions::isEqual( R, E ) );
+    REQUIRE( functions::isSubset( R, D ) );
+    REQUIRE( X.erosion( std::vector< Vector >() ).size() == domain.size() );
+  }
+}
+
+SCENARIO( "DigitalSetByBitset in a digital object", "[digital_set][bitset][object]" )
+{
+  typedef Object< Z3i::DT26_6, BitSet > BitObject;
+  const Domain domain( Point( -10, -10, -10 ), Point( 10, 10, 10 ) );
+  BitSet           B( domain );
+  Z3i::DigitalSet  S( domain );
+  for ( auto p : domain )
+    if ( p.squaredNorm() <= 64 ) { B.insert( p ); S.insert( p ); }
+  BitObject      objB( Z3i::dt26_6, B );
+  Z3i::Object26_6 objS( Z3i::dt26_6, S );
+  THEN( "The border is the same as with the default digital set" ) {
+    const auto borderB = objB.border();
+    const auto borderS = objS.border();
+    REQUIRE( borderB.size() == borderS.size() );
+    REQUIRE( toSet( borderB.pointSet() )
+             == std::set< Point >( borderS.pointSet().begin(), borderS.pointSet().end() ) );
+  }
+  THEN( "The memory is one bit per point of the domain" ) {
+    const Domain rows( Point( 0, 0, 0 ), Point( 1023, 15, 15 ) );
+    const BitSet  E( rows );
+    REQUIRE( E.words().size() == rows.size() / 64 );
+    REQUIRE( E.memoryUsage() == sizeof( BitSet ) + rows.size() / 8 );
+  }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
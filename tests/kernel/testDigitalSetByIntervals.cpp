@@ -0,0 +1,248 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testDigitalSetByIntervals.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing classes DigitalSetByIntervals and
+ * ImageContainerByIntervals.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <set>
+#include <algorithm>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/SetFunctions.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/kernel/sets/CDigitalSet.h"
+#include "DGtal/kernel/sets/DigitalSetByIntervals.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/images/ImageContainerByIntervals.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef Z3i::Domain                                      Domain;
+typedef Z3i::Point                                       Point;
+typedef DigitalSetByIntervals< Domain >                  RunSet;
+typedef ImageContainerBySTLVector< Domain, unsigned char > Image;
+
+BOOST_CONCEPT_ASSERT(( concepts::CDigitalSet< RunSet > ));
+BOOST_CONCEPT_ASSERT(( concepts::CImage< ImageContainerByIntervals< Domain > > ));
+
+static std::set< Point > toSet( const RunSet & S )
+{
+  return std::set< Point >( S.begin(), S.end() );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class DigitalSetByIntervals.
+///////////////////////////////////////////////////////////////////////////////
+
+SCENARIO( "DigitalSetByIntervals set services", "[digital_set][intervals]" )
+{
+  const Domain domain( Point( -5, -4, -3 ), Point( 12, 6, 4 ) );
+  srand( 0 );
+  std::set< Point > S;
+  RunSet            R( domain );
+  for ( unsigned int i = 0; i < 2000; i++ )
+    {
+      const Point p( rand() % 18 - 5, rand() % 11 - 4, rand() % 8 - 3 );
+      S.insert( p );
+      R.insert( p );
+    }
+  WHEN( "Inserting random points" ) {
+    THEN( "It contains the same points as std::set< Point >" ) {
+      REQUIRE( R.isValid() );
+      REQUIRE( R.size() == S.size() );
+      REQUIRE( toSet( R ) == S );
+      REQUIRE( std::distance( R.begin(), R.end() ) == (std::ptrdiff_t) S.size() );
+      REQUIRE( R.nbRuns() < R.size() );
+    }
+    THEN( "Membership and find agree with std::set< Point >" ) {
+      unsigned int nb_ok = 0;
+      for ( auto p : domain )
+        {
+          const bool in = S.count( p ) != 0;
+          if ( R( p ) == in && ( R.find( p ) != R.end() ) == in
+               && ( ! in || *R.find( p ) == p ) )
+            nb_ok++;
+        }
+      REQUIRE( nb_ok == domain.size() );
+    }
+    THEN( "Iterating from find visits the remaining points" ) {
+      auto it = R.begin();
+      std::advance( it, R.size() / 2 );
+      REQUIRE( std::distance( R.find( *it ), R.end() )
+               == (std::ptrdiff_t) ( R.size() - R.size() / 2 ) );
+    }
+    THEN( "The bounding box is the one of the points" ) {
+      Point lo, up;
+      R.computeBoundingBox( lo, up );
+      Point elo = *S.begin(), eup = *S.begin();
+      for ( auto p : S ) { elo = elo.inf( p ); eup = eup.sup( p ); }
+      REQUIRE( lo == elo );
+      REQUIRE( up == eup );
+    }
+  }
+  WHEN( "Erasing points" ) {
+    std::vector< Point > V( S.begin(), S.end() );
+    for ( std::size_t i = 0; i < V.size(); i += 3 )
+      {
+        S.erase( V[ i ] );
+        REQUIRE( R.erase( V[ i ] ) == 1 );
+        REQUIRE( R.erase( V[ i ] ) == 0 );
+      }
+    R.erase( R.find( V[ 1 ] ) );
+    S.erase( V[ 1 ] );
+    THEN( "It contains the same points as std::set< Point >" ) {
+      REQUIRE( R.isValid() );
+      REQUIRE( R.size() == S.size() );
+      REQUIRE( toSet( R ) == S );
+    }
+  }
+  WHEN( "Computing the complement" ) {
+    RunSet C( domain );
+    C.assignFromComplement( R );
+    std::vector< Point > V;
+    auto out = std::back_inserter( V );
+    R.computeComplement( out );
+    THEN( "The complement and the set partition the domain" ) {
+      REQUIRE( C.size() + R.size() == domain.size() );
+      REQUIRE( V.size() == C.size() );
+      REQUIRE( toSet( C ) == std::set< Point >( V.begin(), V.end() ) );
+      REQUIRE( functions::makeIntersection( C, R ).empty() );
+    }
+  }
+  WHEN( "Inserting runs" ) {
+    RunSet T( domain );
+    T.insertRun( Point( 0, 0, 0 ), Point( 5, 0, 0 ) );
+    T.insertRun( Point( 7, 0, 0 ), Point( 9, 0, 0 ) );
+    T.insertRun( Point( 4, 0, 0 ), Point( 6, 0, 0 ) );
+    T.insertRun( Point( 3, 1, 0 ), Point( 3, 1, 0 ) );
+    std::vector< std::pair< Point, Point > > runs;
+    T.forEachRun( [&] ( const Point & f, const Point & l )
+                  { runs.emplace_back( f, l ); } );
+    THEN( "Adjacent runs are merged" ) {
+      REQUIRE( T.size() == 11 );
+      REQUIRE( T.nbRuns() == 2 );
+      REQUIRE( runs.size() == 2 );
+      REQUIRE( std::count( runs.begin(), runs.end(),
+                           std::make_pair( Point( 0, 0, 0 ), Point( 9, 0, 0 ) ) ) == 1 );
+      REQUIRE( std::count( runs.begin(), runs.end(),
+                           std::make_pair( Point( 3, 1, 0 ), Point( 3, 1, 0 ) ) ) == 1 );
+    }
+  }
+}
+
+SCENARIO( "DigitalSetByIntervals set operations", "[digital_set][intervals]" )
+{
+  using namespace functions::setops;
+  const Domain domain( Point( 0, 0, 0 ), Point( 15, 7, 3 ) );
+  srand( 1 );
+  std::vector< Point > A, B;
+  // Long runs with holes, so that the operations split and merge runs.
+  for ( auto p : domain )
+    {
+      if ( ( p[ 0 ] + 3 * p[ 1 ] ) % 7 < 4 || rand() % 10 == 0 ) A.push_back( p );
+      if ( ( 2 * p[ 0 ] + p[ 2 ] ) % 5 < 3 || rand() % 10 == 0 ) B.push_back( p );
+    }
+  RunSet RA( domain ), RB( domain );
+  RA.insert( A.begin(), A.end() );
+  RB.insert( B.begin(), B.end() );
+  std::set< Point > SA( A.begin(), A.end() ), SB( B.begin(), B.end() );
+  THEN( "Union, intersection, differences are the same as with std::set< Point >" ) {
+    REQUIRE( toSet( RA | RB ) == ( SA | SB ) );
+    REQUIRE( toSet( RA & RB ) == ( SA & SB ) );
+    REQUIRE( toSet( RA - RB ) == ( SA - SB ) );
+    REQUIRE( toSet( RB - RA ) == ( SB - SA ) );
+    REQUIRE( toSet( RA ^ RB ) == ( SA ^ SB ) );
+    REQUIRE( ( RA | RB ).size() == ( SA | SB ).size() );
+    REQUIRE( ( RA ^ RB ).isValid() );
+  }
+  THEN( "Inclusion and equality are consistent" ) {
+    REQUIRE( functions::isSubset( RA & RB, RA ) );
+    REQUIRE( functions::isSubset( RB, RA | RB ) );
+    REQUIRE( ! functions::isSubset( RA, RB ) );
+    REQUIRE( functions::isEqual( ( RA - RB ) | ( RA & RB ), RA ) );
+    REQUIRE( ! functions::isEqual( RA, RB ) );
+  }
+  THEN( "The operations work in place" ) {
+    RunSet C( RA );
+    C += RB;
+    REQUIRE( functions::isEqual( C, RA | RB ) );
+    C -= RB;
+    REQUIRE( functions::isEqual( C, RA - RB ) );
+    C ^= RA;
+    REQUIRE( functions::isEqual( C, RA & RB ) );
+    C &= RB;
+    REQUIRE( functions::isEqual( C, RA & RB ) );
+    C ^= C;
+    REQUIRE( C.empty() );
+  }
+}
+
+SCENARIO( "DigitalSetByIntervals conversions", "[digital_set][intervals][image]" )
+{
+  const Domain domain( Point( -20, -20, -20 ), Point( 20, 20, 20 ) );
+  Image image( domain );
+  std::size_t nb = 0;
+  for ( auto p : domain )
+    if ( p.squaredNorm() <= 18 * 18 || ( p[ 0 ] == 20 && p[ 1 ] == 20 ) )
+      { image.setValue( p, 7 ); nb++; }
+  const RunSet R = functions::digitalSetByIntervalsFromImage( image );
+  THEN( "The runs of a ball are much smaller than its points" ) {
+    REQUIRE( R.size() == nb );
+    REQUIRE( R.nbRuns() == R.latticeSet().data().size() );
+    REQUIRE( R.memoryUsage() * 4 < R.size() * sizeof( Point ) );
+  }
+  THEN( "Converting back gives the same image" ) {
+    Image other( domain );
+    functions::copyToImage( R, other, (unsigned char) 7 );
+    REQUIRE( std::equal( image.begin(), image.end(), other.begin() ) );
+  }
+  THEN( "The binary image gives the same values" ) {
+    ImageContainerByIntervals< Domain, unsigned char > binary( R, 7 );
+    REQUIRE( std::equal( image.constRange().begin(), image.constRange().end(),
+                         binary.constRange().begin() ) );
+    binary.setValue( Point( 0, 0, 0 ), 0 );
+    binary.setValue( Point( 20, -20, 20 ), 3 );
+    REQUIRE( binary( Point( 0, 0, 0 ) ) == 0 );
+    REQUIRE( binary( Point( 20, -20, 20 ) ) == 7 );
+    REQUIRE( binary.digitalSet().size() == nb );
+  }
+  THEN( "Writing and reading a vol file gives the same set" ) {
+    REQUIRE( functions::exportVolByIntervals( "testDigitalSetByIntervals.vol", R ) );
+    const RunSet S = functions::importVolByIntervals< Domain >( "testDigitalSetByIntervals.vol" );
+    REQUIRE( S.domain().lowerBound() == domain.lowerBound() );
+    REQUIRE( S.domain().upperBound() == domain.upperBound() );
+    REQUIRE( functions::isEqual( R, S ) );
+    const Image I = VolReader< Image >::importVol( "testDigitalSetByIntervals.vol" );
+    REQUIRE( functions::isEqual( R, functions::digitalSetByIntervalsFromImage( I ) ) );
+  }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
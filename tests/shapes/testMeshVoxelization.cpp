@@ -29,6 +29,7 @@
 #include "ConfigTest.h"
 #include "DGtalCatch.h"
 #include "DGtal/shapes/MeshVoxelizer.h"
+#include "DGtal/base/WorkStealingScheduler.h"
 #include "DGtal/kernel/sets/CDigitalSet.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
 #include "DGtal/io/readers/MeshReader.h"
@@ -228,4 +229,29 @@ TEST_CASE("Basic voxelization test", "[voxelization]")
     //hard coded test.
     REQUIRE( outputSet.size() == 4162 );
   }
+  // ---------------------------------------------------------
+  SECTION("26-sep voxelization of a OFF cube mesh into a concurrent set")
+  {
+    Mesh<Z3i::RealPoint> inputMesh;
+    MeshReader<Z3i::RealPoint>::importOFFFile(testPath +"/samples/box.off" , inputMesh);
+    Z3i::Domain domain( Point().diagonal(-30), Point().diagonal(30));
+    using ConcurrentSet = DigitalSetByConcurrentBlocks<Z3i::Domain>;
+    ConcurrentSet outputSet(domain);
+    DigitalSet    refSet(domain);
+    MeshVoxelizer<ConcurrentSet, 26> voxelizer;
+    MeshVoxelizer26 refVoxelizer;
+
+    // Several threads insert into the set, even on a single core.
+    WorkStealingScheduler::setNumberOfThreads( 4 );
+    voxelizer.voxelize(outputSet, inputMesh, 10.0 );
+    WorkStealingScheduler::setNumberOfThreads( 0 );
+    refVoxelizer.voxelize(refSet, inputMesh, 10.0 );
+
+    CAPTURE(outputSet.size());
+    REQUIRE( outputSet.size() == 4162 );
+    unsigned int nb_ok = 0;
+    for(auto p: refSet)
+      nb_ok += outputSet( p ) ? 1 : 0;
+    REQUIRE( nb_ok == refSet.size() );
+  }
 }
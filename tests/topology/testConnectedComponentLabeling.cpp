@@ -0,0 +1,155 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testConnectedComponentLabeling.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/17
+ *
+ * This file is part of the DGtal library
+ */
+
+/**
+ * Description of testConnectedComponentLabeling' <p>
+ * Aim: checks that functions::labelConnectedComponents gives the same
+ * components as Object::writeComponents, with Catch unit test
+ * framework.
+ */
+#include <iterator>
+#include <random>
+#include <set>
+#include <vector>
+
+#include "DGtal/base/Common.h"
+#include "DGtal/base/WorkStealingScheduler.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/topology/ConnectedComponentLabeling.h"
+#include "DGtalCatch.h"
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing functions::labelConnectedComponents.
+///////////////////////////////////////////////////////////////////////////////
+
+template < typename TObject >
+TObject randomObject( const typename TObject::DigitalTopology & topo,
+                      const typename TObject::Domain & domain,
+                      double density, unsigned int seed )
+{
+  std::mt19937 gen( seed );
+  std::bernoulli_distribution dist( density );
+  typename TObject::DigitalSet set( domain );
+  for ( const auto & p : domain )
+    if ( dist( gen ) ) set.insertNew( p );
+  return TObject( topo, set );
+}
+
+/// Checks the labels and the sizes against Object::writeComponents.
+template < typename TObject >
+void checkLabels( const TObject & obj, unsigned int nbThreads )
+{
+  typedef ImageContainerBySTLVector< typename TObject::Domain, unsigned int > LabelImage;
+  LabelImage labels( obj.domain() );
+  WorkStealingScheduler::setNumberOfThreads( nbThreads );
+  const auto sizes = functions::labelConnectedComponents( obj, labels );
+  WorkStealingScheduler::setNumberOfThreads( 0 );
+
+  std::vector< TObject > components;
+  std::back_insert_iterator< std::vector< TObject > > it( components );
+  const auto nb = obj.writeComponents( it );
+  REQUIRE( sizes.size() == nb + 1 );
+  CHECK( sizes[ 0 ] == obj.domain().size() - obj.size() );
+
+  std::set< unsigned int > seen;
+  bool same = true;
+  for ( const auto & c : components )
+    {
+      const unsigned int l = labels( *c.pointSet().begin() );
+      same = same && l != 0 && seen.insert( l ).second && sizes[ l ] == c.size();
+      for ( const auto & p : c.pointSet() )
+        same = same && labels( p ) == l;
+    }
+  CHECK( same );
+}
+
+template < typename TObject >
+void checkLabels( const TObject & obj )
+{
+  checkLabels( obj, 1 );
+  checkLabels( obj, 4 );
+}
+
+TEST_CASE( "Labelling 2D objects" )
+{
+  const Z2i::Domain domain( Z2i::Point( -3, 2 ), Z2i::Point( 37, 31 ) );
+  for ( unsigned int seed = 0; seed < 3; ++seed )
+    {
+      checkLabels( randomObject< Z2i::Object4_8 >( Z2i::dt4_8, domain, 0.55, seed ) );
+      checkLabels( randomObject< Z2i::Object8_4 >( Z2i::dt8_4, domain, 0.35, seed ) );
+    }
+}
+
+TEST_CASE( "Labelling 3D objects" )
+{
+  const Z3i::Domain domain( Z3i::Point( 0, -2, 1 ), Z3i::Point( 13, 10, 17 ) );
+  for ( unsigned int seed = 0; seed < 2; ++seed )
+    {
+      checkLabels( randomObject< Z3i::Object6_18 >( Z3i::dt6_18, domain, 0.3, seed ) );
+      checkLabels( randomObject< Z3i::Object18_6 >( Z3i::dt18_6, domain, 0.15, seed ) );
+      checkLabels( randomObject< Z3i::Object26_6 >( Z3i::dt26_6, domain, 0.1, seed ) );
+    }
+  SECTION( "Thin domain, more slabs than planes" )
+    {
+      const Z3i::Domain thin( Z3i::Point( 0, 0, 0 ), Z3i::Point( 30, 20, 1 ) );
+      checkLabels( randomObject< Z3i::Object6_26 >( Z3i::dt6_26, thin, 0.4, 7 ) );
+    }
+}
+
+TEST_CASE( "Labelling binary images with a general metric adjacency" )
+{
+  typedef SpaceND< 4, int >                   Space;
+  typedef HyperRectDomain< Space >            Domain;
+  typedef MetricAdjacency< Space, 2 >         Adj;
+  typedef MetricAdjacency< Space, 4 >         Bg;
+  typedef DigitalTopology< Adj, Bg >          DT;
+  typedef Object< DT, DigitalSetSelector< Domain, BIG_DS + HIGH_BEL_DS >::Type > Obj;
+  typedef ImageContainerBySTLVector< Domain, unsigned char > Image;
+  typedef ImageContainerBySTLVector< Domain, unsigned int >  LabelImage;
+
+  const Domain domain( Space::Point::diagonal( 0 ), Space::Point::diagonal( 6 ) );
+  const Adj adj;
+  const Bg bg;
+  const DT dt( adj, bg, JORDAN_DT );
+  const Obj obj = randomObject< Obj >( dt, domain, 0.1, 3 );
+  checkLabels( obj );
+
+  Image image( domain );
+  for ( const auto & p : obj.pointSet() ) image.setValue( p, 1 );
+  LabelImage labels1( domain ), labelsN( domain );
+  WorkStealingScheduler::setNumberOfThreads( 1 );
+  const auto sizes1 = functions::labelConnectedComponents( image, labels1, adj );
+  WorkStealingScheduler::setNumberOfThreads( 3 );
+  const auto sizesN = functions::labelConnectedComponents( image, labelsN, adj );
+  WorkStealingScheduler::setNumberOfThreads( 0 );
+  CHECK( sizes1 == sizesN );
+  CHECK( std::equal( labels1.begin(), labels1.end(), labelsN.begin() ) );
+}
+
+/** @ingroup Tests **/
@@ -0,0 +1,230 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testDenseCellMap.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/16
+ *
+ * This file is part of the DGtal library
+ */
+
+/**
+ * Description of testDenseCellMap' <p>
+ * Aim: checks that CubicalComplex, ParDirCollapse and VoxelComplex
+ * give the same results with \ref DenseCellMap.h as with std::map,
+ * with Catch unit test framework.
+ */
+#include <map>
+#include <random>
+#include <unordered_set>
+
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/kernel/sets/DigitalSetByAssociativeContainer.h"
+#include "DGtal/topology/KhalimskyCellHashFunctions.h"
+#include "DGtal/topology/CubicalComplex.h"
+#include "DGtal/topology/DenseCellMap.h"
+#include "DGtal/topology/ParDirCollapse.h"
+#include "DGtal/topology/VoxelComplex.h"
+#include "DGtal/topology/VoxelComplexFunctions.h"
+#include "DGtal/topology/tables/NeighborhoodTables.h"
+#include "DGtal/shapes/GaussDigitizer.h"
+#include "DGtal/shapes/Shapes.h"
+#include "DGtal/shapes/parametric/Flower2D.h"
+#include "DGtalCatch.h"
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class DenseCellMap.
+///////////////////////////////////////////////////////////////////////////////
+
+template < typename CC1, typename CC2 >
+bool sameCells( const CC1& cc1, const CC2& cc2 )
+{
+  for ( Dimension d = 0; d <= CC1::dimension; ++d )
+    if ( cc1.nbCells( d ) != cc2.nbCells( d ) ) return false;
+  for ( auto it = cc1.begin(), itE = cc1.end(); it != itE; ++it )
+    if ( ! cc2.belongs( *it ) ) return false;
+  return true;
+}
+
+TEST_CASE( "Testing DenseCellMap as a map" )
+{
+  typedef Z3i::KSpace                            KSpace;
+  typedef KSpace::Cell                           Cell;
+  typedef DenseCellMap< KSpace, int >            DenseMap;
+  KSpace K;
+  K.init( Z3i::Point( -6, -4, -9 ), Z3i::Point( 7, 5, 3 ), true );
+  DenseMap dense( K );
+  std::map< Cell, int > ref;
+  std::mt19937 gen( 17 );
+  std::uniform_int_distribution< int > kx( -12, 16 ), ky( -8, 12 ), kz( -18, 8 );
+  for ( int n = 0; n < 3000; ++n )
+    {
+      const Cell c = K.uCell( Z3i::Point( kx( gen ), ky( gen ), kz( gen ) ) );
+      if ( n % 3 == 2 )
+        {
+          REQUIRE( dense.erase( c ) == ref.erase( c ) );
+        }
+      else
+        {
+          const bool inserted = ref.insert( std::make_pair( c, n ) ).second;
+          const auto res = dense.insert( std::make_pair( c, n ) );
+          REQUIRE( res.second == inserted );
+          REQUIRE( res.first->first == c );
+        }
+    }
+  REQUIRE( dense.size() == ref.size() );
+  unsigned int nb = 0;
+  for ( const auto& v : dense )
+    {
+      auto it = ref.find( v.first );
+      REQUIRE( it != ref.end() );
+      REQUIRE( it->second == v.second );
+      ++nb;
+    }
+  REQUIRE( nb == ref.size() );
+  for ( const auto& v : ref )
+    REQUIRE( dense.count( v.first ) == 1 );
+  KSpace L;
+  L.init( Z3i::Point( -6, -4, -9 ), Z3i::Point( 20, 5, 3 ), true );
+  const Cell outside = L.uCell( Z3i::Point( 20, 0, 0 ) );
+  REQUIRE( dense.insert( std::make_pair( outside, 0 ) ).second == false );
+  REQUIRE( dense.find( outside ) == dense.end() );
+  for ( auto it = dense.begin(); it != dense.end(); )
+    it = ( it->second % 2 ) ? dense.erase( it ) : std::next( it );
+  for ( const auto& v : ref )
+    REQUIRE( dense.count( v.first ) == ( v.second % 2 ? 0 : 1 ) );
+  // Only the data of the cells is stored, not the cells.
+  REQUIRE( sizeof( DenseMap::Block ) <= DenseMap::BLOCK_SIZE * sizeof( int ) + 32 );
+  dense.clear();
+  REQUIRE( dense.empty() );
+  REQUIRE( dense.begin() == dense.end() );
+}
+
+TEST_CASE( "Testing CubicalComplex with DenseCellMap" )
+{
+  typedef Z3i::KSpace                                         KSpace;
+  typedef KSpace::Cell                                        Cell;
+  typedef CubicalComplex< KSpace, std::map< Cell, CubicalCellData > > MapCC;
+  typedef CubicalComplex< KSpace, DenseCellMap< KSpace, CubicalCellData > > DenseCC;
+  KSpace K;
+  K.init( Z3i::Point( -10, -10, -10 ), Z3i::Point( 10, 10, 10 ), true );
+  MapCC   mcc( K );
+  DenseCC dcc( K );
+  std::mt19937 gen( 3 );
+  std::uniform_int_distribution< int > kc( -20, 20 );
+  for ( int n = 0; n < 2000; ++n )
+    {
+      const Cell c = K.uCell( Z3i::Point( kc( gen ), kc( gen ), kc( gen ) ) );
+      mcc.insertCell( c );
+      dcc.insertCell( c );
+    }
+  SECTION( "Insertion gives the same complex" )
+    {
+      REQUIRE( sameCells( mcc, dcc ) );
+      REQUIRE( sameCells( dcc, mcc ) );
+    }
+  SECTION( "Closing and opening give the same complexes" )
+    {
+      mcc.close(); dcc.close();
+      REQUIRE( sameCells( dcc, mcc ) );
+      REQUIRE( mcc.euler() == dcc.euler() );
+      mcc.open();  dcc.open();
+      REQUIRE( sameCells( dcc, mcc ) );
+      REQUIRE( mcc.euler() == dcc.euler() );
+    }
+  SECTION( "Set operations give the same complexes" )
+    {
+      DenseCC dcc2( K );
+      MapCC   mcc2( K );
+      for ( int n = 0; n < 2000; ++n )
+        {
+          const Cell c = K.uCell( Z3i::Point( kc( gen ), kc( gen ), kc( gen ) ) );
+          mcc2.insertCell( c );
+          dcc2.insertCell( c );
+        }
+      REQUIRE( sameCells( dcc | dcc2, mcc | mcc2 ) );
+      REQUIRE( sameCells( dcc & dcc2, mcc & mcc2 ) );
+      REQUIRE( sameCells( dcc - dcc2, mcc - mcc2 ) );
+      REQUIRE( ( ( dcc | dcc2 ) == ( dcc2 | dcc ) ) );
+      REQUIRE( sameCells( ~dcc, ~mcc ) );
+    }
+}
+
+TEST_CASE( "Testing ParDirCollapse with DenseCellMap" )
+{
+  using namespace Z2i;
+  typedef CubicalComplex< KSpace, DenseCellMap< KSpace, CubicalCellData > > CC;
+  typedef Flower2D< Space > MyEuclideanShape;
+  MyEuclideanShape shape( RealPoint( 0.0, 0.0 ), 16, 5, 5, M_PI_2/2. );
+  typedef GaussDigitizer< Space, MyEuclideanShape > MyGaussDigitizer;
+  MyGaussDigitizer digShape;
+  digShape.attach( shape );
+  digShape.init ( shape.getLowerBound(), shape.getUpperBound(), 1.0 );
+  Domain domainShape = digShape.getDomain();
+  DigitalSet aSet( domainShape );
+  Shapes<Domain>::digitalShaper( aSet, digShape );
+
+  KSpace K;
+  CC complex( K ); // the bounds are taken at the first insertion.
+  K.init ( domainShape.lowerBound(), domainShape.upperBound(), true );
+  complex.construct( aSet );
+  const auto eulerBefore = complex.euler();
+  ParDirCollapse< CC > thinning( K );
+  thinning.attach( &complex );
+  REQUIRE( ( thinning.eval( 2 ) != 0 ) );
+  REQUIRE( eulerBefore == complex.euler() );
+  thinning.collapseSurface();
+  REQUIRE( eulerBefore == complex.euler() );
+}
+
+TEST_CASE( "Testing VoxelComplex with DenseCellMap" )
+{
+  using namespace Z3i;
+  using namespace DGtal::functions;
+  typedef DigitalSetByAssociativeContainer< Domain, std::unordered_set< Point > > DigitalSet;
+  typedef VoxelComplex< KSpace, std::map< KSpace::Cell, CubicalCellData > >           MapVC;
+  typedef VoxelComplex< KSpace, DenseCellMap< KSpace, CubicalCellData > >             DenseVC;
+
+  Domain domain( Point( -6, -6, -6 ), Point( 6, 6, 6 ) );
+  DigitalSet set( domain );
+  for ( auto p : domain )
+    if ( p.norm() <= 5.0 && ! ( p[ 0 ] == 0 && p[ 1 ] == 0 ) )
+      set.insertNew( p );
+  KSpace K;
+  K.init( domain.lowerBound(), domain.upperBound(), true );
+  auto table = loadTable( simplicity::tableSimple26_6 );
+  MapVC   mvc( K );
+  DenseVC dvc( K );
+  mvc.construct( set, table );
+  dvc.construct( set, table );
+  REQUIRE( sameCells( dvc, mvc ) );
+  auto mthin = asymetricThinningScheme< MapVC >
+    ( mvc, selectFirst< MapVC >, skelUltimate< MapVC > );
+  auto dthin = asymetricThinningScheme< DenseVC >
+    ( dvc, selectFirst< DenseVC >, skelUltimate< DenseVC > );
+  REQUIRE( mthin.nbCells( 3 ) < mvc.nbCells( 3 ) );
+  REQUIRE( dthin.nbCells( 3 ) == mthin.nbCells( 3 ) );
+  REQUIRE( dthin.euler() == mthin.euler() );
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
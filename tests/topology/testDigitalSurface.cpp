@@ -37,6 +37,8 @@
 #include "DGtal/topology/LightImplicitDigitalSurface.h"
 #include "DGtal/topology/ExplicitDigitalSurface.h"
 #include "DGtal/topology/LightExplicitDigitalSurface.h"
+#include "DGtal/topology/SetOfSurfels.h"
+#include "DGtal/topology/SortedSetOfSurfels.h"
 #include "DGtal/graph/BreadthFirstVisitor.h"
 #include "DGtal/topology/helpers/FrontierPredicate.h"
 #include "DGtal/topology/helpers/BoundaryPredicate.h"
@@ -583,6 +585,75 @@ bool testDigitalSurface()
   return nbok == nb;
 }
 
+template <typename KSpace>
+bool testSortedSetOfSurfels()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  std::string msg( "Testing block ... SortedSetOfSurfels in K" );
+  msg += '0' + KSpace::dimension;
+  trace.beginBlock ( msg );
+  typedef typename KSpace::Space Space;
+  typedef typename KSpace::Surfel Surfel;
+  typedef typename Space::Point Point;
+  typedef HyperRectDomain<Space> Domain;
+  typedef typename DigitalSetSelector < Domain, BIG_DS + HIGH_ITER_DS + HIGH_BEL_DS >::Type DigitalSet;
+  typedef DigitalSetBoundary<KSpace,DigitalSet> Boundary;
+  typedef SetOfSurfels<KSpace> SetContainer;
+  typedef SortedSetOfSurfels<KSpace> SortedContainer;
+  typedef DigitalSurface<SetContainer> SetDS;
+  typedef DigitalSurface<SortedContainer> SortedDS;
+  BOOST_CONCEPT_ASSERT(( CDigitalSurfaceContainer< SortedContainer > ));
+  BOOST_CONCEPT_ASSERT(( CUndirectedSimpleGraph < SortedDS > ));
+
+  Point p0 = Point::diagonal( 0 );
+  Domain domain( Point::diagonal( -6 ), Point::diagonal( 6 ) );
+  DigitalSet dig_set( domain );
+  Shapes<Domain>::addNorm2Ball( dig_set, p0, 3 );
+  Shapes<Domain>::removeNorm2Ball( dig_set, p0, 1 );
+  KSpace K;
+  K.init( domain.lowerBound(), domain.upperBound(), true );
+  SurfelAdjacency<KSpace::dimension> SAdj( true );
+  Boundary bdry( K, dig_set );
+  typename KSpace::SurfelSet surfels( bdry.begin(), bdry.end() );
+  SetDS setsurf( new SetContainer( K, SAdj, surfels ) );
+  SortedDS sortedsurf( new SortedContainer( K, SAdj, bdry.begin(), bdry.end() ) );
+  ++nb; nbok += sortedsurf.size() == setsurf.size() ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "sortedsurf.size() = " << sortedsurf.size()
+               << " == " << setsurf.size() << std::endl;
+  ++nb; nbok += std::is_sorted( sortedsurf.begin(), sortedsurf.end() ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "surfels are sorted." << std::endl;
+  ++nb; nbok += ! sortedsurf.container().hasAdjacentSurfels() ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "adjacent surfels are not computed before use." << std::endl;
+  unsigned int nbsame = 0;
+  for ( auto const & s : setsurf )
+    {
+      std::vector<Surfel> n1, n2;
+      std::back_insert_iterator< std::vector<Surfel> > it1( n1 ), it2( n2 );
+      setsurf.writeNeighbors( it1, s );
+      sortedsurf.writeNeighbors( it2, s );
+      nbsame += n1 == n2 ? 1 : 0;
+    }
+  ++nb; nbok += nbsame == setsurf.size()
+          && sortedsurf.container().hasAdjacentSurfels()
+          && sortedsurf.container().isValid() ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << nbsame << " surfels with the same neighbors." << std::endl;
+  BreadthFirstVisitor< SetDS > v1( setsurf, *setsurf.begin() );
+  BreadthFirstVisitor< SortedDS > v2( sortedsurf, *setsurf.begin() );
+  while ( ! v1.finished() ) v1.expand();
+  while ( ! v2.finished() ) v2.expand();
+  ++nb; nbok += v1.markedVertices() == v2.markedVertices() ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "nb visited = " << v2.markedVertices().size() << " == "
+               << v1.markedVertices().size() << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
 bool testOrderingDigitalSurfaceFacesAroundVertex()
 {
   typedef KhalimskySpaceND<3>     KSpace;
@@ -678,6 +749,9 @@ int main( int argc, char** argv )
     && testDigitalSurface<KhalimskySpaceND<2> >()
     && testDigitalSurface<KhalimskySpaceND<3> >()
     && testDigitalSurface<KhalimskySpaceND<4> >()
+    && testSortedSetOfSurfels<KhalimskySpaceND<2> >()
+    && testSortedSetOfSurfels<KhalimskySpaceND<3> >()
+    && testSortedSetOfSurfels<KhalimskySpaceND<4> >()
     && testOrderingDigitalSurfaceFacesAroundVertex();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
@@ -35,6 +35,9 @@
 #include "DGtal/shapes/Shapes.h"
 #include "DGtal/base/Common.h"
 #include "DGtal/topology/NeighborhoodConfigurations.h"
+#include "DGtal/topology/NeighborhoodConfigurationTables.h"
+#include "DGtal/topology/BinaryImageNeighborhood.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
 #include "DGtal/topology/tables/NeighborhoodTables.h"
 using namespace std;
 using namespace DGtal;
@@ -115,7 +118,7 @@ SCENARIO("Simplicity tables match on-the-fly calculations for all 3D topologies"
     size_t nsimples{0};
     size_t nsimples_tables{0};
     for( const auto & p : objSet){
-        auto simple = obj.isSimple(p);
+        auto simple = obj.isSimpleFromGeodesicNeighborhoods(p);
         if( simple ) ++nsimples;
         auto cfg = obj.getNeighborhoodConfigurationOccupancy(p, *mapZeroNeighborhoodToMask);
         auto simple_from_table = table[cfg];
@@ -137,7 +140,7 @@ SCENARIO("Simplicity tables match on-the-fly calculations for all 3D topologies"
     size_t nsimples{0};
     size_t nsimples_tables{0};
     for( const auto & p : objSet){
-        auto simple = obj.isSimple(p);
+        auto simple = obj.isSimpleFromGeodesicNeighborhoods(p);
         if( simple ) ++nsimples;
         auto cfg = obj.getNeighborhoodConfigurationOccupancy(p, *mapZeroNeighborhoodToMask);
         auto simple_from_table = table[cfg];
@@ -159,7 +162,7 @@ SCENARIO("Simplicity tables match on-the-fly calculations for all 3D topologies"
     size_t nsimples{0};
     size_t nsimples_tables{0};
     for( const auto & p : objSet){
-        auto simple = obj.isSimple(p);
+        auto simple = obj.isSimpleFromGeodesicNeighborhoods(p);
         if( simple ) ++nsimples;
         auto cfg = obj.getNeighborhoodConfigurationOccupancy(p, *mapZeroNeighborhoodToMask);
         auto simple_from_table = table[cfg];
@@ -182,7 +185,7 @@ SCENARIO("Simplicity tables match on-the-fly calculations for all 3D topologies"
     size_t nsimples{0};
     size_t nsimples_tables{0};
     for( const auto & p : objSet){
-        auto simple = obj.isSimple(p);
+        auto simple = obj.isSimpleFromGeodesicNeighborhoods(p);
         if( simple ) ++nsimples;
         auto cfg = obj.getNeighborhoodConfigurationOccupancy(p, *mapZeroNeighborhoodToMask);
         auto simple_from_table = table[cfg];
@@ -263,7 +266,7 @@ TEST_CASE_METHOD(Objects2D, "Simplicity tables match on-the-fly calculations for
       size_t nsimples{0};
       size_t nsimples_tables{0};
       for( const auto & p : objSet){
-        auto simple = obj.isSimple(p);
+        auto simple = obj.isSimpleFromGeodesicNeighborhoods(p);
         if( simple ) ++nsimples;
         auto cfg = obj.getNeighborhoodConfigurationOccupancy(p, *mapZeroNeighborhoodToMask);
         auto simple_from_table = table[cfg];
@@ -285,7 +288,7 @@ TEST_CASE_METHOD(Objects2D, "Simplicity tables match on-the-fly calculations for
       size_t nsimples{0};
       size_t nsimples_tables{0};
       for( const auto & p : objSet){
-        auto simple = obj.isSimple(p);
+        auto simple = obj.isSimpleFromGeodesicNeighborhoods(p);
         if( simple ) ++nsimples;
         auto cfg = obj.getNeighborhoodConfigurationOccupancy(p, *mapZeroNeighborhoodToMask);
         auto simple_from_table = table[cfg];
@@ -318,3 +321,110 @@ SCENARIO( "Load isthmus tables", "[isthmus]" ){
     boost::ignore_unused_variable_warning(table);
   }
 }
+
+/// Compares the shared tables with Object::isSimple, the configurations
+/// being computed from a binary image.
+template <typename TObject>
+void checkSharedTableOnImage(const typename TObject::DigitalTopology &dt,
+                             const typename TObject::DigitalSet & set)
+{
+  using DigitalTopology = typename TObject::DigitalTopology;
+  using Tables = NeighborhoodConfigurationTables< DigitalTopology >;
+  using Domain = typename TObject::Domain;
+  using Image = ImageContainerBySTLVector< Domain, unsigned char >;
+  TObject obj( dt, set );
+  Image image( set.domain() );
+  for ( const auto & p : set ) image.setValue( p, 1 );
+  BinaryImageNeighborhood< Image > neighborhood( image );
+  auto mapZeroNeighborhoodToMask =
+    mapZeroPointNeighborhoodToConfigurationMask< typename TObject::Point >();
+  for ( const auto & p : set )
+    {
+      const auto cfg = neighborhood.configuration( p );
+      INFO( "Point: " << p << " cfg: " << cfg );
+      CHECK( cfg == obj.getNeighborhoodConfigurationOccupancy( p, *mapZeroNeighborhoodToMask ) );
+      CHECK( Tables::isSimple( cfg ) == obj.isSimple( p ) );
+      CHECK( Tables::isSimple( cfg ) == obj.isSimpleFromGeodesicNeighborhoods( p ) );
+    }
+  obj.setTable( Tables::simplicityTable() );
+  for ( const auto & p : set )
+    CHECK( Tables::isSimple( neighborhood.configuration( p ) ) == obj.isSimple( p ) );
+}
+
+TEST_CASE( "Shared tables and binary image configurations", "[simple][table][image]" )
+{
+  SECTION( "3D topologies, on a ball cut by the domain" ) {
+    using namespace Z3i;
+    Domain domain( Point( -4, -4, -4 ), Point( 4, 4, 3 ) );
+    DigitalSet set( domain );
+    for ( auto p : domain )
+      if ( p.norm() <= 4.2 && p != Point( 1, 0, 0 ) && p[ 0 ] + p[ 1 ] != 2 )
+        set.insertNew( p );
+    checkSharedTableOnImage< Object26_6 >( dt26_6, set );
+    checkSharedTableOnImage< Object18_6 >( dt18_6, set );
+    checkSharedTableOnImage< Object6_18 >( dt6_18, set );
+    checkSharedTableOnImage< Object6_26 >( dt6_26, set );
+  }
+  SECTION( "2D topologies, on a disk cut by the domain" ) {
+    using namespace Z2i;
+    Domain domain( Point( -6, -6 ), Point( 6, 4 ) );
+    DigitalSet set( domain );
+    for ( auto p : domain )
+      if ( p.norm() <= 5.5 && p[ 0 ] != 2 )
+        set.insertNew( p );
+    checkSharedTableOnImage< Object4_8 >( dt4_8, set );
+    checkSharedTableOnImage< Object8_4 >( dt8_4, set );
+  }
+  SECTION( "Foreground masks" ) {
+    CHECK( Bits::nbSetBits( NeighborhoodConfigurationTables< Z3i::DT26_6 >::foregroundMask() ) == 26 );
+    CHECK( Bits::nbSetBits( NeighborhoodConfigurationTables< Z3i::DT18_6 >::foregroundMask() ) == 18 );
+    CHECK( Bits::nbSetBits( NeighborhoodConfigurationTables< Z3i::DT6_26 >::foregroundMask() ) == 6 );
+    CHECK( Bits::nbSetBits( NeighborhoodConfigurationTables< Z2i::DT4_8 >::foregroundMask() ) == 4 );
+    CHECK( Bits::nbSetBits( NeighborhoodConfigurationTables< Z2i::DT8_4 >::foregroundMask() ) == 8 );
+  }
+}
+
+TEST_CASE( "Homotopic thinning with shared tables", "[thinning][table][image]" )
+{
+  using namespace Z3i;
+  using Tables = NeighborhoodConfigurationTables< DT26_6 >;
+  Domain domain( Point( -12, -12, -6 ), Point( 12, 12, 6 ) );
+  DigitalSet torus( domain );
+  for ( auto p : domain )
+    {
+      const double r = std::sqrt( double( p[ 0 ] * p[ 0 ] + p[ 1 ] * p[ 1 ] ) );
+      if ( ( r - 8.0 ) * ( r - 8.0 ) + p[ 2 ] * p[ 2 ] <= 9.0 )
+        torus.insertNew( p );
+    }
+  SECTION( "Ultimate thinning of a torus gives a simple closed curve" ) {
+    using Image = ImageContainerBySTLVector< Domain, bool >;
+    Image image( domain );
+    for ( const auto & p : torus ) image.setValue( p, true );
+    const auto nb_removed = functions::homotopicThinning< DT26_6 >( image );
+    DigitalSet skeleton( domain );
+    for ( auto p : domain )
+      if ( image( p ) ) skeleton.insertNew( p );
+    CHECK( nb_removed + skeleton.size() == torus.size() );
+    Object26_6 obj( dt26_6, skeleton );
+    CHECK( obj.computeConnectedness() == CONNECTED );
+    CHECK( skeleton.size() < torus.size() / 10 );
+    for ( const auto & p : skeleton )
+      CHECK( ! obj.isSimple( p ) );
+  }
+  SECTION( "Thinning an object with isthmus preservation" ) {
+    Object26_6 obj( dt26_6, torus );
+    const auto size = obj.size();
+    const auto nb_removed = functions::homotopicThinning( obj, Tables::isIsthmus );
+    CHECK( nb_removed > 0 );
+    CHECK( obj.size() + nb_removed == size );
+    CHECK( obj.computeConnectedness() == CONNECTED );
+    BinaryImageNeighborhood< ImageContainerBySTLVector< Domain, bool > >::Image image( domain );
+    for ( const auto & p : obj.pointSet() ) image.setValue( p, true );
+    BinaryImageNeighborhood< ImageContainerBySTLVector< Domain, bool > > neighborhood( image );
+    for ( const auto & p : obj.pointSet() )
+      {
+        const auto cfg = neighborhood.configuration( p );
+        CHECK( ( ! Tables::isSimple( cfg ) || Tables::isIsthmus( cfg ) ) );
+      }
+  }
+}
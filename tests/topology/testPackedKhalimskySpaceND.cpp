@@ -0,0 +1,256 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testPackedKhalimskySpaceND.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/16
+ *
+ * This file is part of the DGtal library
+ */
+
+/**
+ * Description of testPackedKhalimskySpaceND' <p>
+ * Aim: checks that \ref PackedKhalimskySpaceND.h computes the same
+ * cells as \ref KhalimskySpaceND.h, with Catch unit test framework.
+ */
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/shapes/implicit/ImplicitBall.h"
+#include "DGtal/shapes/GaussDigitizer.h"
+#include "DGtal/topology/CCellularGridSpaceND.h"
+#include "DGtal/topology/KhalimskySpaceND.h"
+#include "DGtal/topology/PackedKhalimskySpaceND.h"
+#include "DGtal/topology/CubicalComplex.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+#include "DGtal/topology/SetOfSurfels.h"
+#include "DGtal/topology/DigitalSurface.h"
+
+#include "DGtalCatch.h"
+
+using namespace DGtal;
+using namespace std;
+
+BOOST_CONCEPT_ASSERT(( concepts::CCellularGridSpaceND< PackedKhalimskySpaceND< 2 > > ));
+BOOST_CONCEPT_ASSERT(( concepts::CCellularGridSpaceND< PackedKhalimskySpaceND< 3 > > ));
+BOOST_CONCEPT_ASSERT(( concepts::CCellularGridSpaceND< PackedKhalimskySpaceND< 3, DGtal::int64_t > > ));
+
+/// Compares every service on every cell of a small space.
+template < typename PackedSpace >
+void compareOnAllCells( const PackedSpace & P )
+{
+  typedef typename PackedSpace::UnpackedSpace KSpace;
+  typedef typename KSpace::Cell               Cell;
+  typedef typename KSpace::SCell              SCell;
+  typedef typename PackedSpace::Cell          PCell;
+  typedef typename PackedSpace::SCell         PSCell;
+  const KSpace & K = P.unpackedSpace();
+  const Dimension dim = KSpace::dimension;
+
+  std::size_t nbCells = 0;
+  std::size_t nbOk    = 0;
+  std::set< typename PCell::Code > codes;
+  HyperRectDomain< typename KSpace::Space > kdomain( K.uKCoords( K.lowerCell() ),
+                                                     K.uKCoords( K.upperCell() ) );
+  for ( auto const & kp : kdomain )
+    {
+      ++nbCells;
+      const Cell  c  = K.uCell( kp );
+      const PCell pc = P.uCell( kp );
+      codes.insert( pc.code() );
+      bool ok = P.unpack( pc ) == c && P.pack( c ) == pc
+        && P.uKCoords( pc ) == kp && P.uCoords( pc ) == K.uCoords( c )
+        && P.uDim( pc ) == K.uDim( c ) && P.uTopology( pc ) == K.uTopology( c )
+        && P.uIsSurfel( pc ) == K.uIsSurfel( c ) && P.uIsValid( pc );
+      for ( Dimension k = 0; k < dim; ++k )
+        {
+          ok = ok && P.uIsMax( pc, k ) == K.uIsMax( c, k )
+            && P.uIsMin( pc, k ) == K.uIsMin( c, k )
+            && P.uIsOpen( pc, k ) == K.uIsOpen( c, k );
+          if ( kp[ k ] < K.uKCoord( K.upperCell(), k ) )
+            ok = ok && P.unpack( P.uIncident( pc, k, true ) ) == K.uIncident( c, k, true );
+          if ( kp[ k ] > K.uKCoord( K.lowerCell(), k ) )
+            ok = ok && P.unpack( P.uIncident( pc, k, false ) ) == K.uIncident( c, k, false );
+          if ( ! K.uIsMax( c, k ) )
+            ok = ok && P.unpack( P.uAdjacent( pc, k, true ) ) == K.uAdjacent( c, k, true );
+        }
+      std::set< Cell > lower, plower, upper, pupper, faces, pfaces;
+      for ( auto const & f : K.uLowerIncident( c ) ) lower.insert( f );
+      for ( auto const & f : P.uLowerIncident( pc ) ) plower.insert( P.unpack( f ) );
+      for ( auto const & f : K.uUpperIncident( c ) ) upper.insert( f );
+      for ( auto const & f : P.uUpperIncident( pc ) ) pupper.insert( P.unpack( f ) );
+      for ( auto const & f : K.uFaces( c ) ) faces.insert( f );
+      for ( auto const & f : P.uFaces( pc ) ) pfaces.insert( P.unpack( f ) );
+      ok = ok && lower == plower && upper == pupper && faces == pfaces;
+
+      for ( bool sign : { true, false } )
+        {
+          const SCell  s  = K.sCell( kp, sign );
+          const PSCell ps = P.sCell( kp, sign );
+          ok = ok && P.unpack( ps ) == s && P.sSign( ps ) == sign
+            && P.unsigns( ps ) == pc && P.signs( pc, sign ) == ps
+            && P.unpack( P.sOpp( ps ) ) == K.sOpp( s );
+          for ( Dimension k = 0; k < dim; ++k )
+            {
+              ok = ok && P.sDirect( ps, k ) == K.sDirect( s, k );
+              if ( kp[ k ] <= K.uKCoord( K.lowerCell(), k )
+                   || kp[ k ] >= K.uKCoord( K.upperCell(), k ) ) continue;
+              ok = ok && P.unpack( P.sIncident( ps, k, true ) ) == K.sIncident( s, k, true )
+                && P.unpack( P.sIncident( ps, k, false ) ) == K.sIncident( s, k, false )
+                && P.unpack( P.sDirectIncident( ps, k ) ) == K.sDirectIncident( s, k )
+                && P.unpack( P.sIndirectIncident( ps, k ) ) == K.sIndirectIncident( s, k );
+            }
+          if ( K.sIsSurfel( s ) )
+            ok = ok && P.sOrthDir( ps ) == K.sOrthDir( s )
+              && P.interiorVoxel( ps ) == K.interiorVoxel( s )
+              && P.exteriorVoxel( ps ) == K.exteriorVoxel( s );
+        }
+      if ( ok ) ++nbOk;
+    }
+  REQUIRE( nbCells > 0 );
+  REQUIRE( nbOk == nbCells );
+  REQUIRE( codes.size() == nbCells );
+
+  // Scanning all the spels gives the same spels in the same order.
+  PCell p = P.uFirst( P.uSpel( P.lowerBound() ) );
+  Cell  c = K.uFirst( K.uSpel( K.lowerBound() ) );
+  const PCell pu = P.uLast( p );
+  const Cell  cu = K.uLast( c );
+  std::size_t nbSame = 0, nbSpels = 0;
+  bool more;
+  do
+    {
+      ++nbSpels;
+      if ( P.unpack( p ) == c ) ++nbSame;
+      more = K.uNext( c, K.uFirst( c ), cu );
+      REQUIRE( P.uNext( p, P.uFirst( p ), pu ) == more );
+    }
+  while ( more );
+  REQUIRE( nbSame == nbSpels );
+  REQUIRE( nbSpels == HyperRectDomain< typename KSpace::Space >( P.lowerBound(), P.upperBound() ).size() );
+}
+
+TEST_CASE( "Cells of PackedKhalimskySpaceND", "[topology][packed]" )
+{
+  SECTION( "Initialization" )
+    {
+      PackedKhalimskySpaceND< 3 > P;
+      REQUIRE( P.isValid() );
+      REQUIRE( P.init( Z3i::Point( -1000, 0, 5 ), Z3i::Point( 1000, 10, 50 ), true ) );
+      REQUIRE( ! P.init( Z3i::Point( 0, 0, 0 ), Z3i::Point( 1 << 20, 10, 10 ), true ) );
+      std::array< PackedKhalimskySpaceND< 3 >::Closure, 3 > closure
+        = { PackedKhalimskySpaceND< 3 >::CLOSED, PackedKhalimskySpaceND< 3 >::PERIODIC,
+            PackedKhalimskySpaceND< 3 >::OPEN };
+      REQUIRE( ! P.init( Z3i::Point( 0, 0, 0 ), Z3i::Point( 10, 10, 10 ), closure ) );
+      REQUIRE( sizeof( PackedKhalimskySpaceND< 3 >::SCell ) == 8 );
+    }
+
+  SECTION( "Same cells as KhalimskySpaceND in 2D" )
+    {
+      PackedKhalimskySpaceND< 2 > P;
+      REQUIRE( P.init( Z2i::Point( -3, 2 ), Z2i::Point( 4, 6 ), true ) );
+      compareOnAllCells( P );
+      REQUIRE( P.init( Z2i::Point( -3, 2 ), Z2i::Point( 4, 6 ), false ) );
+      compareOnAllCells( P );
+    }
+
+  SECTION( "Same cells as KhalimskySpaceND in 3D" )
+    {
+      PackedKhalimskySpaceND< 3 > P;
+      REQUIRE( P.init( Z3i::Point( -2, 0, 3 ), Z3i::Point( 2, 3, 5 ), true ) );
+      compareOnAllCells( P );
+      std::array< PackedKhalimskySpaceND< 3 >::Closure, 3 > closure
+        = { PackedKhalimskySpaceND< 3 >::CLOSED, PackedKhalimskySpaceND< 3 >::OPEN,
+            PackedKhalimskySpaceND< 3 >::CLOSED };
+      REQUIRE( P.init( Z3i::Point( -2, 0, 3 ), Z3i::Point( 2, 3, 5 ), closure ) );
+      compareOnAllCells( P );
+    }
+}
+
+TEST_CASE( "Surfaces and complexes in a PackedKhalimskySpaceND", "[topology][packed]" )
+{
+  typedef PackedKhalimskySpaceND< 3 >          PKSpace;
+  typedef ImplicitBall< Z3i::Space >           Ball;
+  typedef GaussDigitizer< Z3i::Space, Ball >   DigitalBall;
+  Ball ball( Z3i::RealPoint( 0.5, 0.0, -0.5 ), 7.5 );
+  DigitalBall dball;
+  dball.attach( ball );
+  dball.init( Z3i::RealPoint( -10, -10, -10 ), Z3i::RealPoint( 10, 10, 10 ), 1.0 );
+  Z3i::KSpace K;
+  PKSpace     P;
+  REQUIRE( K.init( dball.getLowerBound(), dball.getUpperBound(), true ) );
+  REQUIRE( P.init( dball.getLowerBound(), dball.getUpperBound(), true ) );
+
+  SECTION( "The boundaries of a ball are the same" )
+    {
+      std::set< Z3i::SCell > boundary;
+      std::set< PKSpace::SCell > pboundary;
+      Surfaces< Z3i::KSpace >::sMakeBoundary( boundary, K, dball,
+                                              K.lowerBound(), K.upperBound() );
+      Surfaces< PKSpace >::sMakeBoundary( pboundary, P, dball,
+                                          P.lowerBound(), P.upperBound() );
+      REQUIRE( boundary.size() > 0 );
+      REQUIRE( pboundary.size() == boundary.size() );
+      std::size_t nbOk = 0;
+      for ( auto const & s : pboundary )
+        if ( boundary.count( P.unpack( s ) ) ) ++nbOk;
+      REQUIRE( nbOk == boundary.size() );
+
+      std::set< PKSpace::SCell > tracked;
+      PKSpace::SCell bel = Surfaces< PKSpace >::findABel( P, dball, 10000 );
+      Surfaces< PKSpace >::trackBoundary( tracked, P, SurfelAdjacency< 3 >( true ), dball, bel );
+      REQUIRE( tracked == pboundary );
+
+      typedef SetOfSurfels< PKSpace, std::unordered_set< PKSpace::SCell > > SurfaceContainer;
+      SurfaceContainer::SurfelSet surfels( pboundary.begin(), pboundary.end() );
+      DigitalSurface< SurfaceContainer > surface
+        ( new SurfaceContainer( P, SurfelAdjacency< 3 >( true ), surfels ) );
+      REQUIRE( surface.size() == pboundary.size() );
+      // A digital sphere has Euler characteristic 2.
+      std::size_t nbArcs = 0;
+      for ( auto const & v : surface )
+        nbArcs += surface.degree( v );
+      const std::size_t nbFaces = surface.allClosedFaces().size();
+      REQUIRE( surface.allOpenFaces().size() == 0 );
+      REQUIRE( surface.size() + nbFaces == nbArcs / 2 + 2 );
+    }
+
+  SECTION( "Closed cubical complexes of a ball have the same number of cells" )
+    {
+      typedef CubicalComplex< Z3i::KSpace, std::map< Z3i::Cell, CubicalCellData > > CC;
+      typedef CubicalComplex< PKSpace, std::unordered_map< PKSpace::Cell, CubicalCellData > > PCC;
+      CC  complex( K );
+      PCC pcomplex( P );
+      for ( auto const & p : dball.getDomain() )
+        if ( dball( p ) )
+          {
+            complex.insertCell( K.uSpel( p ) );
+            pcomplex.insertCell( P.uSpel( p ) );
+          }
+      complex.close();
+      pcomplex.close();
+      for ( Dimension d = 0; d <= 3; ++d )
+        REQUIRE( pcomplex.nbCells( d ) == complex.nbCells( d ) );
+      REQUIRE( pcomplex.euler() == 1 );
+    }
+}
@@ -42,6 +42,7 @@
 #include "DGtal/io/readers/VolReader.h"
 #include "DGtal/base/ConstAlias.h"
 #include "DGtal/images/ImageContainerBySTLMap.h"
+#include "DGtal/base/WorkStealingScheduler.h"
 ///////////////////////////////////////////////////////////////////////////////
 
 using namespace std;
@@ -315,6 +316,69 @@ bool testFindABel()
   return nbok == nb;
 }
 
+/**
+* Test of the parallel extraction of the boundary and of its
+* components, which should give the same surfels as sMakeBoundary and
+* trackBoundary.
+*/
+template <typename KSpace3D>
+bool testParallelBoundary()
+{
+  typedef KSpace3D                   KSpace;
+  typedef typename KSpace::Space     Space;
+  typedef typename KSpace::Point     Point;
+  typedef typename KSpace::SCell     SCell;
+  typedef typename KSpace::SCellSet  SCellSet;
+  typedef HyperRectDomain<Space>     Domain;
+  typedef DigitalSetBySTLSet<Domain> DigitalSet;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing Surfaces::sMakeBoundaryParallel and trackBoundaryParallel." );
+  Point p1( -12, -12, -12 );
+  Point p2(  12,  12,  12 );
+  KSpace K; K.init( p1, p2, true );
+  Domain domain( p1, p2 );
+  DigitalSet aSet( domain );
+  Shapes<Domain>::addNorm2Ball( aSet, Point( -5, -5, -5 ), 4 );
+  Shapes<Domain>::addNorm2Ball( aSet, Point(  5,  4,  5 ), 5 );
+  Shapes<Domain>::removeNorm2Ball( aSet, Point(  5,  4,  5 ), 2 );
+  SurfelAdjacency<3> SAdj( true );
+  WorkStealingScheduler::setNumberOfThreads( 4 );
+
+  SCellSet bdry;
+  Surfaces<KSpace>::sMakeBoundary( bdry, K, aSet, K.lowerBound(), K.upperBound() );
+  std::vector<SCell> pbdry;
+  Surfaces<KSpace>::sMakeBoundaryParallel( pbdry, K, aSet, K.lowerBound(), K.upperBound() );
+  ++nb; nbok += std::equal( bdry.begin(), bdry.end(), pbdry.begin(), pbdry.end() ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << bdry.size() << " bels, " << pbdry.size()
+               << " bels in parallel." << std::endl;
+
+  std::vector< std::vector<SCell> > components;
+  Surfaces<KSpace>::sMakeBoundaryComponents( components, K, SAdj, aSet,
+                                             K.lowerBound(), K.upperBound() );
+  ++nb; nbok += components.size() == 3 ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << components.size() << " components (should be 3)." << std::endl;
+  for ( auto const & component : components )
+    {
+      SCellSet surface, psurface;
+      Surfaces<KSpace>::trackBoundary( surface, K, SAdj, aSet, component.front() );
+      Surfaces<KSpace>::trackBoundaryParallel( psurface, K, SAdj, aSet,
+                                               component.back() );
+      ++nb; nbok += std::equal( surface.begin(), surface.end(),
+                                component.begin(), component.end() ) ? 1 : 0;
+      ++nb; nbok += surface == psurface ? 1 : 0;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+                   << "component of " << component.size() << " bels, tracked "
+                   << surface.size() << " bels, " << psurface.size()
+                   << " bels in parallel." << std::endl;
+    }
+  WorkStealingScheduler::setNumberOfThreads( 0 );
+  trace.endBlock();
+  return nbok == nb;
+}
+
 
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
@@ -328,7 +392,8 @@ int main( int argc, char** argv )
   trace.info() << endl;
 
   bool res = testComputeInterior()
-    && testFindABel< KhalimskySpaceND<3,int> >()  && test3dSurfaceHelper();
+    && testFindABel< KhalimskySpaceND<3,int> >()  && test3dSurfaceHelper()
+    && testParallelBoundary< KhalimskySpaceND<3,int> >();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
@@ -806,6 +806,36 @@ TEST_CASE_METHOD(Fixture_isthmus, "Thin complex", "[isthmus][thin][function]") {
         CHECK(vc_new.nbCells(3) == 3);
     }
 }
+
+TEST_CASE_METHOD(Fixture_isthmus, "Subfield thin complex",
+                 "[isthmus][thin][subfield][function]") {
+    using namespace DGtal::functions;
+    auto &vc = complex_fixture;
+    const auto euler = vc.euler();
+    SECTION("eraseVoxelCell is the reverse of insertVoxelCell") {
+        auto vc_new = vc;
+        const auto voxel = vc.space().uSpel(Point(0, 0, 1));
+        vc_new.insertVoxelCell(voxel);
+        vc_new.eraseVoxelCell(voxel);
+        CHECK(vc_new == vc);
+    }
+    SECTION("with skelUltimate") {
+        auto vc_new = subfieldThinningScheme<FixtureComplex>(
+            vc, skelUltimate<FixtureComplex>);
+        CHECK(vc_new.nbCells(3) == 1);
+        CHECK(vc_new.nbCells(0) == 8);
+        CHECK(vc_new.euler() == euler);
+    }
+    SECTION("with skelIsthmus") {
+        vc.setSimplicityTable(
+            functions::loadTable(simplicity::tableSimple26_6));
+        auto vc_new = subfieldThinningScheme<FixtureComplex>(
+            vc, skelIsthmus<FixtureComplex>);
+        CHECK(vc_new.nbCells(3) > 1);
+        CHECK(vc_new.nbCells(3) < vc.nbCells(3));
+        CHECK(vc_new.euler() == euler);
+    }
+}
 //
 TEST_CASE_METHOD(Fixture_isthmus, "Persistence thin",
                  "[persistence][isthmus][thin][function]") {
@@ -1055,6 +1085,27 @@ TEST_CASE_METHOD(Fixture_X, "X Thin with Isthmus, and tables",
     }
 }
 
+TEST_CASE_METHOD(Fixture_X, "X Subfield thin with tables",
+                 "[x][isthmus][thin][subfield][function][table]") {
+    using namespace DGtal::functions;
+    auto &vc = complex_fixture;
+    vc.setSimplicityTable(
+        functions::loadTable(simplicity::tableSimple26_6));
+    const auto euler = vc.euler();
+    SECTION("with skelUltimate, no simple voxel is left") {
+        auto vc_new = subfieldThinningScheme<FixtureComplex>(
+            vc, skelUltimate<FixtureComplex>);
+        CHECK(vc_new.nbCells(3) == 1);
+        CHECK(vc_new.euler() == euler);
+    }
+    SECTION("with oneIsthmus, the branches are preserved") {
+        auto vc_new = subfieldThinningScheme<FixtureComplex>(
+            vc, oneIsthmus<FixtureComplex>);
+        CHECK(vc_new.nbCells(3) > 1);
+        CHECK(vc_new.euler() == euler);
+    }
+}
+
 /// Use distance map in the Select function.
 TEST_CASE_METHOD(Fixture_X, "X DistanceMap", "[x][distance][thin]") {
     using namespace DGtal::functions;